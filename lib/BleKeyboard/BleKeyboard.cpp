@@ -1,5 +1,6 @@
 #include "BleKeyboard.h"
 #include "KeyboardLayout.h"
+#include <KeyboardCodepoints.h>
 
 #if defined(USE_NIMBLE)
 #include <NimBLEDevice.h>
@@ -210,11 +211,22 @@ void BleKeyboard::begin(const uint8_t *layout, uint16_t showAs) {
         advertising->addServiceUUID(hid->hidService()->getUUID());
     }
     advertising->setScanResponse(false);
-    advertising->start();
+    pServer->advertiseOnDisconnect(false);
+    startAdvertising();
     hid->setBatteryLevel(batteryLevel);
+
+    // Notify from the BLE core, write() only queues the reports
+    if (!reportQueue) {
+        reportQueue = xQueueCreate(reportQueueSize, sizeof(QueuedReport));
+        xTaskCreatePinnedToCore(senderLoop, "bleTyping", 4096, this, 2, &senderTask, 0);
+    }
 }
 
 void BleKeyboard::end(void) {
+    // The sender drops what is left once disconnected
+    this->connected = false;
+    if (reportQueue) { xQueueReset(reportQueue); }
+
     int i = 0;
     i = pServer->getConnectedCount();
     if (i > 0) {
@@ -228,6 +240,43 @@ void BleKeyboard::end(void) {
 
 bool BleKeyboard::isConnected(void) const { return this->connected; }
 
+BleKeyboard *BleKeyboard::advertisingOwner = nullptr;
+
+void BleKeyboard::startAdvertising() {
+    // Bonded host first, it reconnects without having to scan for us
+    if (!directedPeer.empty()) {
+        for (int i = 0; i < NimBLEDevice::getNumBonds(); i++) {
+            NimBLEAddress bonded = NimBLEDevice::getBondedAddress(i);
+            if (bonded.toString() != directedPeer) { continue; }
+
+            advertisingOwner = this;
+            advertising->setAdvertisementType(BLE_GAP_CONN_MODE_DIR);
+            if (advertising->start(directedAdvertisingMs, onDirectedAdvertisingComplete, &bonded)) { return; }
+            break;
+        }
+    }
+
+    advertising->setAdvertisementType(BLE_GAP_CONN_MODE_UND);
+    advertising->start();
+}
+
+void BleKeyboard::onDirectedAdvertisingComplete(NimBLEAdvertising *pAdv) {
+    // The host did not come back in time, any host can find us again
+    if (advertisingOwner && advertisingOwner->pServer->getConnectedCount() == 0) {
+        pAdv->setAdvertisementType(BLE_GAP_CONN_MODE_UND);
+        pAdv->start();
+    }
+}
+
+bool BleKeyboard::isSending(void) const {
+    return sending || (reportQueue && uxQueueMessagesWaiting(reportQueue) > 0);
+}
+
+void BleKeyboard::cancelTyping(void) {
+    if (reportQueue) { xQueueReset(reportQueue); }
+    releaseAll(); // queued after the report being notified, if any
+}
+
 void BleKeyboard::setBatteryLevel(uint8_t level) {
     this->batteryLevel = level;
     if (hid != 0) this->hid->setBatteryLevel(this->batteryLevel);
@@ -237,7 +286,7 @@ void BleKeyboard::setBatteryLevel(uint8_t level) {
 void BleKeyboard::setName(String deviceName) { this->deviceName = deviceName; }
 
 /**
- * @brief Sets the waiting time (in milliseconds) between multiple keystrokes in NimBLE mode.
+ * @brief Sets an extra waiting time (in milliseconds) between reports, 0 paces on the connection interval only.
  *
  * @param ms Time in milliseconds
  */
@@ -249,16 +298,9 @@ void BleKeyboard::set_product_id(uint16_t pid) { this->pid = pid; }
 
 void BleKeyboard::set_version(uint16_t version) { this->version = version; }
 
+// Key reports go through the typing queue so they stay in order with the text being sent
 void BleKeyboard::sendReport(KeyReport *keys) {
-    // if (this->isConnected())
-    if (this->isConnected() && this->inputKeyboard->getSubscribedCount() > 0) {
-        this->inputKeyboard->setValue((uint8_t *)keys, sizeof(KeyReport));
-        this->inputKeyboard->notify();
-#if defined(USE_NIMBLE)
-        // vTaskDelay(delayTicks);
-        this->delay_ms(_delay_ms);
-#endif // USE_NIMBLE
-    }
+    if (this->isConnected()) { queueReport(*keys); }
 }
 
 void BleKeyboard::sendReport(MediaKeyReport *keys) {
@@ -266,13 +308,61 @@ void BleKeyboard::sendReport(MediaKeyReport *keys) {
     if (this->isConnected() && this->inputKeyboard->getSubscribedCount() > 0) {
         this->inputMediaKeys->setValue((uint8_t *)keys, sizeof(MediaKeyReport));
         this->inputMediaKeys->notify();
-#if defined(USE_NIMBLE)
-        // vTaskDelay(delayTicks);
-        this->delay_ms(_delay_ms);
-#endif // USE_NIMBLE
     }
 }
 
+void BleKeyboard::queueReport(const KeyReport &report) {
+    if (!reportQueue) { return; }
+    QueuedReport item = {report, false, 0, 0};
+    // Only blocks when more than the queue size is waiting
+    xQueueSend(reportQueue, &item, portMAX_DELAY);
+}
+
+void BleKeyboard::senderLoop(void *arg) {
+    BleKeyboard *self = static_cast<BleKeyboard *>(arg);
+    QueuedReport item;
+
+    while (true) {
+        if (xQueueReceive(self->reportQueue, &item, portMAX_DELAY) != pdTRUE) { continue; }
+        self->sending = true;
+
+        if (item.marker) {
+            uint32_t elapsedMs = millis() - item.startMs;
+            self->lastCharsPerSecond = elapsedMs ? (uint32_t)item.chars * 1000 / elapsedMs : item.chars;
+        } else if (self->isConnected() && self->inputKeyboard->getSubscribedCount() > 0) {
+            self->notifyPaced(item.report);
+        }
+
+        self->sending = uxQueueMessagesWaiting(self->reportQueue) > 0;
+    }
+}
+
+void BleKeyboard::notifyPaced(const KeyReport &report) {
+    // Connection interval in 1.25 ms units, a few notifications fit in each connection event
+    uint32_t intervalUs = 7500;
+    if (pServer->getConnectedCount() > 0) { intervalUs = pServer->getPeerInfo(0).getConnInterval() * 1250; }
+
+    uint32_t nowUs = micros();
+    if (nowUs - intervalStartUs >= intervalUs) {
+        intervalStartUs = nowUs;
+        reportsThisInterval = 0;
+    }
+    if (reportsThisInterval >= reportsPerInterval) {
+        vTaskDelay(pdMS_TO_TICKS((intervalUs - (nowUs - intervalStartUs)) / 1000 + 1));
+        intervalStartUs = micros();
+        reportsThisInterval = 0;
+    }
+
+    // Wait for the controller to free its buffers instead of failing the notify
+    while (os_msys_num_free() < minFreeMbufs && isConnected()) { vTaskDelay(1); }
+
+    this->inputKeyboard->setValue((uint8_t *)&report, sizeof(KeyReport));
+    this->inputKeyboard->notify();
+    reportsThisInterval++;
+
+    if (_delay_ms) { vTaskDelay(pdMS_TO_TICKS(_delay_ms)); }
+}
+
 uint8_t USBPutChar(uint8_t c);
 
 // press() adds the specified key (printing, non-printing, or modifier)
@@ -396,6 +486,7 @@ void BleKeyboard::releaseAll(void) {
 }
 
 size_t BleKeyboard::write(uint8_t c) {
+    if (c < 0x80) { return write(&c, 1); }
     uint8_t p = press(c); // Keydown
     release(c);           // Keyup
     return p;             // just return the result of press() since release() almost always returns 1
@@ -407,18 +498,27 @@ size_t BleKeyboard::write(const MediaKeyReport c) {
     return p;              // just return the result of press() since release() almost always returns 1
 }
 
+// Packs the UTF-8 text into 6KRO reports and queues them, returns before they are all notified
+// The write error is set when a character could not be typed
 size_t BleKeyboard::write(const uint8_t *buffer, size_t size) {
-    size_t n = 0;
-    while (size--) {
-        if (*buffer != '\r') {
-            if (write(*buffer)) {
-                n++;
-            } else {
-                break;
-            }
-        }
-        buffer++;
+    if (!this->isConnected()) { return 0; }
+
+    auto send = [this](const KeyReport &keys) {
+        queueReport(keys);
+        return true;
+    };
+    uint32_t startMs = millis();
+
+    // The first packed report replaces whatever press() left held
+    memset(&_keyReport, 0, sizeof(_keyReport));
+    bool complete = true;
+    size_t n = codepoints::typeText(buffer, size, _asciimap, _unicodeInput, send, &complete);
+    if (!complete) {
+        setWriteError();
     }
+
+    QueuedReport marker = {{0}, true, (uint16_t)n, startMs};
+    xQueueSend(reportQueue, &marker, portMAX_DELAY);
     return n;
 }
 
@@ -436,10 +536,20 @@ void BleKeyboard::onConnect(BLEServer *pServer) {
 #endif // !USE_NIMBLE
 }
 
+void BleKeyboard::onConnect(BLEServer *pServer, ble_gap_conn_desc *desc) {
+    std::string address = NimBLEAddress(desc->peer_id_addr).toString();
+    strncpy(peerAddress, address.c_str(), sizeof(peerAddress) - 1);
+}
+
 void BleKeyboard::onDisconnect(BLEServer *pServer) {
     this->connected = false;
-    // NimBLEDevice::startAdvertising();
+    peerAddress[0] = '\0';
     Serial.println("lib disconnected");
+    if (connectionCallback) { connectionCallback(false); }
+
+#if defined(USE_NIMBLE)
+    startAdvertising();
+#endif // USE_NIMBLE
 
 #if !defined(USE_NIMBLE)
 
@@ -461,6 +571,7 @@ void BleKeyboard::onAuthenticationComplete(ble_gap_conn_desc *desc) {
         Serial.println("Pairing failed");
         this->connected = false;
     }
+    if (connectionCallback) { connectionCallback(this->connected); }
 }
 
 void BleKeyboard::onWrite(BLECharacteristic *me) {
@@ -469,16 +580,6 @@ void BleKeyboard::onWrite(BLECharacteristic *me) {
     ESP_LOGI(LOG_TAG, "special keys: %d", *value);
 }
 
-void BleKeyboard::delay_ms(uint64_t ms) {
-    uint64_t m = esp_timer_get_time();
-    if (ms) {
-        uint64_t e = (m + (ms * 1000));
-        if (m > e) { // overflow
-            while (esp_timer_get_time() > e) {}
-        }
-        while (esp_timer_get_time() < e) {}
-    }
-}
 void BleKeyboard::onSubscribe(
     NimBLECharacteristic *pCharacteristic, ble_gap_conn_desc *desc, uint16_t subValue
 ) {
@@ -29,6 +29,10 @@
 #include "Bad_Usb_Lib.h"
 #include "Print.h"
 #include "keys.h"
+#include <KeyReportPacker.h>
+#include <KeyboardCodepoints.h>
+#include <functional>
+#include <string>
 
 #define BLE_KEYBOARD_VERSION "0.0.4"
 #define BLE_KEYBOARD_VERSION_MAJOR 0
@@ -50,8 +54,36 @@ private:
     String deviceManufacturer;
     uint8_t batteryLevel;
     bool connected = false;
-    uint32_t _delay_ms = 7;
-    void delay_ms(uint64_t ms);
+    uint32_t _delay_ms = 0;
+
+    // Typing queue, reports are notified by a task paced on the connection interval
+    struct QueuedReport {
+        KeyReport report;
+        bool marker;      // end of a write(), nothing to notify
+        uint16_t chars;   // marker only: chars typed
+        uint32_t startMs; // marker only: when the text was queued
+    };
+    static const uint16_t reportQueueSize = 256;
+    static const uint8_t reportsPerInterval = 4; // notifications per connection event
+    static const uint8_t minFreeMbufs = 4;       // leave room for the host stack
+    QueueHandle_t reportQueue = nullptr;
+    TaskHandle_t senderTask = nullptr;
+    uint32_t intervalStartUs = 0;
+    uint8_t reportsThisInterval = 0;
+    volatile uint32_t lastCharsPerSecond = 0;
+    volatile bool sending = false;
+    static void senderLoop(void *arg);
+    void queueReport(const KeyReport &report);
+    void notifyPaced(const KeyReport &report);
+
+    // Bonded host reconnection
+    static const uint32_t directedAdvertisingMs = 1280; // high duty cycle directed advertising limit
+    static BleKeyboard *advertisingOwner;
+    char peerAddress[18] = {0}; // identity address of the connected host
+    std::string directedPeer;   // bonded host advertised to first
+    std::function<void(bool)> connectionCallback;
+    static void onDirectedAdvertisingComplete(NimBLEAdvertising *pAdv);
+    void startAdvertising();
 
     uint16_t vid = 0x05ac;
     uint16_t pid = 0x820a;
@@ -61,6 +93,7 @@ private:
     uint16_t appearance = 0x03C1;
 
     const uint8_t *_asciimap;
+    codepoints::UnicodeInput _unicodeInput = codepoints::UnicodeInput::Off;
 
 public:
     BleKeyboard(
@@ -70,6 +103,7 @@ public:
     void begin(const uint8_t *layout = KeyboardLayout_en_US) override { begin(layout, HID_KEYBOARD); };
     void begin(const uint8_t *layout, uint16_t showAs);
     void setLayout(const uint8_t *layout = KeyboardLayout_en_US) { _asciimap = layout; }
+    void setUnicodeInput(codepoints::UnicodeInput input) { _unicodeInput = input; } // for chars missing from the layout
     void end(void) override;
     void sendReport(KeyReport *keys);
     void sendReport(MediaKeyReport *keys);
@@ -82,6 +116,12 @@ public:
     size_t write(const uint8_t *buffer, size_t size) override;
     void releaseAll(void) override;
     bool isConnected(void) const;
+    bool isSending(void) const;
+    void cancelTyping(void); // drop the queued reports and release every key
+    uint32_t getCharsPerSecond(void) const { return lastCharsPerSecond; }
+    std::string getPeerAddress(void) const { return std::string(peerAddress); }
+    void setDirectedPeer(const std::string &address) { directedPeer = address; }
+    void onConnectionChange(std::function<void(bool connected)> callback) { connectionCallback = callback; }
     void setBatteryLevel(uint8_t level);
     void setName(String deviceName);
     void setDelay(uint32_t ms);
@@ -98,6 +138,7 @@ protected:
     bool _randUUID = false;
     virtual void onStarted(BLEServer *pServer) {};
     virtual void onConnect(BLEServer *pServer) override;
+    virtual void onConnect(BLEServer *pServer, ble_gap_conn_desc *desc) override;
     virtual void onDisconnect(BLEServer *pServer) override;
     virtual void onAuthenticationComplete(ble_gap_conn_desc *desc);
     virtual void onWrite(BLECharacteristic *me) override;
@@ -0,0 +1,127 @@
+/*
+  KeyReportPacker.h
+
+  Turns a string into the shortest sequence of boot keyboard reports that
+  types it. Each new key goes in its own report while the previous ones
+  stay held (up to six, 6KRO), so the host sees the presses in order
+  without a release report after every character. Keys are released all
+  at once when the report is full, when the same key comes again, or when
+  the modifiers change. Modifiers never change in the report that presses
+  a key.
+
+  No hardware here, the caller sends the reports (USB or BLE).
+*/
+
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+//  Low level key report: up to 6 keys and shift, ctrl etc at once
+#ifndef BAD_USB_KEYREPORT_DEFINED
+#define BAD_USB_KEYREPORT_DEFINED
+typedef struct
+{
+  uint8_t modifiers;
+  uint8_t reserved;
+  uint8_t keys[6];
+} KeyReport;
+#endif
+
+// One key to type: HID usage code and the modifiers it needs
+struct KeyStroke {
+    uint8_t modifiers;
+    uint8_t keycode;
+};
+
+class KeyReportPacker
+{
+public:
+    static const uint8_t MOD_LEFT_SHIFT = 0x02;
+    static const uint8_t MOD_RIGHT_ALT = 0x40; // AltGr
+
+    KeyReportPacker() { reset(); }
+
+    // Forget the keys held, the next stroke starts from an empty report
+    void reset() {
+        memset(&report, 0, sizeof(report));
+        count = 0;
+    }
+
+    // Stroke for an ASCII char in a layout table (see KeyboardLayout.h), keycode 0 when not typable
+    static KeyStroke strokeFor(uint8_t c, const uint8_t* asciimap) {
+        KeyStroke stroke = {0, 0};
+        if (c >= 0x80 || !asciimap) {
+            return stroke;
+        }
+
+        uint8_t k = asciimap[c];
+        if ((k & 0xc0) == 0xc0) {          // ALT_GR
+            stroke.modifiers = MOD_RIGHT_ALT;
+            k &= 0x3F;
+        } else if (k & 0x80) {             // SHIFT
+            stroke.modifiers = MOD_LEFT_SHIFT;
+            k &= 0x7F;
+        }
+        if (k == 0x32) {                   // ISO_REPLACEMENT
+            k = 0x64;                      // ISO_KEY
+        }
+        stroke.keycode = k;
+        return stroke;
+    }
+
+    // Reports to send for the stroke, in order. send(const KeyReport&) returns false to stop
+    template <typename Send>
+    bool push(const KeyStroke& stroke, Send send) {
+        if (stroke.keycode == 0) {
+            return true;
+        }
+
+        if (stroke.modifiers != report.modifiers) {
+            // Release the keys and switch the modifiers before pressing
+            clearKeys();
+            report.modifiers = stroke.modifiers;
+            if (!send(report)) {
+                return false;
+            }
+        } else if (count == 6 || holds(stroke.keycode)) {
+            // Same key again or no free slot, release everything first
+            clearKeys();
+            if (!send(report)) {
+                return false;
+            }
+        }
+
+        report.keys[count++] = stroke.keycode;
+        return send(report);
+    }
+
+    // Release everything still held
+    template <typename Send>
+    bool finish(Send send) {
+        if (count == 0 && report.modifiers == 0) {
+            return true;
+        }
+        reset();
+        return send(report);
+    }
+
+    const KeyReport& current() const { return report; }
+
+private:
+    KeyReport report;
+    uint8_t count;
+
+    bool holds(uint8_t keycode) const {
+        for (uint8_t i = 0; i < count; i++) {
+            if (report.keys[i] == keycode) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void clearKeys() {
+        memset(report.keys, 0, sizeof(report.keys));
+        count = 0;
+    }
+};
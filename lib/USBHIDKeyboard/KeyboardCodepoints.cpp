@@ -0,0 +1,390 @@
+/*
+  KeyboardCodepoints.cpp
+
+  Direct and dead keys of each layout, compiled into lookup tables.
+  Dead keys also cover the ASCII chars marked "requires dead key + space"
+  in the layout maps. en_US has no table, it only types ASCII.
+*/
+
+#include "KeyboardCodepoints.h"
+
+extern const uint8_t KeyboardLayout_de_DE[];
+extern const uint8_t KeyboardLayout_en_UK[];
+extern const uint8_t KeyboardLayout_es_ES[];
+extern const uint8_t KeyboardLayout_fr_FR[];
+extern const uint8_t KeyboardLayout_it_IT[];
+extern const uint8_t KeyboardLayout_pt_PT[];
+extern const uint8_t KeyboardLayout_pt_BR[];
+extern const uint8_t KeyboardLayout_sv_SE[];
+extern const uint8_t KeyboardLayout_da_DK[];
+extern const uint8_t KeyboardLayout_hu_HU[];
+
+namespace codepoints {
+
+// Maximum slots read by a lookup, checked for every layout below
+static constexpr size_t maxProbe = 4;
+
+// fr_FR, Windows AZERTY
+constexpr CodepointEntry frDirect[] = {
+    direct(0xE9, key(0x1f)),        // é
+    direct(0xE8, key(0x24)),        // è
+    direct(0xE7, key(0x26)),        // ç
+    direct(0xE0, key(0x27)),        // à
+    direct(0xF9, key(0x34)),        // ù
+    direct(0xB2, key(0x35)),        // ²
+    direct(0xB0, shift(0x2d)),      // °
+    direct(0xA3, shift(0x30)),      // £
+    direct(0xA4, altGr(0x30)),      // ¤
+    direct(0xB5, shift(0x31)),      // µ
+    direct(0xA7, shift(0x38)),      // §
+    direct(0x20AC, altGr(0x08)),    // €
+};
+constexpr DeadKey frDead[] = {
+    {Accent::Circumflex, key(0x2f)},
+    {Accent::Diaeresis, shift(0x2f)},
+    {Accent::Tilde, altGr(0x1f)},
+    {Accent::Grave, altGr(0x24)},
+};
+constexpr CodepointTable frTable = buildTable(frDirect, frDead);
+
+// de_DE, QWERTZ
+constexpr CodepointEntry deDirect[] = {
+    direct(0xE4, key(0x34)),   direct(0xC4, shift(0x34)),   // ä Ä
+    direct(0xF6, key(0x33)),   direct(0xD6, shift(0x33)),   // ö Ö
+    direct(0xFC, key(0x2f)),   direct(0xDC, shift(0x2f)),   // ü Ü
+    direct(0xDF, key(0x2d)),                                // ß
+    direct(0xA7, shift(0x20)),                              // §
+    direct(0xB0, shift(0x35)),                              // °
+    direct(0xB2, altGr(0x1f)), direct(0xB3, altGr(0x20)),   // ² ³
+    direct(0xB5, altGr(0x10)),                              // µ
+    direct(0x20AC, altGr(0x08)),                            // €
+};
+constexpr DeadKey deDead[] = {
+    {Accent::Circumflex, key(0x35)},
+    {Accent::Acute, key(0x2e)},
+    {Accent::Grave, shift(0x2e)},
+};
+constexpr CodepointTable deTable = buildTable(deDirect, deDead);
+
+// es_ES
+constexpr CodepointEntry esDirect[] = {
+    direct(0xF1, key(0x33)),   direct(0xD1, shift(0x33)),   // ñ Ñ
+    direct(0xE7, key(0x31)),   direct(0xC7, shift(0x31)),   // ç Ç
+    direct(0xBA, key(0x35)),   direct(0xAA, shift(0x35)),   // º ª
+    direct(0xA1, key(0x2e)),   direct(0xBF, shift(0x2e)),   // ¡ ¿
+    direct(0xB7, shift(0x20)),                              // ·
+    direct(0xAC, altGr(0x23)),                              // ¬
+    direct(0x20AC, altGr(0x08)),                            // €
+};
+constexpr DeadKey esDead[] = {
+    {Accent::Grave, key(0x2f)},
+    {Accent::Circumflex, shift(0x2f)},
+    {Accent::Acute, key(0x34)},
+    {Accent::Diaeresis, shift(0x34)},
+    {Accent::Tilde, altGr(0x21)},
+};
+constexpr CodepointTable esTable = buildTable(esDirect, esDead);
+
+// it_IT, no dead keys
+constexpr CodepointEntry itDirect[] = {
+    direct(0xE8, key(0x2f)),   direct(0xE9, shift(0x2f)),   // è é
+    direct(0xF2, key(0x33)),   direct(0xE7, shift(0x33)),   // ò ç
+    direct(0xE0, key(0x34)),   direct(0xB0, shift(0x34)),   // à °
+    direct(0xF9, key(0x31)),   direct(0xA7, shift(0x31)),   // ù §
+    direct(0xEC, key(0x2e)),                                // ì
+    direct(0xA3, shift(0x20)),                              // £
+    direct(0x20AC, altGr(0x08)),                            // €
+};
+constexpr CodepointTable itTable = buildTable(itDirect);
+
+// pt_PT
+constexpr CodepointEntry ptDirect[] = {
+    direct(0xE7, key(0x33)),   direct(0xC7, shift(0x33)),   // ç Ç
+    direct(0xBA, key(0x34)),   direct(0xAA, shift(0x34)),   // º ª
+    direct(0xAB, key(0x2e)),   direct(0xBB, shift(0x2e)),   // « »
+    direct(0xA3, altGr(0x20)), direct(0xA7, altGr(0x21)),   // £ §
+    direct(0x20AC, altGr(0x08)),                            // €
+};
+constexpr DeadKey ptDead[] = {
+    {Accent::Acute, key(0x30)},
+    {Accent::Grave, shift(0x30)},
+    {Accent::Tilde, key(0x31)},
+    {Accent::Circumflex, shift(0x31)},
+};
+constexpr CodepointTable ptTable = buildTable(ptDirect, ptDead);
+
+// pt_BR, ABNT2
+constexpr CodepointEntry brDirect[] = {
+    direct(0xE7, key(0x33)),   direct(0xC7, shift(0x33)),   // ç Ç
+};
+constexpr DeadKey brDead[] = {
+    {Accent::Acute, key(0x2f)},
+    {Accent::Grave, shift(0x2f)},
+    {Accent::Tilde, key(0x34)},
+    {Accent::Circumflex, shift(0x34)},
+    {Accent::Diaeresis, shift(0x23)},
+};
+constexpr CodepointTable brTable = buildTable(brDirect, brDead);
+
+// sv_SE
+constexpr CodepointEntry svDirect[] = {
+    direct(0xE5, key(0x2f)),   direct(0xC5, shift(0x2f)),   // å Å
+    direct(0xE4, key(0x34)),   direct(0xC4, shift(0x34)),   // ä Ä
+    direct(0xF6, key(0x33)),   direct(0xD6, shift(0x33)),   // ö Ö
+    direct(0xA7, key(0x35)),   direct(0xBD, shift(0x35)),   // § ½
+    direct(0xA4, shift(0x21)),                              // ¤
+    direct(0xA3, altGr(0x20)),                              // £
+    direct(0xB5, altGr(0x10)),                              // µ
+    direct(0x20AC, altGr(0x08)),                            // €
+};
+constexpr DeadKey nordicDead[] = {
+    {Accent::Acute, key(0x2e)},
+    {Accent::Grave, shift(0x2e)},
+    {Accent::Diaeresis, key(0x30)},
+    {Accent::Circumflex, shift(0x30)},
+    {Accent::Tilde, altGr(0x30)},
+};
+constexpr CodepointTable svTable = buildTable(svDirect, nordicDead);
+
+// da_DK
+constexpr CodepointEntry daDirect[] = {
+    direct(0xE6, key(0x33)),   direct(0xC6, shift(0x33)),   // æ Æ
+    direct(0xF8, key(0x34)),   direct(0xD8, shift(0x34)),   // ø Ø
+    direct(0xE5, key(0x2f)),   direct(0xC5, shift(0x2f)),   // å Å
+    direct(0xBD, key(0x35)),   direct(0xA7, shift(0x35)),   // ½ §
+    direct(0xA4, shift(0x21)),                              // ¤
+    direct(0xA3, altGr(0x20)),                              // £
+    direct(0x20AC, altGr(0x08)),                            // €
+};
+constexpr CodepointTable daTable = buildTable(daDirect, nordicDead);
+
+// hu_HU, the accents are dead keys on AltGr + digits
+constexpr CodepointEntry huDirect[] = {
+    direct(0xF6, key(0x27)),   direct(0xD6, shift(0x27)),     // ö Ö
+    direct(0xFC, key(0x2d)),   direct(0xDC, shift(0x2d)),     // ü Ü
+    direct(0xF3, key(0x2e)),   direct(0xD3, shift(0x2e)),     // ó Ó
+    direct(0x151, key(0x2f)),  direct(0x150, shift(0x2f)),    // ő Ő
+    direct(0xFA, key(0x30)),   direct(0xDA, shift(0x30)),     // ú Ú
+    direct(0xE9, key(0x33)),   direct(0xC9, shift(0x33)),     // é É
+    direct(0xE1, key(0x34)),   direct(0xC1, shift(0x34)),     // á Á
+    direct(0x171, key(0x31)),  direct(0x170, shift(0x31)),    // ű Ű
+    direct(0xED, key(0x64)),   direct(0xCD, shift(0x64)),     // í Í
+    direct(0xA7, shift(0x35)),                                // §
+    direct(0xDF, altGr(0x34)),                                // ß
+    direct(0x20AC, altGr(0x18)),                              // €
+};
+constexpr DeadKey huDead[] = {
+    {Accent::Tilde, altGr(0x1e)},
+    {Accent::Circumflex, altGr(0x20)},
+    {Accent::Grave, altGr(0x24)},
+    {Accent::Acute, altGr(0x26)},
+    {Accent::Diaeresis, altGr(0x2d)},
+};
+constexpr CodepointTable huTable = buildTable(huDirect, huDead);
+
+// en_UK, accents on AltGr + vowel
+constexpr CodepointEntry ukDirect[] = {
+    direct(0xA3, shift(0x20)),                                // £
+    direct(0x20AC, altGr(0x21)),                              // €
+    direct(0xAC, shift(0x35)),                                // ¬
+    direct(0xA6, altGr(0x35)),                                // ¦
+    direct(0xE1, altGr(0x04)), direct(0xC1, altGrShift(0x04)), // á Á
+    direct(0xE9, altGr(0x08)), direct(0xC9, altGrShift(0x08)), // é É
+    direct(0xED, altGr(0x0c)), direct(0xCD, altGrShift(0x0c)), // í Í
+    direct(0xF3, altGr(0x12)), direct(0xD3, altGrShift(0x12)), // ó Ó
+    direct(0xFA, altGr(0x18)), direct(0xDA, altGrShift(0x18)), // ú Ú
+};
+constexpr CodepointTable ukTable = buildTable(ukDirect);
+
+static_assert(frTable.longestProbe() <= maxProbe, "fr_FR table probes too long");
+static_assert(deTable.longestProbe() <= maxProbe, "de_DE table probes too long");
+static_assert(esTable.longestProbe() <= maxProbe, "es_ES table probes too long");
+static_assert(itTable.longestProbe() <= maxProbe, "it_IT table probes too long");
+static_assert(ptTable.longestProbe() <= maxProbe, "pt_PT table probes too long");
+static_assert(brTable.longestProbe() <= maxProbe, "pt_BR table probes too long");
+static_assert(svTable.longestProbe() <= maxProbe, "sv_SE table probes too long");
+static_assert(daTable.longestProbe() <= maxProbe, "da_DK table probes too long");
+static_assert(huTable.longestProbe() <= maxProbe, "hu_HU table probes too long");
+static_assert(ukTable.longestProbe() <= maxProbe, "en_UK table probes too long");
+static_assert(frTable.find(0xEA)->base == 'e', "dead key compositions are generated");
+
+const CodepointTable* tableFor(const uint8_t* asciimap) {
+    if (asciimap == KeyboardLayout_fr_FR) return &frTable;
+    if (asciimap == KeyboardLayout_de_DE) return &deTable;
+    if (asciimap == KeyboardLayout_es_ES) return &esTable;
+    if (asciimap == KeyboardLayout_it_IT) return &itTable;
+    if (asciimap == KeyboardLayout_pt_PT) return &ptTable;
+    if (asciimap == KeyboardLayout_pt_BR) return &brTable;
+    if (asciimap == KeyboardLayout_sv_SE) return &svTable;
+    if (asciimap == KeyboardLayout_da_DK) return &daTable;
+    if (asciimap == KeyboardLayout_hu_HU) return &huTable;
+    if (asciimap == KeyboardLayout_en_UK) return &ukTable;
+    return nullptr;
+}
+
+uint8_t strokesFor(uint32_t codepoint, const uint8_t* asciimap, KeyStroke strokes[2]) {
+    // Layout table first, it also holds the ASCII chars that are dead keys
+    const CodepointTable* table = tableFor(asciimap);
+    const CodepointEntry* entry = table ? table->find(codepoint) : nullptr;
+    if (entry) {
+        strokes[0] = entry->stroke;
+        if (!entry->base) {
+            return 1;
+        }
+        strokes[1] = KeyReportPacker::strokeFor(entry->base, asciimap);
+        return strokes[1].keycode ? 2 : 0;
+    }
+
+    if (codepoint < 0x80) {
+        strokes[0] = KeyReportPacker::strokeFor(codepoint, asciimap);
+        return strokes[0].keycode ? 1 : 0;
+    }
+    return 0;
+}
+
+static const KeyStroke releaseKeys = {0, 0};
+static const uint8_t MOD_CTRL_SHIFT = 0x03;
+static const uint8_t MOD_LEFT_ALT = 0x04; // Option on macOS
+
+static char hexDigit(uint32_t value) {
+    return "0123456789abcdef"[value & 0xF];
+}
+
+// Numpad 1-9 then 0, whatever the layout
+static uint8_t keypadKey(uint8_t digit) {
+    return digit == 0 ? 0x62 : 0x58 + digit;
+}
+
+// Unicode Hex Input is a US layout
+static uint8_t usHexKey(char digit) {
+    if (digit >= 'a') return 0x04 + (digit - 'a');
+    return digit == '0' ? 0x27 : 0x1E + (digit - '1');
+}
+
+uint8_t inputStrokesFor(uint32_t codepoint, const uint8_t* asciimap, UnicodeInput input, KeyStroke strokes[maxInputStrokes]) {
+    // No control chars, surrogates or values past Unicode
+    if (codepoint < 0x20 || (codepoint >= 0xD800 && codepoint < 0xE000) || codepoint > 0x10FFFF) {
+        return 0;
+    }
+    uint8_t count = 0;
+
+    switch (input) {
+        case UnicodeInput::Linux: {
+            // Hex digits typed with the layout, the host reads characters
+            KeyStroke u = KeyReportPacker::strokeFor('u', asciimap);
+            if (!u.keycode) {
+                return 0;
+            }
+            strokes[count++] = {MOD_CTRL_SHIFT, u.keycode};
+            strokes[count++] = releaseKeys;
+
+            int shift = 20;
+            while (shift > 0 && (codepoint >> shift) == 0) {
+                shift -= 4;
+            }
+            for (; shift >= 0; shift -= 4) {
+                KeyStroke digit = KeyReportPacker::strokeFor(hexDigit(codepoint >> shift), asciimap);
+                if (!digit.keycode) {
+                    return 0;
+                }
+                strokes[count++] = digit;
+            }
+            strokes[count++] = KeyReportPacker::strokeFor(' ', asciimap);
+            break;
+        }
+
+        case UnicodeInput::Windows: {
+            // Alt+0nnn is the ANSI code page, the same as Unicode except 0x80-0x9F
+            if (codepoint < 0x80 || (codepoint >= 0xA0 && codepoint < 0x100)) {
+                strokes[count++] = {MOD_LEFT_ALT, keypadKey(0)};
+                for (uint32_t divisor = 100; divisor > 0; divisor /= 10) {
+                    strokes[count++] = {MOD_LEFT_ALT, keypadKey((codepoint / divisor) % 10)};
+                }
+                break;
+            }
+
+            // Numpad digits, letters with the layout keys
+            strokes[count++] = {MOD_LEFT_ALT, 0x57}; // keypad +
+            int shift = 20;
+            while (shift > 0 && (codepoint >> shift) == 0) {
+                shift -= 4;
+            }
+            for (; shift >= 0; shift -= 4) {
+                uint8_t value = (codepoint >> shift) & 0xF;
+                uint8_t keycode = value < 10 ? keypadKey(value) : KeyReportPacker::strokeFor(hexDigit(value), asciimap).keycode;
+                if (!keycode) {
+                    return 0;
+                }
+                strokes[count++] = {MOD_LEFT_ALT, keycode};
+            }
+            break;
+        }
+
+        case UnicodeInput::MacOS: {
+            uint16_t units[2] = {static_cast<uint16_t>(codepoint), 0};
+            uint8_t unitCount = 1;
+            if (codepoint > 0xFFFF) {
+                units[0] = 0xD800 + ((codepoint - 0x10000) >> 10);
+                units[1] = 0xDC00 + ((codepoint - 0x10000) & 0x3FF);
+                unitCount = 2;
+            }
+            for (uint8_t u = 0; u < unitCount; u++) {
+                for (int shift = 12; shift >= 0; shift -= 4) {
+                    strokes[count++] = {MOD_LEFT_ALT, usHexKey(hexDigit(units[u] >> shift))};
+                }
+            }
+            break;
+        }
+
+        case UnicodeInput::Off:
+            return 0;
+    }
+
+    // Modifiers let go so the host commits the character
+    strokes[count++] = releaseKeys;
+    return count;
+}
+
+size_t compileText(const uint8_t* text, size_t size, const uint8_t* asciimap, UnicodeInput input,
+                   std::vector<TextStroke>& strokes, bool* complete) {
+    strokes.reserve(strokes.size() + size + 8);
+    size_t compiled = 0;
+    bool stopped = false;
+
+    while (size > 0) {
+        uint32_t codepoint = 0;
+        size_t used = decodeUtf8(text, size, codepoint);
+        text += used;
+        size -= used;
+        if (codepoint == '\r') {
+            continue;
+        }
+
+        KeyStroke keys[maxInputStrokes];
+        uint8_t count = strokesFor(codepoint, asciimap, keys);
+        if (count == 2) {
+            // The dead key is released before the letter it composes with
+            keys[2] = keys[1];
+            keys[1] = releaseKeys;
+            count = 3;
+        } else if (count == 0) {
+            count = inputStrokesFor(codepoint, asciimap, input, keys);
+            if (count == 0) {
+                stopped = true;
+                break;
+            }
+        }
+
+        for (uint8_t i = 0; i < count; i++) {
+            strokes.push_back({keys[i], i + 1 == count});
+        }
+        compiled++;
+    }
+
+    if (complete) {
+        *complete = !stopped;
+    }
+    return compiled;
+}
+
+} // namespace codepoints
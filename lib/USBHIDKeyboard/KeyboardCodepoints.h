@@ -0,0 +1,247 @@
+/*
+  KeyboardCodepoints.h
+
+  Unicode characters beyond the 128 entry ASCII maps of KeyboardLayout_*.cpp.
+  Each layout lists its direct keys (é on fr_FR, ß on de_DE, € with AltGr...)
+  and its dead keys. The tables are built at compile time: every dead key is
+  expanded with the compositions below (dead ^ then e gives ê, dead ^ then
+  space gives ^ alone), then stored in an open addressing table so a lookup
+  is a hash and a few bounded probes.
+
+  Key codes here are real HID usages, 0x64 is the ISO key (the ASCII maps
+  write it 0x32, see KeyboardLayout.h).
+
+  Characters missing from a layout can go through an input method of the
+  host instead (Ctrl+Shift+U on Linux, Alt + numpad on Windows, Unicode Hex
+  Input on macOS), see UnicodeInput.
+
+  Shared by the USB and BLE keyboards through typeText(), which works out
+  every stroke of the text before the first report is sent.
+*/
+
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "KeyReportPacker.h"
+
+namespace codepoints {
+
+// One character: a key (or dead key), then an optional ASCII char typed with the layout map
+struct CodepointEntry {
+    uint32_t codepoint;
+    KeyStroke stroke;
+    char base; // 0 when the stroke alone types the character
+};
+
+enum class Accent : uint8_t { Acute, Grave, Circumflex, Diaeresis, Tilde };
+
+struct DeadKey {
+    Accent accent;
+    KeyStroke stroke;
+};
+
+struct Composition {
+    Accent accent;
+    char base;
+    uint16_t codepoint;
+};
+
+constexpr KeyStroke key(uint8_t code) { return {0x00, code}; }
+constexpr KeyStroke shift(uint8_t code) { return {0x02, code}; }
+constexpr KeyStroke altGr(uint8_t code) { return {0x40, code}; }
+constexpr KeyStroke altGrShift(uint8_t code) { return {0x42, code}; }
+constexpr CodepointEntry direct(uint32_t codepoint, KeyStroke stroke) { return {codepoint, stroke, 0}; }
+
+// Latin-1 letters reachable from a dead key
+constexpr Composition compositions[] = {
+    {Accent::Acute, 'a', 0xE1}, {Accent::Acute, 'A', 0xC1}, {Accent::Acute, 'e', 0xE9}, {Accent::Acute, 'E', 0xC9},
+    {Accent::Acute, 'i', 0xED}, {Accent::Acute, 'I', 0xCD}, {Accent::Acute, 'o', 0xF3}, {Accent::Acute, 'O', 0xD3},
+    {Accent::Acute, 'u', 0xFA}, {Accent::Acute, 'U', 0xDA}, {Accent::Acute, 'y', 0xFD}, {Accent::Acute, 'Y', 0xDD},
+    {Accent::Grave, 'a', 0xE0}, {Accent::Grave, 'A', 0xC0}, {Accent::Grave, 'e', 0xE8}, {Accent::Grave, 'E', 0xC8},
+    {Accent::Grave, 'i', 0xEC}, {Accent::Grave, 'I', 0xCC}, {Accent::Grave, 'o', 0xF2}, {Accent::Grave, 'O', 0xD2},
+    {Accent::Grave, 'u', 0xF9}, {Accent::Grave, 'U', 0xD9},
+    {Accent::Circumflex, 'a', 0xE2}, {Accent::Circumflex, 'A', 0xC2}, {Accent::Circumflex, 'e', 0xEA},
+    {Accent::Circumflex, 'E', 0xCA}, {Accent::Circumflex, 'i', 0xEE}, {Accent::Circumflex, 'I', 0xCE},
+    {Accent::Circumflex, 'o', 0xF4}, {Accent::Circumflex, 'O', 0xD4}, {Accent::Circumflex, 'u', 0xFB},
+    {Accent::Circumflex, 'U', 0xDB},
+    {Accent::Diaeresis, 'a', 0xE4}, {Accent::Diaeresis, 'A', 0xC4}, {Accent::Diaeresis, 'e', 0xEB},
+    {Accent::Diaeresis, 'E', 0xCB}, {Accent::Diaeresis, 'i', 0xEF}, {Accent::Diaeresis, 'I', 0xCF},
+    {Accent::Diaeresis, 'o', 0xF6}, {Accent::Diaeresis, 'O', 0xD6}, {Accent::Diaeresis, 'u', 0xFC},
+    {Accent::Diaeresis, 'U', 0xDC}, {Accent::Diaeresis, 'y', 0xFF},
+    {Accent::Tilde, 'a', 0xE3}, {Accent::Tilde, 'A', 0xC3}, {Accent::Tilde, 'o', 0xF5}, {Accent::Tilde, 'O', 0xD5},
+    {Accent::Tilde, 'n', 0xF1}, {Accent::Tilde, 'N', 0xD1},
+};
+
+// Dead key followed by space
+constexpr uint32_t accentAlone(Accent accent) {
+    return accent == Accent::Acute ? 0xB4
+         : accent == Accent::Grave ? '`'
+         : accent == Accent::Circumflex ? '^'
+         : accent == Accent::Diaeresis ? 0xA8
+         : '~';
+}
+
+class CodepointTable {
+public:
+    static constexpr size_t capacity = 256; // power of two, layouts have fewer than 128 entries
+
+    // First definition wins, direct keys are inserted before dead key compositions
+    constexpr bool insert(const CodepointEntry& entry) {
+        size_t slot = slotFor(entry.codepoint);
+        for (size_t probe = 0; probe < capacity; probe++) {
+            CodepointEntry& current = slots[(slot + probe) & (capacity - 1)];
+            if (current.codepoint == entry.codepoint) {
+                return false;
+            }
+            if (current.codepoint == 0) {
+                current = entry;
+                count++;
+                if (probe + 1 > maxProbe) {
+                    maxProbe = probe + 1;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // At most maxProbe slots are read
+    constexpr const CodepointEntry* find(uint32_t codepoint) const {
+        size_t slot = slotFor(codepoint);
+        for (size_t probe = 0; probe < maxProbe; probe++) {
+            const CodepointEntry& current = slots[(slot + probe) & (capacity - 1)];
+            if (current.codepoint == codepoint) {
+                return &current;
+            }
+            if (current.codepoint == 0) {
+                return nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    // Every entry, in slot order
+    template <typename Visit>
+    void forEach(Visit visit) const {
+        for (const auto& slot : slots) {
+            if (slot.codepoint != 0) {
+                visit(slot);
+            }
+        }
+    }
+
+    constexpr size_t size() const { return count; }
+    constexpr size_t longestProbe() const { return maxProbe; }
+
+private:
+    CodepointEntry slots[capacity] = {};
+    size_t count = 0;
+    size_t maxProbe = 0;
+
+    // Fibonacci hashing, the top 8 bits pick the slot
+    static constexpr size_t slotFor(uint32_t codepoint) {
+        return static_cast<uint32_t>(codepoint * 2654435761u) >> 24;
+    }
+};
+
+template <size_t DirectCount>
+constexpr CodepointTable buildTable(const CodepointEntry (&directKeys)[DirectCount]) {
+    CodepointTable table;
+    for (const auto& entry : directKeys) {
+        table.insert(entry);
+    }
+    return table;
+}
+
+template <size_t DirectCount, size_t DeadCount>
+constexpr CodepointTable buildTable(const CodepointEntry (&directKeys)[DirectCount], const DeadKey (&deadKeys)[DeadCount]) {
+    CodepointTable table = buildTable(directKeys);
+    for (const auto& dead : deadKeys) {
+        table.insert({accentAlone(dead.accent), dead.stroke, ' '});
+        for (const auto& composition : compositions) {
+            if (composition.accent == dead.accent) {
+                table.insert({composition.codepoint, dead.stroke, composition.base});
+            }
+        }
+    }
+    return table;
+}
+
+// Table of an ASCII layout map (KeyboardLayout_fr_FR...), null when the layout has none
+const CodepointTable* tableFor(const uint8_t* asciimap);
+
+// Strokes typing the character on the layout: 1, 2 with a dead key, 0 when not typable
+uint8_t strokesFor(uint32_t codepoint, const uint8_t* asciimap, KeyStroke strokes[2]);
+
+// Input method of the host, only used for characters the layout can't type
+enum class UnicodeInput : uint8_t {
+    Off,
+    Linux,   // IBus and GTK: Ctrl+Shift+U, hex digits, space
+    Windows, // Alt + numpad 0 and decimal up to U+00FF, Alt + numpad + and hex above (EnableHexNumpad)
+    MacOS,   // Unicode Hex Input source: Option + 4 hex digits, surrogate pairs above U+FFFF
+};
+
+static constexpr uint8_t maxInputStrokes = 12;
+
+// Strokes typing the codepoint through the input method, a keycode 0 releases every key. 0 when it can't
+uint8_t inputStrokesFor(uint32_t codepoint, const uint8_t* asciimap, UnicodeInput input, KeyStroke strokes[maxInputStrokes]);
+
+// Next UTF-8 character, returns the bytes used (at least 1), invalid bytes give U+FFFD
+inline size_t decodeUtf8(const uint8_t* text, size_t size, uint32_t& codepoint) {
+    uint8_t lead = text[0];
+    size_t length = lead < 0x80 ? 1 : (lead & 0xE0) == 0xC0 ? 2 : (lead & 0xF0) == 0xE0 ? 3 : (lead & 0xF8) == 0xF0 ? 4 : 0;
+    if (length == 0 || length > size) {
+        codepoint = 0xFFFD;
+        return 1;
+    }
+
+    codepoint = length == 1 ? lead : lead & (0xFF >> (length + 1));
+    for (size_t i = 1; i < length; i++) {
+        if ((text[i] & 0xC0) != 0x80) {
+            codepoint = 0xFFFD;
+            return i;
+        }
+        codepoint = (codepoint << 6) | (text[i] & 0x3F);
+    }
+    return length;
+}
+
+// Stroke of a compiled text, keycode 0 releases every key
+struct TextStroke {
+    KeyStroke stroke;
+    bool endsCharacter; // last stroke of a character
+};
+
+// Strokes of the whole text, stops at the first character neither the layout nor the input method types.
+// Returns the characters compiled, complete tells whether the whole text was
+size_t compileText(const uint8_t* text, size_t size, const uint8_t* asciimap, UnicodeInput input,
+                   std::vector<TextStroke>& strokes, bool* complete = nullptr);
+
+// Types UTF-8 text through the packer, compiled first so no lookup runs between two reports.
+// Returns the characters typed, complete tells whether the whole text was
+template <typename Send>
+size_t typeText(const uint8_t* text, size_t size, const uint8_t* asciimap, UnicodeInput input, Send send, bool* complete = nullptr) {
+    std::vector<TextStroke> strokes;
+    bool compiled = true;
+    compileText(text, size, asciimap, input, strokes, &compiled);
+
+    KeyReportPacker packer;
+    size_t typed = 0;
+    bool sent = true;
+    for (const auto& step : strokes) {
+        sent = step.stroke.keycode ? packer.push(step.stroke, send) : packer.finish(send);
+        if (!sent) {
+            break;
+        }
+        typed += step.endsCharacter;
+    }
+
+    packer.finish(send);
+    if (complete) {
+        *complete = compiled && sent;
+    }
+    return typed;
+}
+
+} // namespace codepoints
@@ -5,8 +5,8 @@
   only in Keyboard.cpp and the keyboard layout files. Layout files map
   ASCII character codes to keyboard scan codes (technically, to USB HID
   Usage codes), possibly altered by the SHIFT or ALT_GR modifiers.
-  Non-ACSII characters (anything outside the 7-bit range NUL..DEL) are
-  not supported.
+  Non-ACSII characters (anything outside the 7-bit range NUL..DEL) and
+  dead keys are listed per layout in KeyboardCodepoints.cpp.
 
   == Creating your own layout ==
 
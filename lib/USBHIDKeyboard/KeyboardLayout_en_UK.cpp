@@ -131,7 +131,7 @@ extern const uint8_t KeyboardLayout_en_UK[128] PROGMEM =
 	0x1c,          // y
 	0x1d,          // z
 	0x2f|SHIFT,    // {
-	0x35, 		   // |		ok
+	0x32|SHIFT,    // |
 	0x30|SHIFT,    // }
 	0x31|SHIFT,    // ~		ok
 	0x00           // DEL
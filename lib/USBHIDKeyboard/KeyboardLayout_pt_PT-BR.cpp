@@ -46,7 +46,7 @@ extern const uint8_t KeyboardLayout_pt_BR[128] PROGMEM =
 	0x20|SHIFT,    // #
 	0x21|SHIFT,    // $
 	0x22|SHIFT,    // %
-	0x23|SHIFT,    // &
+	0x24|SHIFT,    // &
 	0x35,          // '
 	0x26|SHIFT,    // (
 	0x27|SHIFT,    // )
@@ -72,7 +72,7 @@ extern const uint8_t KeyboardLayout_pt_BR[128] PROGMEM =
 	0x36|SHIFT,     // <
 	0x2e,          // =
 	0x37|SHIFT,    // >
-	0x54|SHIFT,    // ? ???
+	0x1a|ALT_GR,   // ? (the ABNT2 ?/ key is beyond 0x7f)
 	0x1f|SHIFT,    // @
 
 	0x04|SHIFT,    // A
@@ -137,7 +137,7 @@ extern const uint8_t KeyboardLayout_pt_BR[128] PROGMEM =
 	0x1d,          // z
 
 	0x30|SHIFT,   // {
-	0x64|SHIFT,    // |
+	0x32|SHIFT,    // |
 	0x31|SHIFT,   // }
 	0x34,          // ~  not supported (requires dead key + space)
 	0x00           // DEL
@@ -24,6 +24,7 @@
 #if CONFIG_TINYUSB_HID_ENABLED
 
 #include "USBHIDKeyboard.h"
+#include "KeyboardCodepoints.h"
 
 ESP_EVENT_DEFINE_BASE(ARDUINO_USB_HID_KEYBOARD_EVENTS);
 esp_err_t arduino_usb_event_post(esp_event_base_t event_base, int32_t event_id, void *event_data, size_t event_data_size, TickType_t ticks_to_wait);
@@ -70,7 +71,7 @@ void USBHIDKeyboard::_onOutput(uint8_t report_id, const uint8_t* buffer, uint16_
     }
 }
 
-void USBHIDKeyboard::sendReport(KeyReport* keys)
+bool USBHIDKeyboard::sendReport(KeyReport* keys)
 {
     hid_keyboard_report_t report;
     report.reserved = 0;
@@ -80,7 +81,20 @@ void USBHIDKeyboard::sendReport(KeyReport* keys)
     } else {
         memset(report.keycode, 0, 6);
     }
-    hid.SendReport(HID_REPORT_ID_KEYBOARD, &report, sizeof(report));
+    return hid.SendReport(HID_REPORT_ID_KEYBOARD, &report, sizeof(report));
+}
+
+// SendReport() returns once the host has polled the report, retry a busy endpoint a few times
+bool USBHIDKeyboard::sendPacked(const KeyReport& keys)
+{
+    for (uint8_t attempt = 0; attempt < 3; attempt++) {
+        KeyReport copy = keys;
+        if (sendReport(&copy)) {
+            return true;
+        }
+        delay(2);
+    }
+    return false;
 }
 
 #define SHIFT 0x80
@@ -211,24 +225,26 @@ void USBHIDKeyboard::releaseAll(void)
 
 size_t USBHIDKeyboard::write(uint8_t c)
 {
-    uint8_t p = press(c);  // Keydown
-    delay(15);
-    release(c);            // Keyup
-    delay(15);
-    return p;              // just return the result of press() since release() almost always returns 1
+    if (c >= 0x80) {
+        // Modifier or non-printing key, each report is paced by the host polling
+        uint8_t p = press(c);
+        release(c);
+        return p;
+    }
+    return write(&c, 1);
 }
 
+// Packs the UTF-8 text into 6KRO reports, typing speed is bound by the host polling rate
+// The write error is set when a character could not be typed
 size_t USBHIDKeyboard::write(const uint8_t *buffer, size_t size) {
-    size_t n = 0;
-    while (size--) {
-        if (*buffer != '\r') {
-            if (write(*buffer)) {
-              n++;
-            } else {
-              break;
-            }
-        }
-        buffer++;
+    auto send = [this](const KeyReport& keys) { return sendPacked(keys); };
+
+    // The first packed report replaces whatever press() left held
+    memset(&_keyReport, 0, sizeof(_keyReport));
+    bool complete = true;
+    size_t n = codepoints::typeText(buffer, size, _asciimap, _unicodeInput, send, &complete);
+    if (!complete) {
+        setWriteError();
     }
     return n;
 }
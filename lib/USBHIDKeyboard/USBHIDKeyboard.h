@@ -22,6 +22,8 @@
 #pragma once
 #include "Print.h"
 #include "USBHID.h"
+#include "KeyReportPacker.h"
+#include "KeyboardCodepoints.h"
 #if CONFIG_TINYUSB_HID_ENABLED
 
 #include "esp_event.h"
@@ -140,16 +142,20 @@ private:
     USBHID hid;
     KeyReport _keyReport;
     const uint8_t *_asciimap;
+    codepoints::UnicodeInput _unicodeInput = codepoints::UnicodeInput::Off;
+    bool sendPacked(const KeyReport& keys);
 public:
     USBHIDKeyboard(void);
     void begin(const uint8_t *layout = KeyboardLayout_en_US); //void begin(void);
+    void setLayout(const uint8_t *layout) { _asciimap = layout; }
+    void setUnicodeInput(codepoints::UnicodeInput input) { _unicodeInput = input; } // for chars missing from the layout
     void end(void);
     size_t write(uint8_t k);
     size_t write(const uint8_t *buffer, size_t size);
     size_t press(uint8_t k);
     size_t release(uint8_t k);
     void releaseAll(void);
-    void sendReport(KeyReport* keys);
+    bool sendReport(KeyReport* keys);
 
     //raw functions work with TinyUSB's HID_KEY_* macros
     size_t pressRaw(uint8_t k);
@@ -35,9 +35,8 @@ ActionEnum EntryController::actionFieldSelected(Field field) {
 
 Entry EntryController::handleEntrySelection() {
     auto entries = entryService.getAllEntries();
-    std::reverse(entries.begin(), entries.end()); // last created in first
-    auto labels = modelTransformer.toStrings(entries);
-    auto selectedIndex = verticalSelector.select(entryService.getVaultName(), labels, true, true);
+    EntryListSource source(entries); // last created in first
+    auto selectedIndex = verticalSelector.select(entryService.getVaultName(), source, true, true);
 
     if (selectedIndex == -1) {
         return entryService.getEmptyEntry();
@@ -48,8 +47,10 @@ Entry EntryController::handleEntrySelection() {
 
 Field EntryController::handleFieldSelection(Entry& selectedEntry) {
     auto fieldValues = modelTransformer.toStrings(selectedEntry);
-    std::vector<std::string> fieldLabels = {"User", "Pass", "Note"};
-    std::vector<std::string> shortcuts = {"U", "P", "N"};
+    auto autoType = selectedEntry.getAutoType();
+    fieldValues.push_back(autoType.empty() ? AutoTypeTransformer::DEFAULT_PATTERN : autoType);
+    std::vector<std::string> fieldLabels = {"User", "Pass", "Note", "Auto"};
+    std::vector<std::string> shortcuts = {"U", "P", "N", "A"};
     auto selectedIndex = verticalSelector.select(selectedEntry.getServiceName(), fieldValues, true, false, fieldLabels, shortcuts, true);
 
     if (selectedIndex == -1) {
@@ -70,7 +71,7 @@ bool EntryController::handleEntryCreation() {
     }
 
     auto servicerName = stringPromptSelector.select("Create a new Entry", "Enter service name", "", true, false, true);
-    if (servicerName.empty()) {
+    if (!servicerName) {
         return false;
     }
 
@@ -87,14 +88,25 @@ bool EntryController::handleEntryCreation() {
 
     auto randomPassword = cryptoService.generateRandomString(20);
     auto username = stringPromptSelector.select("Username or Email", "Enter username", lastUsername, false, true, false, 3, true);
+    if (!username) {
+        return false; // locked
+    }
     display.subMessage("Loading...", 300); // avoid rendering too fast after OK input
     auto password = stringPromptSelector.select("Account Password", "Enter password", randomPassword, false, true, false, 3, true);
+    if (!password) {
+        return false;
+    }
     auto notes = stringPromptSelector.select("Notes (Optionnal)", "Enter notes (OK to pass)", "", false, true, false, 0);
-    notes = notes.empty() ? "No notes" : notes;
+    if (!notes) {
+        return false;
+    }
+    if (notes->empty()) {
+        notes = "No notes";
+    }
 
-    auto entry = Entry(servicerName, username, password, notes);
+    auto entry = Entry(*servicerName, *username, *password, *notes);
     entryService.addEntry(entry);
-    globalState.setLastUsedUsername(username);
+    globalState.setLastUsedUsername(*username);
     display.topBar("Password added", false, false);
     display.subMessage("Successfully created", 1000);
     return true;
@@ -102,11 +114,11 @@ bool EntryController::handleEntryCreation() {
 
 bool EntryController::handleEntryUpdate(Entry& entry, Field& field) {
     auto value = stringPromptSelector.select(field.getLabel(), "Modify the value", field.getValue(), false, true);
-    if (value == field.getValue()) {
-        return false;
+    if (!value || *value == field.getValue()) {
+        return false; // locked or unchanged
     }
 
-    field.setValue(value);
+    field.setValue(*value);
     entryService.updateField(entry, field);
     display.subMessage("Field updated", 500);
     if (field.getLabel() == "User") {
@@ -122,13 +134,12 @@ bool EntryController::handleEntryDeletion() {
 
     while (selectedIndex != 1) {
         auto entries = entryService.getAllEntries();
-        std::reverse(entries.begin(), entries.end()); // last created in first
-        auto labels = modelTransformer.toStrings(entries);
-        std::vector<std::string> delLabels(labels.size(), "Del");
-        auto selectedIndex = verticalSelector.select("Select to remove", labels, true, true, delLabels);
+        EntryListSource source(entries); // last created in first
+        std::vector<std::string> delLabels(entries.size(), "Del");
+        auto selectedIndex = verticalSelector.select("Select to remove", source, true, true, delLabels);
         if (selectedIndex == -1) {break;}
         delay(200); // debounce in case of double input
-        auto confirmation = confirmationSelector.select("Erase Password", "Delete " + labels[selectedIndex] + " ?");
+        auto confirmation = confirmationSelector.select("Erase Password", "Delete " + entries[selectedIndex].getServiceName() + " ?");
         if (confirmation) {
             entryService.deleteEntry(entries[selectedIndex]);
             entryUpdated = true;
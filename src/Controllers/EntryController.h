@@ -16,7 +16,9 @@
 #include <Enums/IconEnum.h>
 #include <Models/Entry.h>
 #include <Models/Field.h>
+#include <Lists/EntryListSource.h>
 #include <Transformers/ModelTransformer.h>
+#include <Transformers/AutoTypeTransformer.h>
 #include <States/GlobalState.h>
 #include <vector>
 #include <string>
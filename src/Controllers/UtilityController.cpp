@@ -1,4 +1,5 @@
 #include "UtilityController.h"
+#include <algorithm>
 
 UtilityController::UtilityController(IView& display,
                                      IInput& input,
@@ -12,7 +13,11 @@ UtilityController::UtilityController(IView& display,
                                      LedService& ledService,
                                      NvsService& nvsService,
                                      SdService& sdService,
-                                     TimeTransformer& timeTransformer)
+                                     TypingService& typingService,
+                                     QrService& qrService,
+                                     TimeTransformer& timeTransformer,
+                                     AutoTypeTransformer& autoTypeTransformer,
+                                     BleConnectionManager& bleConnectionManager)
     : display(display),
       input(input),
       usbService(usbService),
@@ -20,7 +25,11 @@ UtilityController::UtilityController(IView& display,
       ledService(ledService),
       nvsService(nvsService),
       sdService(sdService),
+      typingService(typingService),
+      qrService(qrService),
       timeTransformer(timeTransformer),
+      autoTypeTransformer(autoTypeTransformer),
+      bleConnectionManager(bleConnectionManager),
       horizontalSelector(horizontalSelector),
       verticalSelector(verticalSelector),
       fieldEditorSelector(fieldEditorSelector),
@@ -35,38 +44,114 @@ void UtilityController::handleWelcome() {
 }
 
 bool UtilityController::handleSendKeystrokes(const std::string& sendString) {
-    ledService.showLed();
-    bool sent = false;
+    // Already connected in the background, nothing to wait for
+    bool useBle = globalState.getBleKeyboardEnabled() && bleConnectionManager.ready();
+    if (!typingService.start(sendString, useBle)) {
+        return false;
+    }
 
-    if (globalState.getBleKeyboardEnabled()) {
-        bleService.setLayout(KeyboardLayoutMapper::toLayout(globalState.getSelectedKeyboardLayout()));
-        bleService.setDeviceName(globalState.getBleDeviceName());
-        bleService.begin();
-        display.subMessage("Sent keystrokes (BLE)", 0);
-        bleService.sendString(sendString);
-        sent = bleService.isReady();
+    std::string label = useBle ? "Typing (BLE)" : globalState.getBleKeyboardEnabled() ? "No BLE host, USB" : "Typing (USB)";
+    bool sent = followTyping(label);
+    if (typingService.isPartial()) {
+        display.subMessage("Some keys not typed", 2000);
+    } else {
+        display.subMessage(sent ? "Keystrokes sent" : "Typing stopped", 500);
     }
+    return sent;
+}
+
+// The job types in the background, keys stay live to pause or cancel it
+bool UtilityController::followTyping(const std::string& label) {
+    ledService.showLed();
+    int shownProgress = -1;
+    bool shownPaused = false;
+
+    while (typingService.isBusy()) {
+        if (globalState.getVaultIsLocked()) {
+            typingService.cancel();
+        }
+        switch (input.handler()) {
+            case KEY_LOCK:
+            case KEY_ESC_CUSTOM:
+            case KEY_ARROW_LEFT:
+                typingService.cancel();
+                break;
+            case KEY_OK:
+            case ' ':
+                typingService.isPaused() ? typingService.resume() : typingService.pause();
+                break;
+        }
 
-    if (!sent) {
-        display.subMessage("Sent keystrokes (USB)", 0);
-        usbService.sendString(sendString);
-        sent = usbService.isReady();
+        int progress = typingService.getProgress();
+        bool paused = typingService.isPaused();
+        if (progress != shownProgress || paused != shownPaused) {
+            display.progress(paused ? "Paused" : label, progress, paused ? "OK resume   ESC cancel" : "OK pause   ESC cancel");
+            shownProgress = progress;
+            shownPaused = paused;
+        }
+        delay(10);
     }
 
     ledService.clearLed();
+    return typingService.isComplete();
+}
+
+bool UtilityController::handleShowQr(const Entry& entry, const Field& field) {
+    // otpauth:// seeds stored in a field are encoded as is, authenticator apps read them
+    const QrBitmap& bitmap = qrService.encode(entry.getServiceName() + "/" + field.getLabel(), field.getValue());
+    if (bitmap.empty()) {
+        display.subMessage("Too long for a QR code", 1500);
+        return false;
+    }
+
+    display.qrCode(field.getLabel(), bitmap);
+    uint32_t shownMs = millis();
+    while (millis() - shownMs < QR_TIMEOUT_MS && !globalState.getVaultIsLocked()) {
+        uint32_t remainingMs = QR_TIMEOUT_MS - (millis() - shownMs);
+        if (input.waitKey(std::min(remainingMs, globalState.getKeyWaitTimeout())) != KEY_NONE) {
+            break;
+        }
+    }
+    return true;
+}
+
+bool UtilityController::handleAutoType(const Entry& entry) {
+    std::string pattern = entry.getAutoType().empty() ? AutoTypeTransformer::DEFAULT_PATTERN : entry.getAutoType();
+    if (pattern != autoTypePattern) {
+        autoTypeProgram = autoTypeTransformer.toProgram(pattern);
+        autoTypePattern = pattern;
+    }
+    if (!autoTypeProgram.valid()) {
+        display.subMessage(autoTypeProgram.error, 2000);
+        return false;
+    }
+
+    bool useBle = globalState.getBleKeyboardEnabled() && bleConnectionManager.ready();
+    if (!useBle && !usbService.isReady()) {
+        display.subMessage(globalState.getBleKeyboardEnabled() ? "No BLE host or USB" : "USB not connected", 1500);
+        return false;
+    }
+
+    // Typed like any other field, keys and delays run in the same background job
+    const std::string* fields[] = {&entry.getUsername(), &entry.getPassword(), &entry.getNotes(), &entry.getLink()};
+    if (!typingService.start(autoTypeProgram, fields, useBle)) {
+        return false;
+    }
+
+    bool sent = followTyping(useBle ? "Auto-typing (BLE)" : "Auto-typing (USB)");
+    if (typingService.isPartial()) {
+        display.subMessage("Some keys not typed", 2000);
+    } else {
+        display.subMessage(sent ? "Auto-type sent" : "Auto-type stopped", 500);
+    }
     return sent;
 }
 
 bool UtilityController::handleKeyboardInitialization() {
     auto selectedKeyboardLayout = globalState.getSelectedKeyboardLayout();
     const uint8_t* finalLayout = KeyboardLayoutMapper::toLayout(selectedKeyboardLayout);
-    auto nvsKeyboardLayoutField = globalState.getNvsKeyboardLayout();
     int selectedIndex;
 
-    if (selectedKeyboardLayout.empty()) {
-        selectedKeyboardLayout = nvsService.getString(nvsKeyboardLayoutField);
-    }
-
     if (selectedKeyboardLayout.empty()) {
         auto layouts = KeyboardLayoutMapper::getAllLayoutNames();
         selectedIndex = horizontalSelector.select("Choose Keyboard", layouts, "Region Layout", "Press OK to select");
@@ -74,35 +159,66 @@ bool UtilityController::handleKeyboardInitialization() {
             return false;
         }
         selectedKeyboardLayout = layouts[selectedIndex];
-        nvsService.saveString(nvsKeyboardLayoutField, selectedKeyboardLayout);
         globalState.setSelectedKeyboardLayout(selectedKeyboardLayout);
+        saveSettings(currentSettings());
         finalLayout = KeyboardLayoutMapper::toLayout(selectedKeyboardLayout);
+        bleConnectionManager.useLayout(selectedKeyboardLayout);
     }
     usbService.setLayout(finalLayout);
+    return true;
+}
+
+void UtilityController::handleKeyboardStartup() {
+    // Enumeration and BLE reconnection run during the welcome screen
+    usbService.setLayout(KeyboardLayoutMapper::toLayout(globalState.getSelectedKeyboardLayout()));
+    usbService.setUnicodeInput(UnicodeInputMapper::toInput(globalState.getSelectedUnicodeInput()));
     usbService.begin();
-    if (globalState.getBleKeyboardEnabled()) {
-        bleService.setLayout(finalLayout);
-        bleService.setDeviceName(globalState.getBleDeviceName());
-        bleService.begin();
-    } else {
-        bleService.end();
+    bleConnectionManager.start();
+}
+
+void UtilityController::handleLoadNvs() {
+    // One read, the string keys are only read once to migrate them
+    Settings settings;
+    if (!readSettings(settings)) {
+        migrateSettings();
+        settings = currentSettings();
+        saveSettings(settings);
+    }
+    applySettings(settings);
+
+    display.setBrightness(globalState.getSelectedScreenBrightness());
+    bleService.setDeviceName(globalState.getBleDeviceName());
+}
+
+bool UtilityController::readSettings(Settings& settings) {
+    Settings stored;
+    if (nvsService.getBytes(globalState.getNvsSettings(), &stored, sizeof(stored)) != sizeof(stored)) {
+        return false;
     }
+    if (stored.version != Settings::CURRENT_VERSION) {
+        return false; // no older blob yet, a future version upgrades here
+    }
+    settings = stored;
     return true;
 }
 
-void UtilityController::handleLoadNvs() {
+void UtilityController::migrateSettings() {
     // Keyboard layout
     std::string savedLayout = nvsService.getString(globalState.getNvsKeyboardLayout());
     if (!savedLayout.empty()) {
         globalState.setSelectedKeyboardLayout(savedLayout);
     }
 
+    // Unicode input method
+    std::string savedUnicodeInput = nvsService.getString(globalState.getNvsUnicodeInput());
+    if (!savedUnicodeInput.empty()) {
+        globalState.setSelectedUnicodeInput(savedUnicodeInput);
+    }
+
     // Brightness
     std::string savedBrightness = nvsService.getString(globalState.getNvsScreenBrightness());
     if (!savedBrightness.empty()) {
-        uint8_t brightness = std::stoi(savedBrightness);
-        globalState.setSelectedScreenBrightness(brightness);
-        display.setBrightness(brightness);
+        globalState.setSelectedScreenBrightness(std::stoi(savedBrightness));
     }
 
     // Screen off
@@ -134,97 +250,187 @@ void UtilityController::handleLoadNvs() {
     if (!savedBleDeviceName.empty()) {
         globalState.setBleDeviceName(savedBleDeviceName);
     }
-    bleService.setDeviceName(globalState.getBleDeviceName());
+
+    // The blob replaces them
+    for (auto key : {globalState.getNvsKeyboardLayout(), globalState.getNvsUnicodeInput(), globalState.getNvsScreenBrightness(),
+                     globalState.getNvsInactivityScreenTimeout(), globalState.getNvsInactivityLockTimeout(),
+                     globalState.getNvsBleEnabled(), globalState.getNvsBleDeviceName()}) {
+        nvsService.remove(key);
+    }
+}
+
+Settings UtilityController::currentSettings() const {
+    Settings settings;
+    settings.screenBrightness = globalState.getSelectedScreenBrightness();
+    settings.bleEnabled = globalState.getBleKeyboardEnabled() ? 1 : 0;
+    settings.screenTimeoutMs = globalState.getInactivityScreenTimeout();
+    settings.lockTimeoutMs = globalState.getInactivityLockTimeout();
+    Settings::copy(settings.keyboardLayout, sizeof(settings.keyboardLayout), globalState.getSelectedKeyboardLayout());
+    Settings::copy(settings.unicodeInput, sizeof(settings.unicodeInput), globalState.getSelectedUnicodeInput());
+    Settings::copy(settings.bleDeviceName, sizeof(settings.bleDeviceName), globalState.getBleDeviceName());
+    return settings;
+}
+
+void UtilityController::applySettings(const Settings& settings) {
+    globalState.setSelectedKeyboardLayout(settings.keyboardLayout);
+    globalState.setSelectedUnicodeInput(settings.unicodeInput);
+    globalState.setSelectedScreenBrightness(settings.screenBrightness);
+    globalState.setBleKeyboardEnabled(settings.bleEnabled != 0);
+    if (settings.screenTimeoutMs > 0) {
+        globalState.setInactivityScreenTimeout(settings.screenTimeoutMs);
+    }
+    if (settings.lockTimeoutMs > 0) {
+        globalState.setInactivityLockTimeout(settings.lockTimeoutMs);
+    }
+    if (settings.bleDeviceName[0] != '\0') {
+        globalState.setBleDeviceName(settings.bleDeviceName);
+    }
+}
+
+void UtilityController::saveSettings(const Settings& settings) {
+    nvsService.saveBytes(globalState.getNvsSettings(), &settings, sizeof(settings));
 }
 
 bool UtilityController::handleGeneralSettings() {
     std::vector<std::string> timeLabels = timeTransformer.getAllTimeLabels();
     std::vector<uint32_t> timeValues = timeTransformer.getAllTimeValues();
     std::vector<std::string> brightnessValues = {"20", "60", "100", "140", "160", "200", "240"};
-    std::vector<std::string> settingLabels = {" Keyboard ", "Brightness", "Screen off", "Vault lock", " BLE ", "BLE name", "Clear BLE"};
+    std::vector<std::string> bleSpeeds = {"Fast", "Normal", "Slow"};
+    std::vector<uint32_t> bleSpeedDelays = {0, 8, 20};
+    std::vector<std::string> settingLabels = {" Keyboard ", "Unicode", "Brightness", "Screen off", "Vault lock", " BLE ", "BLE name", "BLE speed", "Clear BLE"};
     
     auto layouts = KeyboardLayoutMapper::getAllLayoutNames();
+    auto unicodeInputs = UnicodeInputMapper::getAllInputNames();
     auto selectedLayout = globalState.getSelectedKeyboardLayout().empty() ? layouts[2] : globalState.getSelectedKeyboardLayout();
     auto selectedScreenOffTime = timeTransformer.toLabel(globalState.getInactivityScreenTimeout());
     auto selectedLockCloseTime = timeTransformer.toLabel(globalState.getInactivityLockTimeout());
+    auto selectedBleSpeed = bleSpeeds[0];
+    for (size_t i = 0; i < bleSpeedDelays.size(); ++i) {
+        if (bleSpeedDelays[i] == bleConnectionManager.getTypingDelay()) {
+            selectedBleSpeed = bleSpeeds[i];
+        }
+    }
     std::vector<std::string> settings = {
         selectedLayout,
+        globalState.getSelectedUnicodeInput(),
         std::to_string(globalState.getSelectedScreenBrightness()),
         selectedScreenOffTime, 
         selectedLockCloseTime + " ", // hack to prevent same values
         globalState.getBleKeyboardEnabled() ? "On" : "Off",
         globalState.getBleDeviceName(),
+        selectedBleSpeed,
         "Reset"
     };
 
+    // Changes are written once, when leaving the screen
+    Settings savedSettings = currentSettings();
+
     while (true) {
         auto verticalIndex = verticalSelector.select("Settings", settings, true, false, settingLabels, {});
-        size_t selectedIndex;
-        if (verticalIndex == -1) {
-            return false;
+        int selectedIndex;
+        if (verticalIndex == -1 || globalState.getVaultIsLocked()) {
+            break;
         }
 
         auto selectedSetting =  settingLabels[verticalIndex];
 
         if (selectedSetting == " Keyboard ") {
             selectedIndex = horizontalSelector.select("Choose Keyboard", layouts, "Region Layout", "Press OK to select", {}, false);
+            if (selectedIndex < 0 || globalState.getVaultIsLocked()) {
+                break; // the lock fired while picking
+            }
             globalState.setSelectedKeyboardLayout(layouts[selectedIndex]);
-            nvsService.saveString(globalState.getNvsKeyboardLayout(), layouts[selectedIndex]);
+            usbService.setLayout(KeyboardLayoutMapper::toLayout(layouts[selectedIndex]));
+            bleConnectionManager.useLayout(layouts[selectedIndex]); // connected host keeps it
             settings[verticalIndex] = layouts[selectedIndex];
 
+        } else if (selectedSetting == "Unicode") {
+            selectedIndex = horizontalSelector.select("Unicode Input", unicodeInputs, "For chars not on layout", "Press OK to select", {}, false);
+            if (selectedIndex < 0 || globalState.getVaultIsLocked()) {
+                break; // the lock fired while picking
+            }
+            globalState.setSelectedUnicodeInput(unicodeInputs[selectedIndex]);
+            usbService.setUnicodeInput(UnicodeInputMapper::toInput(unicodeInputs[selectedIndex]));
+            bleConnectionManager.useUnicodeInput(unicodeInputs[selectedIndex]); // connected host keeps it
+            settings[verticalIndex] = unicodeInputs[selectedIndex];
+
         } else if (selectedSetting == "Brightness") {
             selectedIndex = horizontalSelector.select("Screen Brightness", brightnessValues, "Choose brightness", "Press OK to select", {}, false);
+            if (selectedIndex < 0 || globalState.getVaultIsLocked()) {
+                break; // the lock fired while picking
+            }
             uint8_t brightness = std::stoi(brightnessValues[selectedIndex]);
             globalState.setSelectedScreenBrightness(brightness);
-            nvsService.saveString(globalState.getNvsScreenBrightness(), brightnessValues[selectedIndex]);
             display.setBrightness(brightness);
             settings[verticalIndex] = brightnessValues[selectedIndex];
 
         } else if (selectedSetting == "Screen off")  {
             selectedIndex = horizontalSelector.select("Screen Off", timeLabels, "Turn off inactivity", "Press OK to select", {}, false);
+            if (selectedIndex < 0 || globalState.getVaultIsLocked()) {
+                break; // the lock fired while picking
+            }
             globalState.setInactivityScreenTimeout(timeValues[selectedIndex]);
-            nvsService.saveString(globalState.getNvsInactivityScreenTimeout(), timeLabels[selectedIndex]);
             settings[verticalIndex] = timeLabels[selectedIndex] + "  "; // hack to avoid same values in the vector
 
         } else if (selectedSetting == "Vault lock") {
             selectedIndex = horizontalSelector.select("Vault Lock", timeLabels, "Lock vault inactivity", "Press OK to select", {}, false);
+            if (selectedIndex < 0 || globalState.getVaultIsLocked()) {
+                break; // the lock fired while picking
+            }
             globalState.setInactivityLockTimeout(timeValues[selectedIndex]);
-            nvsService.saveString(globalState.getNvsInactivityLockTimeout(), timeLabels[selectedIndex]);
             settings[verticalIndex] = timeLabels[selectedIndex] + " ";
         } else if (selectedSetting == " BLE ") {
             std::vector<std::string> options = {"On", "Off"};
             selectedIndex = horizontalSelector.select("BLE Keyboard", options, "Enable BLE keyboard", "Press OK to select", {}, false);
+            if (selectedIndex < 0 || globalState.getVaultIsLocked()) {
+                break; // the lock fired while picking
+            }
             bool enableBle = options[selectedIndex] == "On";
             globalState.setBleKeyboardEnabled(enableBle);
-            nvsService.saveString(globalState.getNvsBleEnabled(), enableBle ? "1" : "0");
             settings[verticalIndex] = options[selectedIndex];
-            const uint8_t* layoutPtr = KeyboardLayoutMapper::toLayout(globalState.getSelectedKeyboardLayout());
-            bleService.setLayout(layoutPtr);
-            bleService.setDeviceName(globalState.getBleDeviceName());
-            if (enableBle) {
-                bleService.begin();
-            } else {
-                bleService.end();
-            }
+            bleConnectionManager.start(); // stops when disabled
         } else if (selectedSetting == "BLE name") {
             auto newName = stringPromptSelector.select("BLE Name", "Device name", globalState.getBleDeviceName(), false, true, false, 0, false);
-            if (!newName.empty() && newName != globalState.getBleDeviceName()) {
-                globalState.setBleDeviceName(newName);
-                nvsService.saveString(globalState.getNvsBleDeviceName(), newName);
-                bleService.setDeviceName(newName);
-                settings[verticalIndex] = newName;
+            if (!newName) {
+                break; // the lock fired while typing
+            }
+            if (!newName->empty() && *newName != globalState.getBleDeviceName()) {
+                globalState.setBleDeviceName(*newName);
+                bleService.setDeviceName(*newName);
+                settings[verticalIndex] = *newName;
+            }
+        } else if (selectedSetting == "BLE speed") {
+            selectedIndex = horizontalSelector.select("BLE Speed", bleSpeeds, "Typing speed for this host", "Press OK to select", {}, false);
+            if (selectedIndex < 0 || globalState.getVaultIsLocked()) {
+                break; // the lock fired while picking
+            }
+            if (bleConnectionManager.setTypingDelay(bleSpeedDelays[selectedIndex])) {
+                settings[verticalIndex] = bleSpeeds[selectedIndex];
+            } else {
+                display.subMessage("No BLE host connected", 1500);
             }
         } else if (selectedSetting == "Clear BLE") {
             auto confirm = confirmationSelector.select("Clear BLE Bonds", "Remove paired devices?");
             if (confirm) {
-                bleService.clearBonds();
+                bleConnectionManager.forgetHosts();
                 settings[verticalIndex] = "Reset";
             }
         }
     }
+
+    Settings changedSettings = currentSettings();
+    if (changedSettings != savedSettings) {
+        saveSettings(changedSettings);
+    }
+    return false;
 }
 
 void UtilityController::handleInactivity() {
+    // Screen off and secrets wiped from the UI task, the lock timer only flags it
+    display.fadeBrightness(1, display.getBrightness() * 5);
+    globalState.wipeLoadedVaultPassword();
+    qrService.wipe();
+    display.wipeTextCache();
     ledService.showLed();
     input.waitPress();
     ledService.clearLed();
@@ -234,6 +440,6 @@ void UtilityController::handleInactivity() {
         display.subMessage("Vault has been locked", 3000);
         globalState.setLoadedVaultPath("");
         globalState.setLoadedVaultPassword("");
-        globalState.setVaultIsLocked(false);
     }
+    globalState.setVaultIsLocked(false);
 }
@@ -6,16 +6,23 @@
 #include <Services/LedService.h>
 #include <Services/NvsService.h>
 #include <Services/SdService.h>
+#include <Services/TypingService.h>
+#include <Services/QrService.h>
+#include <Managers/BleConnectionManager.h>
 #include <Selectors/HorizontalSelector.h>
 #include <Selectors/VerticalSelector.h>
 #include <Selectors/FieldEditorSelector.h>
 #include <Selectors/StringPromptSelector.h>
 #include <Selectors/ConfirmationSelector.h>
 #include <Transformers/TimeTransformer.h>
+#include <Transformers/AutoTypeTransformer.h>
+#include <Models/Entry.h>
+#include <Models/Settings.h>
 #include <Views/IView.h>
 #include <Inputs/IInput.h>
 #include <Enums/ActionEnum.h>
 #include <Enums/KeyboardLayoutEnum.h>
+#include <Enums/UnicodeInputEnum.h>
 #include <vector>
 #include <string>
 
@@ -33,17 +40,26 @@ public:
                     LedService& ledService,
                     NvsService& nvsService,
                     SdService& sdService,
-                    TimeTransformer& timeTransformer);
+                    TypingService& typingService,
+                    QrService& qrService,
+                    TimeTransformer& timeTransformer,
+                    AutoTypeTransformer& autoTypeTransformer,
+                    BleConnectionManager& bleConnectionManager);
 
 
     bool handleSendKeystrokes(const std::string& sendString);
+    bool handleShowQr(const Entry& entry, const Field& field);
+    bool handleAutoType(const Entry& entry);
     bool handleKeyboardInitialization();
+    void handleKeyboardStartup();
     bool handleGeneralSettings();
     void handleLoadNvs();
     void handleWelcome();
     void handleInactivity();
 
 private:
+    static const uint32_t QR_TIMEOUT_MS = 30000; // the secret leaves the screen on its own
+
     IView& display;
     IInput& input;
     UsbService& usbService;
@@ -51,8 +67,16 @@ private:
     LedService& ledService;
     NvsService& nvsService;
     SdService& sdService;
+    TypingService& typingService;
+    QrService& qrService;
 
     TimeTransformer& timeTransformer;
+    AutoTypeTransformer& autoTypeTransformer;
+    BleConnectionManager& bleConnectionManager;
+
+    // Last compiled template, typing the same entry again skips the compilation
+    std::string autoTypePattern;
+    AutoTypeProgram autoTypeProgram;
 
     HorizontalSelector& horizontalSelector;
     VerticalSelector& verticalSelector;
@@ -61,6 +85,15 @@ private:
     ConfirmationSelector& confirmationSelector;
     
     GlobalState& globalState = GlobalState::getInstance();
+
+    bool followTyping(const std::string& label);
+
+    // Settings blob
+    bool readSettings(Settings& settings);
+    void migrateSettings();
+    Settings currentSettings() const;
+    void applySettings(const Settings& settings);
+    void saveSettings(const Settings& settings);
 };
 
 #endif // UTILITY_CONTROLLER_H
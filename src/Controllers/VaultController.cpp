@@ -29,10 +29,9 @@ VaultController::VaultController(IView& display,
 
 ActionEnum VaultController::actionNoVault() {
     std::vector<ActionEnum> availableActions = {ActionEnum::OpenVault, ActionEnum::CreateVault, ActionEnum::UpdateSettings};
-    auto actionIcons = {IconEnum::LoadVault, IconEnum::CreateVault, IconEnum::Settings};
+    std::vector<IconEnum> actionIcons = {IconEnum::LoadVault, IconEnum::CreateVault, IconEnum::Settings};
     auto labels = ActionEnumMapper::getActionNames(availableActions);
-    auto  iconNames = IconEnumMapper::getIconNames(actionIcons);
-    auto selectedIndex = horizontalSelector.select("", labels, "", "", iconNames);
+    auto selectedIndex = horizontalSelector.select("", labels, "", "", actionIcons);
 
     if (selectedIndex != -1) {
         return availableActions[selectedIndex];
@@ -43,13 +42,12 @@ ActionEnum VaultController::actionNoVault() {
 
 ActionEnum VaultController::actionVaultSelected() {
     std::vector<ActionEnum> availableActions = {ActionEnum::SelectEntry, ActionEnum::CreateEntry, ActionEnum::DeleteEntry};
-    auto actionIcons = {IconEnum::SelectEntry, IconEnum::AddEntry, IconEnum::DeleteEntry};
+    std::vector<IconEnum> actionIcons = {IconEnum::SelectEntry, IconEnum::AddEntry, IconEnum::DeleteEntry};
     auto labels = ActionEnumMapper::getActionNames(availableActions);
-    auto iconNames = IconEnumMapper::getIconNames(actionIcons);
 
     auto confirmation = false;
     while (!confirmation) {
-        auto selectedIndex = horizontalSelector.select("", labels, "", "", iconNames);
+        auto selectedIndex = horizontalSelector.select("", labels, "", "", actionIcons);
         if (selectedIndex != -1) {
             return availableActions[selectedIndex];
         }
@@ -76,12 +74,12 @@ bool VaultController::handleVaultCreation() {
 
     // Get a vault name
     auto vaultName = stringPromptSelector.select("Create a new vault", "Enter the vault name", "", true, false, true);
-    if (vaultName.empty()) {
-        return false; // back button hits
+    if (!vaultName) {
+        return false; // back button hits or locked
     }
 
     // Verify if a vault file with this name exists
-    auto vaultPath = globalState.getDefaultVaultPath() + "/" + vaultName + ".vault";
+    auto vaultPath = globalState.getDefaultVaultPath() + "/" + *vaultName + ".vault";
     if (sdService.isFile(vaultPath)) {
         auto confirmation = confirmationSelector.select("Vault already exists", "Erase the vault ?");
         if (!confirmation) {
@@ -90,13 +88,15 @@ bool VaultController::handleVaultCreation() {
     }
 
     // Get the password
-    std::string pass1 = "";
-    std::string pass2 = "";
+    std::optional<std::string> pass1;
+    std::optional<std::string> pass2;
     do {
         pass1 = stringPromptSelector.select("Vault Password", "Enter master password", "", false, true);
+        if (!pass1) {return false;} // locked, nothing written yet
         pass2 = stringPromptSelector.select("Repeat Password", "Repeat master password", "", false, true);
-        if (pass1 != pass2) {display.subMessage("Do not match", 2000);}
-    } while (pass1 != pass2);
+        if (!pass2) {return false;}
+        if (*pass1 != *pass2) {display.subMessage("Do not match", 2000);}
+    } while (*pass1 != *pass2);
     
 
     // Encrypt empty json struct
@@ -104,14 +104,14 @@ bool VaultController::handleVaultCreation() {
     auto salt = cryptoService.generateSalt(globalState.getSaltSize());
     auto jsonEmpty = jsonTransformer.emptyJsonStructure();
     auto checksum = cryptoService.generateChecksum(jsonEmpty, globalState.getChecksumSize());
-    auto jsonEncrypted = cryptoService.encryptWithPassphrase(jsonEmpty, pass1, salt);
+    auto jsonEncrypted = cryptoService.encryptWithPassphrase(jsonEmpty, *pass1, salt);
 
     // Create VaultFile to handle data
     VaultFile vault = VaultFile(vaultPath, {});
     vault.setSalt(salt);
     vault.setChecksum(checksum);
     vault.setEncryptedData(jsonEncrypted);
-    entryService.setContainerName(vaultName);
+    entryService.setContainerName(*vaultName);
 
     // Save to SD card
     sdService.begin();
@@ -125,7 +125,7 @@ bool VaultController::handleVaultCreation() {
     sdService.removeCachedPath(globalState.getDefaultVaultPath());
 
     // Update state
-    globalState.setLoadedVaultPassword(pass1);
+    globalState.setLoadedVaultPassword(*pass1);
     globalState.setLoadedVaultPath(vaultPath);
     return true;
 }
@@ -159,6 +159,7 @@ bool VaultController::handleVaultSave() {
     }
 
     // Get up to date data
+    PowerManager::Hold boost(PowerLock::CpuMax); // serialize and encrypt
     auto entries = entryService.getAllEntries();
     auto categories = categoryService.getAllCategories();
 
@@ -193,9 +194,8 @@ bool VaultController::handleVaultLoading() {
     std::vector<ActionEnum> availableActions = {ActionEnum::LoadSdVault};
     std::vector<IconEnum> actionIcons = {IconEnum::SdCard};
     auto actionLabels = ActionEnumMapper::getActionNames(availableActions);
-    auto iconNames = IconEnumMapper::getIconNames(actionIcons);
 
-    auto selectedIndex = horizontalSelector.select("", actionLabels, "", "", iconNames);
+    auto selectedIndex = horizontalSelector.select("", actionLabels, "", "", actionIcons);
     if (selectedIndex == -1) {
         return false;
     }
@@ -232,6 +232,9 @@ bool VaultController::loadSdVault() {
                 if (loadDataFromEncryptedFile(currentPath)) {
                     display.subMessage("Loaded successfully", 2000);
                     return true;
+                } else if (globalState.getVaultIsLocked()) {
+                    sdService.close();
+                    return false; // the lock left the password prompt
                 } else {
                     display.subMessage("Invalid Password", 2000);    
                 }
@@ -274,13 +277,17 @@ bool VaultController::loadDataFromEncryptedFile(std::string path) {
     auto vaultBinary = sdService.readBinaryFile(path);
     VaultFile vaultFile = VaultFile(path, vaultBinary);
     auto password = stringPromptSelector.select("Open encrypted vault", "Enter master password", "", false, true, false);
+    if (!password) {
+        return false; // locked
+    }
     display.subMessage("Loading...", 0);
+    PowerManager::Hold boost(PowerLock::CpuMax); // decrypt and JSON parsing
     auto salt = vaultFile.getSalt();
     auto savedChecksum = vaultFile.getChecksum();
     auto encryptedData = vaultFile.getEncryptedData();
     
     // Bad password
-    auto decryptedData = cryptoService.decryptWithPassphrase(encryptedData, password, salt);
+    auto decryptedData = cryptoService.decryptWithPassphrase(encryptedData, *password, salt);
     if (decryptedData.empty()) {
         return false;
     }
@@ -297,7 +304,7 @@ bool VaultController::loadDataFromEncryptedFile(std::string path) {
     entryService.setEntries(entries);
     entryService.setContainerName(vaultName);
     categoryService.setCategories(categories);
-    globalState.setLoadedVaultPassword(password);
+    globalState.setLoadedVaultPassword(*password);
     globalState.setLoadedVaultPath(path);
     auto parentDir = sdService.getParentDirectory(path);
     nvsService.saveString(globalState.getNvsLastUsedVaultPath(), parentDir);
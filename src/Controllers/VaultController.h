@@ -16,6 +16,7 @@
 #include "Transformers/JsonTransformer.h"
 #include "Transformers/ModelTransformer.h"
 #include "States/GlobalState.h"
+#include "Managers/PowerManager.h"
 #include "Models/VaultFile.h"
 
 class VaultController {
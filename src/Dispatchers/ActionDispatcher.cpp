@@ -8,6 +8,7 @@ ActionDispatcher::ActionDispatcher(DependencyProvider& provider)
 
 void ActionDispatcher::setup() {
     provider.getUtilityController().handleLoadNvs();
+    provider.getUtilityController().handleKeyboardStartup();
     provider.getUtilityController().handleWelcome();
 }
 
@@ -104,6 +105,11 @@ void ActionDispatcher::executeAction(ActionEnum action) {
             } else {
                 context = ContextEnum::FieldSelected;    
             }
+
+            // One keypress login, the field stays open to type it again or edit it
+            if (selectedField.getLabel() == "Auto") {
+                executeAction(ActionEnum::AutoType);
+            }
             break;
 
         case ActionEnum::UpdateField:
@@ -114,9 +120,21 @@ void ActionDispatcher::executeAction(ActionEnum action) {
             break;
         
         case ActionEnum::SendToUsb:
+            if (selectedField.getLabel() == "Auto") {
+                executeAction(ActionEnum::AutoType);
+                break;
+            }
             provider.getUtilityController().handleSendKeystrokes(selectedField.getValue());
             break;
 
+        case ActionEnum::AutoType:
+            provider.getUtilityController().handleAutoType(selectedEntry);
+            break;
+
+        case ActionEnum::ShowQr:
+            provider.getUtilityController().handleShowQr(selectedEntry, selectedField);
+            break;
+
         case ActionEnum::UpdateSettings:
             provider.getUtilityController().handleGeneralSettings();
             break;
@@ -25,6 +25,8 @@ enum class ActionEnum {
 
     // App-level actions
     SendToUsb,
+    AutoType,
+    ShowQr,
     ShowHelp,
     UpdateSettings
 };
@@ -45,6 +47,8 @@ public:
             {ActionEnum::SelectField, "Select Field"},
             {ActionEnum::UpdateField, "Update Field"},
             {ActionEnum::SendToUsb, "Send keystrokes"},
+            {ActionEnum::AutoType, "Auto-type"},
+            {ActionEnum::ShowQr, "Show QR"},
             {ActionEnum::ShowHelp, "Show Help"},
             {ActionEnum::UpdateSettings, "Settings"}
         };
@@ -0,0 +1,10 @@
+#ifndef BLE_STATUS_ENUM_H
+#define BLE_STATUS_ENUM_H
+
+enum class BleStatusEnum {
+    Off,
+    Advertising,
+    Connected,
+};
+
+#endif // BLE_STATUS_ENUM_H
@@ -0,0 +1,37 @@
+#ifndef UNICODE_INPUT_ENUM_H
+#define UNICODE_INPUT_ENUM_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <KeyboardCodepoints.h>
+
+// Host input method for the chars missing from the layout, see KeyboardCodepoints.h
+class UnicodeInputMapper {
+public:
+    inline static const std::vector<std::pair<std::string, codepoints::UnicodeInput>> inputs = {
+        {"None", codepoints::UnicodeInput::Off},
+        {"Linux", codepoints::UnicodeInput::Linux},
+        {"Windows", codepoints::UnicodeInput::Windows},
+        {"macOS", codepoints::UnicodeInput::MacOS},
+    };
+
+    static codepoints::UnicodeInput toInput(const std::string& name) {
+        for (const auto& input : inputs) {
+            if (input.first == name) {
+                return input.second;
+            }
+        }
+        return codepoints::UnicodeInput::Off;
+    }
+
+    static std::vector<std::string> getAllInputNames() {
+        std::vector<std::string> names;
+        for (const auto& input : inputs) {
+            names.push_back(input.first);
+        }
+        return names;
+    }
+};
+
+#endif // UNICODE_INPUT_ENUM_H
@@ -1,63 +1,274 @@
 #include "CardputerInput.h"
+#include <esp_sleep.h>
+#include <driver/gpio.h>
 
 namespace inputs {
 
+// Key matrix columns (the 74HC138 drives the rows) and the G0 button
+static const gpio_num_t wakePins[] = {
+    GPIO_NUM_13, GPIO_NUM_15, GPIO_NUM_3, GPIO_NUM_4, GPIO_NUM_5, GPIO_NUM_6, GPIO_NUM_7, GPIO_NUM_0
+};
+
+void CardputerInput::initialize() {
+    if (queue) {
+        return;
+    }
+
+    queue = xQueueCreate(queueLength, sizeof(KeyEvent));
+
+    // Same core as the UI loop, higher priority so a press is never stuck behind a redraw
+    xTaskCreatePinnedToCore(scanTask, "keyScan", 4096, this, 2, &scanTaskHandle, 1);
+}
 
 char CardputerInput::handler() {
+    KeyEvent event;
+
+    // Back to waiting, the UI is done with the previous key
+    notifyIdle(); // before the latency sample ends, a held frame may go out
+    latency.inputIdle();
+    latency.pollSerial();
+    unboost();
+
+    // Sleep until a key is posted, the timeout lets selectors run their inactivity checks
+    if (xQueueReceive(queue, &event, pdMS_TO_TICKS(globalState.getKeyWaitTimeout())) != pdTRUE) {
+        return KEY_NONE;
+    }
+
+    latency.keyHandled(event.timestampUs);
+    keyHandedOut = true;
+
+    // Full speed while the UI reacts, until it comes back for the next key
+    power.acquire(PowerLock::CpuMax);
+    boosted = true;
+
+    return event.key;
+}
+
+void CardputerInput::waitPress() {
+    KeyEvent event;
+    notifyIdle();
+    unboost();
+    xQueueReset(queue); // ignore keys pressed before the wait
+    do {
+        xQueueReceive(queue, &event, portMAX_DELAY);
+    } while (event.key == KEY_LOCK); // a lock event is not a press, the lock screen waits here
+    keyHandedOut = true;
+}
+
+char CardputerInput::waitKey(uint32_t timeoutMs) {
+    KeyEvent event;
+    notifyIdle();
+    unboost();
+    if (!queue) {
+        delay(timeoutMs); // scan task not started yet
+        return KEY_NONE;
+    }
+    if (xQueueReceive(queue, &event, pdMS_TO_TICKS(timeoutMs)) != pdTRUE) {
+        return KEY_NONE;
+    }
+    keyHandedOut = true;
+    return event.key;
+}
+
+void CardputerInput::postKey(char key) {
+    if (queue) {
+        post(key, false, micros());
+    }
+}
 
+void CardputerInput::setActivityListener(std::function<void()> listener) {
+    activityListener = listener;
+}
+
+void CardputerInput::setIdleListener(std::function<void(bool keyHandled)> listener) {
+    idleListener = listener;
+}
+
+// Every wait of the UI task, not only handler()
+void CardputerInput::notifyIdle() {
+    if (idleListener) {
+        idleListener(keyHandedOut);
+    }
+    keyHandedOut = false;
+}
+
+void CardputerInput::unboost() {
+    if (boosted) {
+        power.release(PowerLock::CpuMax);
+        boosted = false;
+    }
+}
+
+void CardputerInput::scanTask(void* param) {
+    auto self = static_cast<CardputerInput*>(param);
+    while (true) {
+        self->scan();
+        if (self->canLightSleep()) {
+            self->lightSleep();
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(self->globalState.getKeyScanInterval()));
+        }
+    }
+}
+
+void CardputerInput::scan() {
     // Update keyboard state
     M5Cardputer.update();
 
+    uint32_t nowUs = micros();
+    uint32_t nowMs = millis();
+    char key = readKey();
+
+    // First scan after a light sleep, a press seen now is timed from the wake
+    if (wokeUs != 0) {
+        pressAfterWake = key != KEY_NONE;
+        wakeAtUs = wokeUs;
+        wokeUs = 0;
+    }
+
+    // Debounce, the key must stay the same for the debounce time
+    if (key != candidateKey) {
+        candidateKey = key;
+        candidateSinceUs = nowUs;
+        return;
+    }
+    if (nowUs - candidateSinceUs < globalState.getKeyDebounceTime() * 1000) {
+        return;
+    }
+
+    // New press or release
+    if (candidateKey != heldKey) {
+        heldKey = candidateKey;
+        heldSinceUs = candidateSinceUs;
+        if (heldKey != KEY_NONE) {
+            if (activityListener) {
+                activityListener(); // before the post, the screen is lit when the UI gets the key
+            }
+            post(heldKey, false, heldSinceUs);
+            if (pressAfterWake) {
+                latency.wokeToKey(nowUs - wakeAtUs);
+                pressAfterWake = false;
+            }
+            repeatInterval = globalState.getKeyRepeatInterval();
+            nextRepeatMs = nowMs + globalState.getKeyRepeatDelay();
+        }
+        return;
+    }
+
+    // Held key, repeat faster and faster
+    if (heldKey != KEY_NONE && isRepeatable(heldKey) && (int32_t)(nowMs - nextRepeatMs) >= 0) {
+        // UI still busy with the previous key, don't pile up repeats that would overshoot on release
+        if (uxQueueMessagesWaiting(queue) > 0) {
+            return;
+        }
+        post(heldKey, true, nowUs);
+        uint32_t minInterval = globalState.getKeyRepeatMinInterval();
+        uint32_t step = globalState.getKeyRepeatAcceleration();
+        repeatInterval = repeatInterval > minInterval + step ? repeatInterval - step : minInterval;
+        nextRepeatMs = nowMs + repeatInterval;
+    }
+}
+
+char CardputerInput::readKey() {
     // Bouton GO
     if (M5Cardputer.BtnA.isPressed()) {
-        delay(150); // debounce
         return KEY_ESC_CUSTOM;
     }
-    
-    if (M5Cardputer.Keyboard.isChange()) {
 
-        if (M5Cardputer.Keyboard.isPressed()) {
-            Keyboard_Class::KeysState status = M5Cardputer.Keyboard.keysState();
+    if (!M5Cardputer.Keyboard.isPressed()) {
+        return KEY_NONE;
+    }
+
+    Keyboard_Class::KeysState status = M5Cardputer.Keyboard.keysState();
 
-            if (status.enter) { // go to next menu
-                return KEY_OK;
-            }
-            if (status.del) { 
-                return KEY_DEL;
-            }
-            
-            if(M5Cardputer.Keyboard.isKeyPressed(KEY_ARROW_LEFT)) { // go back to previous menu
-                return KEY_ARROW_LEFT;
-            }
+    if (status.enter) { // go to next menu
+        return KEY_OK;
+    }
 
-            if(M5Cardputer.Keyboard.isKeyPressed(KEY_ARROW_RIGHT)) { // go to next menu
-                return KEY_ARROW_RIGHT;
-            }
+    // Text cursor, ctrl + arrows by char (up/down for home/end), opt + arrows by word
+    if (status.ctrl) {
+        if (status.del) return KEY_DEL_FORWARD;
+        if (M5Cardputer.Keyboard.isKeyPressed(KEY_ARROW_LEFT)) return KEY_CURSOR_LEFT;
+        if (M5Cardputer.Keyboard.isKeyPressed(KEY_ARROW_RIGHT)) return KEY_CURSOR_RIGHT;
+        if (M5Cardputer.Keyboard.isKeyPressed(KEY_ARROW_UP)) return KEY_CURSOR_HOME;
+        if (M5Cardputer.Keyboard.isKeyPressed(KEY_ARROW_DOWN)) return KEY_CURSOR_END;
+    }
+    if (status.opt) {
+        if (M5Cardputer.Keyboard.isKeyPressed(KEY_ARROW_LEFT)) return KEY_WORD_LEFT;
+        if (M5Cardputer.Keyboard.isKeyPressed(KEY_ARROW_RIGHT)) return KEY_WORD_RIGHT;
+    }
+    if (status.del) {
+        return KEY_DEL;
+    }
 
-            for (auto c : status.word) {
-                // Issue with %, the only key that requires 2 inputs to display
-                if (c == '%') {
-                    return '5'; 
-                }
-                return c; // retourner le premier char saisi
-            }
+    if (M5Cardputer.Keyboard.isKeyPressed(KEY_ARROW_LEFT)) { // go back to previous menu
+        return KEY_ARROW_LEFT;
+    }
+
+    if (M5Cardputer.Keyboard.isKeyPressed(KEY_ARROW_RIGHT)) { // go to next menu
+        return KEY_ARROW_RIGHT;
+    }
+
+    for (auto c : status.word) {
+        // Issue with %, the only key that requires 2 inputs to display
+        if (c == '%') {
+            return '5';
         }
+        return c; // retourner le premier char saisi
     }
-    delay(10); // debounce
+
     return KEY_NONE;
 }
 
-void CardputerInput::waitPress() {
-  while(1){
-    M5Cardputer.update();
-    if (M5Cardputer.Keyboard.isChange()) {
-      if (M5Cardputer.Keyboard.isPressed()) {
-        Keyboard_Class::KeysState status = M5Cardputer.Keyboard.keysState();
-        return;
-      }
+bool CardputerInput::canLightSleep() {
+    // The backlight PWM, USB and the BLE radio all stop in light sleep
+    if (!globalState.getBacklightOff() || globalState.getUsbConnected() ||
+        globalState.getBleStatus() != BleStatusEnum::Off) {
+        backlightOffSinceMs = 0;
+        return false;
+    }
+
+    // Screen off for a while, no key down and nothing left for the UI
+    uint32_t nowMs = millis();
+    if (backlightOffSinceMs == 0) {
+        backlightOffSinceMs = nowMs;
+    }
+    return nowMs - backlightOffSinceMs >= globalState.getIdleSleepDelay() &&
+           candidateKey == KEY_NONE && heldKey == KEY_NONE && uxQueueMessagesWaiting(queue) == 0;
+}
+
+void CardputerInput::lightSleep() {
+    // Timer wake keeps scanning every row, the columns wake at once for the row the last scan left selected
+    esp_sleep_enable_timer_wakeup(globalState.getKeyIdleScanInterval() * 1000ULL);
+    for (auto pin : wakePins) {
+        gpio_wakeup_enable(pin, GPIO_INTR_LOW_LEVEL);
+    }
+    esp_sleep_enable_gpio_wakeup();
+
+    uint32_t sleptAtUs = micros();
+    esp_light_sleep_start();
+    wokeUs = micros();
+
+    for (auto pin : wakePins) {
+        gpio_wakeup_disable(pin);
     }
-    delay(10);
-  }
+    latency.sleptFor(wokeUs - sleptAtUs);
+}
+
+bool CardputerInput::isRepeatable(char key) const {
+    // Scroll, delete and text cursor only, left is also "back" so it is never repeated
+    return key == KEY_ARROW_UP || key == KEY_ARROW_DOWN || key == KEY_DEL ||
+           key == KEY_DEL_FORWARD || key == KEY_CURSOR_LEFT || key == KEY_CURSOR_RIGHT ||
+           key == KEY_WORD_LEFT || key == KEY_WORD_RIGHT;
 }
 
-}
\ No newline at end of file
+void CardputerInput::post(char key, bool repeat, uint32_t timestampUs) {
+    KeyEvent event{key, repeat, timestampUs};
+
+    // Never block the scan when the UI is busy
+    if (xQueueSend(queue, &event, 0) != pdTRUE) {
+        latency.keyDropped();
+    }
+}
+
+}
@@ -3,14 +3,69 @@
 
 #include <map>
 #include <M5Cardputer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <States/GlobalState.h>
+#include <Managers/LatencyManager.h>
+#include <Managers/PowerManager.h>
 #include "IInput.h"
 
 namespace inputs {
 
+// Key posted by the scan task, timestamped when the press was first seen
+struct KeyEvent {
+    char key;
+    bool repeat;
+    uint32_t timestampUs;
+};
+
 class CardputerInput : public IInput {
 public:
+    void initialize() override;
     char handler() override;
     void waitPress() override;
+    char waitKey(uint32_t timeoutMs) override;
+    void postKey(char key) override;
+    void setActivityListener(std::function<void()> listener) override;
+    void setIdleListener(std::function<void(bool keyHandled)> listener) override;
+
+private:
+    static const size_t queueLength = 16;
+
+    QueueHandle_t queue = nullptr;
+    TaskHandle_t scanTaskHandle = nullptr;
+    std::function<void()> activityListener;
+    std::function<void(bool keyHandled)> idleListener;
+    bool keyHandedOut = false; // since the idle listener last ran
+    GlobalState& globalState = GlobalState::getInstance();
+    LatencyManager& latency = LatencyManager::getInstance();
+    PowerManager& power = PowerManager::getInstance();
+    bool boosted = false; // CpuMax held since the last key handed out
+
+    // Scan task state
+    char candidateKey = KEY_NONE;
+    uint32_t candidateSinceUs = 0;
+    char heldKey = KEY_NONE;
+    uint32_t heldSinceUs = 0;
+    uint32_t nextRepeatMs = 0;
+    uint32_t repeatInterval = 0;
+
+    // Idle light sleep
+    uint32_t backlightOffSinceMs = 0;
+    uint32_t wokeUs = 0; // set by lightSleep(), read by the next scan
+    uint32_t wakeAtUs = 0;
+    bool pressAfterWake = false; // candidate first seen right after a wake
+
+    static void scanTask(void* param);
+    void scan();
+    bool canLightSleep();
+    void lightSleep();
+    char readKey();
+    bool isRepeatable(char key) const;
+    void notifyIdle();
+    void unboost();
+    void post(char key, bool repeat, uint32_t timestampUs);
 };
 
 }
@@ -0,0 +1,83 @@
+#include "EditBuffer.h"
+#include <cctype>
+
+EditBuffer::EditBuffer(const std::string& value, size_t limit)
+    : value(value), position(value.size()), limit(limit) {}
+
+bool EditBuffer::insert(char c) {
+    if (limit && value.size() >= limit) {
+        return false;
+    }
+    value.insert(value.begin() + position, c);
+    position++;
+    return true;
+}
+
+bool EditBuffer::backspace() {
+    if (position == 0) {
+        return false;
+    }
+    value.erase(--position, 1);
+    return true;
+}
+
+bool EditBuffer::deleteForward() {
+    if (position >= value.size()) {
+        return false;
+    }
+    value.erase(position, 1);
+    return true;
+}
+
+void EditBuffer::clear() {
+    value.clear();
+    position = 0;
+}
+
+bool EditBuffer::moveLeft() {
+    return position > 0 && moveTo(position - 1);
+}
+
+bool EditBuffer::moveRight() {
+    return moveTo(position + 1);
+}
+
+bool EditBuffer::wordLeft() {
+    // Skip separators then the word, stops at the start of the word
+    size_t target = position;
+    while (target > 0 && !std::isalnum(static_cast<unsigned char>(value[target - 1]))) {
+        target--;
+    }
+    while (target > 0 && std::isalnum(static_cast<unsigned char>(value[target - 1]))) {
+        target--;
+    }
+    return moveTo(target);
+}
+
+bool EditBuffer::wordRight() {
+    // Skip the word then separators, stops at the start of the next word
+    size_t target = position;
+    while (target < value.size() && std::isalnum(static_cast<unsigned char>(value[target]))) {
+        target++;
+    }
+    while (target < value.size() && !std::isalnum(static_cast<unsigned char>(value[target]))) {
+        target++;
+    }
+    return moveTo(target);
+}
+
+bool EditBuffer::home() {
+    return moveTo(0);
+}
+
+bool EditBuffer::end() {
+    return moveTo(value.size());
+}
+
+bool EditBuffer::moveTo(size_t target) {
+    if (target > value.size() || target == position) {
+        return false;
+    }
+    position = target;
+    return true;
+}
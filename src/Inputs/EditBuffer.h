@@ -0,0 +1,37 @@
+#ifndef EDIT_BUFFER_H
+#define EDIT_BUFFER_H
+
+#include <string>
+#include <cstddef>
+
+// Text being typed, with a cursor between characters (0 = before the first one)
+class EditBuffer {
+public:
+    EditBuffer(const std::string& value = "", size_t limit = 0);
+
+    bool insert(char c); // false when the limit is reached
+    bool backspace();
+    bool deleteForward();
+    void clear();
+
+    bool moveLeft();
+    bool moveRight();
+    bool wordLeft();
+    bool wordRight();
+    bool home();
+    bool end();
+
+    const std::string& text() const { return value; }
+    size_t cursor() const { return position; }
+    size_t size() const { return value.size(); }
+    bool empty() const { return value.empty(); }
+
+private:
+    std::string value;
+    size_t position;
+    size_t limit; // 0 = no limit
+
+    bool moveTo(size_t target);
+};
+
+#endif // EDIT_BUFFER_H
@@ -1,13 +1,21 @@
 #ifndef I_INPUT_H
 #define I_INPUT_H
 
+#include <cstdint>
+#include <functional>
 #include "InputKeys.h"
 
 class IInput {
 public:
     virtual ~IInput() = default;
+    virtual void initialize() = 0;
     virtual char handler() = 0;
     virtual void waitPress() = 0;
+    virtual char waitKey(uint32_t timeoutMs) = 0; // KEY_NONE if nothing was pressed in time
+    virtual void postKey(char key) = 0; // queued as if pressed, from any task
+    virtual void setActivityListener(std::function<void()> listener) = 0; // called on each physical key
+    // Called on the UI task each time it waits for a key, keyHandled when keys went out since the last call
+    virtual void setIdleListener(std::function<void(bool keyHandled)> listener) = 0;
 };
 
 #endif // I_INPUT_H
@@ -11,4 +11,16 @@
 #define KEY_ARROW_LEFT ','
 #define KEY_ARROW_RIGHT '/'
 
+// Text cursor, ctrl/opt + arrows, never printable
+#define KEY_CURSOR_LEFT '\x11'
+#define KEY_CURSOR_RIGHT '\x12'
+#define KEY_WORD_LEFT '\x13'
+#define KEY_WORD_RIGHT '\x14'
+#define KEY_CURSOR_HOME '\x01'
+#define KEY_CURSOR_END '\x05'
+#define KEY_DEL_FORWARD '\x7f'
+
+// Posted by the inactivity timer, screens return so the dispatcher can lock
+#define KEY_LOCK '\x18'
+
 #endif // INPUT_KEYS_H
@@ -0,0 +1,22 @@
+#ifndef ENTRY_LIST_SOURCE_H
+#define ENTRY_LIST_SOURCE_H
+
+#include <string>
+#include <vector>
+#include <Models/Entry.h>
+#include "IListSource.h"
+
+// Entries by service name, last created first, the id is the index in the entries vector
+class EntryListSource : public IListSource {
+public:
+    explicit EntryListSource(const std::vector<Entry>& entries) : entries(entries) {}
+
+    size_t size() const override { return entries.size(); }
+    const std::string& label(size_t index) const override { return entries[id(index)].getServiceName(); }
+    int id(size_t index) const override { return entries.size() - 1 - index; }
+
+private:
+    const std::vector<Entry>& entries;
+};
+
+#endif // ENTRY_LIST_SOURCE_H
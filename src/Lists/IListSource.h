@@ -0,0 +1,16 @@
+#ifndef I_LIST_SOURCE_H
+#define I_LIST_SOURCE_H
+
+#include <string>
+#include <cstddef>
+
+// Rows of a list, read by index so selectors never copy the whole list
+class IListSource {
+public:
+    virtual ~IListSource() = default;
+    virtual size_t size() const = 0;
+    virtual const std::string& label(size_t index) const = 0;
+    virtual int id(size_t index) const = 0; // value returned when the row is selected
+};
+
+#endif // I_LIST_SOURCE_H
@@ -0,0 +1,21 @@
+#ifndef VECTOR_LIST_SOURCE_H
+#define VECTOR_LIST_SOURCE_H
+
+#include <string>
+#include <vector>
+#include "IListSource.h"
+
+// Rows are the strings of a vector, the id is the vector index
+class VectorListSource : public IListSource {
+public:
+    explicit VectorListSource(const std::vector<std::string>& options) : options(options) {}
+
+    size_t size() const override { return options.size(); }
+    const std::string& label(size_t index) const override { return options[index]; }
+    int id(size_t index) const override { return index; }
+
+private:
+    const std::vector<std::string>& options;
+};
+
+#endif // VECTOR_LIST_SOURCE_H
@@ -0,0 +1,169 @@
+#ifndef BLE_CONNECTION_MANAGER_H
+#define BLE_CONNECTION_MANAGER_H
+
+#include "../Services/BleService.h"
+#include "../Services/NvsService.h"
+#include "../States/GlobalState.h"
+#include "../Enums/BleStatusEnum.h"
+#include "../Enums/KeyboardLayoutEnum.h"
+#include "../Enums/UnicodeInputEnum.h"
+#include <cstdlib>
+#include <string>
+
+// Keeps the BLE keyboard connected in the background and remembers the settings of each host
+class BleConnectionManager {
+public:
+    struct HostProfile {
+        std::string layout;         // keyboard layout name
+        uint32_t typingDelayMs = 0; // extra gap between reports
+        std::string unicodeInput;   // input method for chars missing from the layout
+    };
+
+private:
+    BleService& bleService;
+    NvsService& nvsService;
+    GlobalState& globalState = GlobalState::getInstance();
+
+    bool started = false;
+    volatile bool hostChanged = false; // set by the BLE task, applied on the UI side
+    std::string currentHost;
+    HostProfile currentProfile;
+
+    // NVS keys are 15 chars max, "bh" + the 12 hex digits of the address
+    static std::string profileKey(const std::string& address) {
+        std::string key = "bh";
+        for (char c : address) {
+            if (c != ':') {
+                key += c;
+            }
+        }
+        return key;
+    }
+
+    void applyHost() {
+        hostChanged = false;
+        std::string host = bleService.getPeerAddress();
+        if (host.empty()) {
+            currentHost.clear();
+            return;
+        }
+        if (host == currentHost) {
+            return;
+        }
+
+        // A new host starts with the current settings
+        currentHost = host;
+        if (!loadProfile(host, currentProfile)) {
+            currentProfile = HostProfile();
+            currentProfile.layout = globalState.getSelectedKeyboardLayout();
+            currentProfile.unicodeInput = globalState.getSelectedUnicodeInput();
+            saveProfile(host, currentProfile);
+        }
+        bleService.setLayout(KeyboardLayoutMapper::toLayout(currentProfile.layout));
+        bleService.setTypingDelay(currentProfile.typingDelayMs);
+        bleService.setUnicodeInput(UnicodeInputMapper::toInput(currentProfile.unicodeInput));
+        nvsService.saveString(globalState.getNvsBleLastHost(), host);
+    }
+
+public:
+    BleConnectionManager(BleService& bleService, NvsService& nvsService)
+        : bleService(bleService), nvsService(nvsService) {}
+
+    // Advertise once BLE is enabled, the last host is advertised to first
+    void start() {
+        if (!globalState.getBleKeyboardEnabled()) {
+            stop();
+            return;
+        }
+        if (started) {
+            return;
+        }
+
+        bleService.setLayout(KeyboardLayoutMapper::toLayout(globalState.getSelectedKeyboardLayout()));
+        bleService.setUnicodeInput(UnicodeInputMapper::toInput(globalState.getSelectedUnicodeInput()));
+        bleService.setDeviceName(globalState.getBleDeviceName());
+        bleService.setDirectedPeer(nvsService.getString(globalState.getNvsBleLastHost()));
+        bleService.onConnectionChange([this](bool connected) {
+            globalState.setBleStatus(connected ? BleStatusEnum::Connected : BleStatusEnum::Advertising);
+            hostChanged = true;
+        });
+        bleService.begin();
+        globalState.setBleStatus(BleStatusEnum::Advertising);
+        started = true;
+    }
+
+    void stop() {
+        bleService.end();
+        globalState.setBleStatus(BleStatusEnum::Off);
+        currentHost.clear();
+        started = false;
+    }
+
+    // Connected host ready to type, its profile applied
+    bool ready() {
+        if (hostChanged) {
+            applyHost();
+        }
+        return started && bleService.isReady();
+    }
+
+    // Layout picked by the user, the connected host keeps it
+    void useLayout(const std::string& layout) {
+        if (ready() && !currentHost.empty()) {
+            currentProfile.layout = layout;
+            saveProfile(currentHost, currentProfile);
+        }
+        bleService.setLayout(KeyboardLayoutMapper::toLayout(layout));
+    }
+
+    // Input method picked by the user, the connected host keeps it
+    void useUnicodeInput(const std::string& input) {
+        if (ready() && !currentHost.empty()) {
+            currentProfile.unicodeInput = input;
+            saveProfile(currentHost, currentProfile);
+        }
+        bleService.setUnicodeInput(UnicodeInputMapper::toInput(input));
+    }
+
+    // Slower typing for the connected host only, false when no host
+    bool setTypingDelay(uint32_t ms) {
+        if (!ready() || currentHost.empty()) {
+            return false;
+        }
+        currentProfile.typingDelayMs = ms;
+        saveProfile(currentHost, currentProfile);
+        bleService.setTypingDelay(ms);
+        return true;
+    }
+
+    uint32_t getTypingDelay() {
+        return ready() ? currentProfile.typingDelayMs : 0;
+    }
+
+    // Bonds are gone, hosts will pair again
+    void forgetHosts() {
+        bleService.clearBonds();
+        bleService.setDirectedPeer("");
+        nvsService.remove(globalState.getNvsBleLastHost());
+    }
+
+    // Profile stored as "layout;delay;input", older profiles take the current input
+    bool loadProfile(const std::string& address, HostProfile& profile) {
+        std::string value = nvsService.getString(profileKey(address));
+        size_t separator = value.find(';');
+        if (separator == std::string::npos) {
+            return false;
+        }
+        profile.layout = value.substr(0, separator);
+        profile.typingDelayMs = std::strtoul(value.c_str() + separator + 1, nullptr, 10);
+        size_t inputSeparator = value.find(';', separator + 1);
+        profile.unicodeInput = inputSeparator == std::string::npos ? globalState.getSelectedUnicodeInput() : value.substr(inputSeparator + 1);
+        return true;
+    }
+
+    void saveProfile(const std::string& address, const HostProfile& profile) {
+        nvsService.saveString(profileKey(address), profile.layout + ";" + std::to_string(profile.typingDelayMs) + ";" + profile.unicodeInput);
+    }
+};
+
+#endif // BLE_CONNECTION_MANAGER_H
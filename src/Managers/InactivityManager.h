@@ -2,96 +2,144 @@
 #define INACTIVITY_MANAGER_H
 
 #include "../Views/IView.h"
+#include "../Inputs/IInput.h"
 #include "../Services/EntryService.h"
 #include "../States/GlobalState.h"
-#include <chrono>
 #include <Arduino.h>
+#include <esp_timer.h>
 
+// Dim, screen off and lock deadlines run on one-shot esp_timers, restarted
+// by every physical key whatever screen is active. Nothing polls the time.
+// esp_timer time goes on across light sleep, the FreeRTOS tick count does not.
 class InactivityManager {
 private:
     IView& display;
-    std::chrono::steady_clock::time_point lastInteractionTime;
+    IInput* input = nullptr; // set by begin()
 
-    bool isDimmed = false;
-    bool isShutdown = false;
-    bool isLocked = false;
+    esp_timer_handle_t dimTimer = nullptr;
+    esp_timer_handle_t screenTimer = nullptr;
+    esp_timer_handle_t lockTimer = nullptr;
+
+    // Written by the esp_timer task, the key scan task and the UI
+    volatile bool isDimmed = false;
+    volatile bool isShutdown = false;
 
     GlobalState& globalState = GlobalState::getInstance();
 
 public:
-    InactivityManager(IView& display) : display(display) {
-        lastInteractionTime = std::chrono::steady_clock::now();
+    InactivityManager(IView& display) : display(display) {}
+
+    ~InactivityManager() {
+        for (auto timer : {dimTimer, screenTimer, lockTimer}) {
+            if (timer) {
+                esp_timer_stop(timer);
+                esp_timer_delete(timer);
+            }
+        }
+    }
+
+    // Timers stay unarmed until then, the unit tests drive the stages directly
+    void begin(IInput& keys) {
+        input = &keys;
+        dimTimer = createTimer("dim", onDim);
+        screenTimer = createTimer("screenOff", onScreenOff);
+        lockTimer = createTimer("lock", onLock);
+        input->setActivityListener([this]() { activity(); });
+        arm();
     }
 
+    // Fresh start for a screen, the lock is only cleared by the dispatcher
     void reset() {
-        lastInteractionTime = std::chrono::steady_clock::now();
-        globalState.setVaultIsLocked(false);
-        if (isDimmed || isShutdown) {
+        arm();
+        if ((isDimmed || isShutdown) && !getVaultIsLocked()) {
             restoreScreen();
         }
-        isLocked = false;
     }
 
+    // BLE connection changes in the background, the view only redraws when it differs
     void update() {
-        auto now = std::chrono::steady_clock::now();
-        auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastInteractionTime).count();
-
-        // **Réduction de la luminosité**
-        if (!isDimmed && elapsedMs >= globalState.getInactivityBrightnessTimeout()) {
-            dimScreen();
-        }
-
-        // **Extinction complète de l'écran**
-        if (!isShutdown && elapsedMs >= globalState.getInactivityScreenTimeout()) {
-            shutdownScreen();
-        }
+        display.bleStatus(globalState.getBleStatus());
+    }
 
-        // **Verrouillage du coffre**
-        if (!isLocked && elapsedMs >= globalState.getInactivityLockTimeout()) {
-            lockVault();
-        }
+    // From the key scan task, before the key is queued
+    void activity() {
+        reset();
     }
 
+    // Fades run in the background, keys keep being read while the screen dims
     void dimScreen() {
-        uint16_t currentBrightness = display.getBrightness();
-        while (currentBrightness > 20) {
-            currentBrightness -= 1; // Diminue progressivement
-            display.setBrightness(currentBrightness);
-            delay(5);
-        }
+        fadeTo(20);
         isDimmed = true;
     }
 
     void shutdownScreen() {
-        uint16_t currentBrightness = display.getBrightness();
-        while (currentBrightness > 1) {
-            currentBrightness -= 1; // Diminue progressivement
-            display.setBrightness(currentBrightness);
-            delay(5);
-        }   
+        fadeTo(1);
         isShutdown = true;
     }
 
+    // 5 ms per brightness unit, as the former blocking ramp
+    void fadeTo(uint8_t target) {
+        uint8_t currentBrightness = display.getBrightness();
+        if (currentBrightness > target) {
+            display.fadeBrightness(target, (currentBrightness - target) * 5);
+        }
+    }
+
+    // Instant, also stops a fade
     void restoreScreen() {
         display.setBrightness(globalState.getSelectedScreenBrightness());
         isDimmed = false;
         isShutdown = false;
     }
 
+    // Runs on the esp_timer task: only the flag and a wake-up, the UI task unwinds on
+    // the flag and the dispatcher wipes the secrets, nothing is freed under a reader
     void lockVault() {
-        shutdownScreen();
         globalState.setVaultIsLocked(true);
-        isShutdown = true;
-        isLocked = true;
+        if (input) {
+            input->postKey(KEY_LOCK);
+        }
     }
 
     bool getVaultIsLocked() const {
-        return isLocked;
+        return globalState.getVaultIsLocked();
     }
 
     void setVaultIsLocked(bool lockState) {
-        isLocked = lockState;
+        globalState.setVaultIsLocked(lockState);
+    }
+
+private:
+    // Restart the three deadlines, settings changes apply from the next key
+    void arm() {
+        if (!lockTimer) {
+            return;
+        }
+        restart(dimTimer, globalState.getInactivityBrightnessTimeout());
+        restart(screenTimer, globalState.getInactivityScreenTimeout());
+        restart(lockTimer, globalState.getInactivityLockTimeout());
+    }
+
+    // A one-shot timer can't be started again while it runs
+    static void restart(esp_timer_handle_t timer, uint32_t timeoutMs) {
+        esp_timer_stop(timer);
+        esp_timer_start_once(timer, timeoutMs * 1000ULL);
     }
+
+    esp_timer_handle_t createTimer(const char* name, esp_timer_cb_t callback) {
+        esp_timer_create_args_t args = {};
+        args.callback = callback;
+        args.arg = this;
+        args.name = name;
+        esp_timer_handle_t timer = nullptr;
+        esp_timer_create(&args, &timer);
+        return timer;
+    }
+
+    // Run on the esp_timer task, like the backlight fade steps
+    static void onDim(void* arg) { static_cast<InactivityManager*>(arg)->dimScreen(); }
+    static void onScreenOff(void* arg) { static_cast<InactivityManager*>(arg)->shutdownScreen(); }
+    static void onLock(void* arg) { static_cast<InactivityManager*>(arg)->lockVault(); }
 };
 
 #endif // INACTIVITY_MANAGER_H
@@ -0,0 +1,278 @@
+#ifndef LATENCY_MANAGER_H
+#define LATENCY_MANAGER_H
+
+#include <Arduino.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+
+// Last samples of one latency stage, in microseconds
+class LatencyHistogram {
+public:
+    static const size_t capacity = 128;
+
+    struct Summary {
+        uint32_t count = 0;
+        uint32_t min = 0;
+        uint32_t median = 0;
+        uint32_t p99 = 0;
+        uint32_t max = 0;
+    };
+
+    void add(uint32_t us) {
+        samples[next] = us;
+        next = (next + 1) % capacity;
+        if (count < capacity) {
+            count++;
+        }
+    }
+
+    void clear() {
+        count = 0;
+        next = 0;
+    }
+
+    size_t size() const { return count; }
+
+    Summary summary() const {
+        Summary result;
+        result.count = count;
+        if (count == 0) {
+            return result;
+        }
+
+        std::array<uint32_t, capacity> sorted;
+        std::copy(samples.begin(), samples.begin() + count, sorted.begin());
+        std::sort(sorted.begin(), sorted.begin() + count);
+
+        result.min = sorted[0];
+        result.median = sorted[count / 2];
+        result.p99 = sorted[(count * 99 + 99) / 100 - 1]; // nearest rank
+        result.max = sorted[count - 1];
+        return result;
+    }
+
+private:
+    std::array<uint32_t, capacity> samples{};
+    size_t count = 0;
+    size_t next = 0;
+};
+
+// Key press to pixels timing, split into the input, selector and draw stages
+class LatencyManager {
+private:
+    LatencyHistogram inputStage;    // press seen -> handler() returns it
+    LatencyHistogram selectorStage; // handler() returns -> selector state updated
+    LatencyHistogram drawStage;     // selector state updated -> last frame pushed
+    LatencyHistogram totalStage;    // press seen -> last frame pushed
+    LatencyHistogram wakeStage;     // light sleep wake -> key posted
+
+    // Every frame, keys or not
+    LatencyHistogram composeStage;  // drawing into the canvas
+    LatencyHistogram pushStage;     // starting the DMA push
+    LatencyHistogram dmaWaitStage;  // next frame waiting for the previous push
+    uint32_t frames = 0;
+    uint64_t pixels = 0;
+
+    uint32_t droppedKeys = 0; // input queue full
+
+    // Idle light sleep residency since the last reset
+    uint32_t sleeps = 0;
+    uint64_t sleptUs = 0;
+    uint32_t windowStartMs = 0;
+
+    // Key being processed
+    bool pending = false;
+    bool changed = false;
+    bool drawn = false;
+    uint32_t pressedUs = 0;
+    uint32_t handledUs = 0;
+    uint32_t changedUs = 0;
+    uint32_t drawnUs = 0;
+
+    uint32_t lastTotalUs = 0;
+    bool overlayEnabled = false;
+    std::string serialLine;
+
+    // Private constructor
+    LatencyManager() = default;
+
+    void settle() {
+        if (!pending) {
+            return;
+        }
+        pending = false;
+
+        // Key ignored by the UI, nothing was drawn for it
+        if (!drawn) {
+            return;
+        }
+
+        uint32_t stateUs = changed ? changedUs : handledUs;
+        inputStage.add(handledUs - pressedUs);
+        selectorStage.add(stateUs - handledUs);
+        drawStage.add(drawnUs - stateUs);
+        lastTotalUs = drawnUs - pressedUs;
+        totalStage.add(lastTotalUs);
+    }
+
+    void printStage(const char* name, const LatencyHistogram& histogram) const {
+        auto s = histogram.summary();
+        Serial.printf("%-8s n=%3u min=%6u med=%6u p99=%6u max=%6u us\n",
+                      name, (unsigned)s.count, (unsigned)s.min, (unsigned)s.median, (unsigned)s.p99, (unsigned)s.max);
+    }
+
+public:
+    // Erase Public constructor
+    LatencyManager(const LatencyManager&) = delete;
+    LatencyManager& operator=(const LatencyManager&) = delete;
+
+    // Get the unique instance
+    static LatencyManager& getInstance() {
+        static LatencyManager instance;
+        return instance;
+    }
+
+    // Input returned a key, the previous key is done once the UI waits again
+    void keyHandled(uint32_t keyPressedUs) {
+        settle();
+        pending = true;
+        pressedUs = keyPressedUs;
+        handledUs = micros();
+        changed = false;
+        drawn = false;
+    }
+
+    // Input is waiting again, the UI has finished reacting to the last key
+    void inputIdle() {
+        settle();
+    }
+
+    // Selector applied the key (moved, filtered...)
+    void stateChanged() {
+        if (pending && !changed) {
+            changed = true;
+            changedUs = micros();
+        }
+    }
+
+    // Input scan task woke from a light sleep of sleptUs
+    void sleptFor(uint32_t us) {
+        sleeps++;
+        sleptUs += us;
+    }
+
+    // Scan task found the input queue full
+    void keyDropped() {
+        droppedKeys++;
+    }
+
+    // First key seen after a wake, posted after us
+    void wokeToKey(uint32_t us) {
+        wakeStage.add(us);
+    }
+
+    // View pushed a frame, the last one before input idles ends the sample
+    void framePresented(uint32_t composeUs, uint32_t pushUs, uint32_t framePixels) {
+        composeStage.add(composeUs);
+        pushStage.add(pushUs);
+        frames++;
+        pixels += framePixels;
+
+        if (pending) {
+            drawn = true;
+            drawnUs = micros();
+        }
+    }
+
+    // View waited for the DMA of the previous frame
+    void pushWaited(uint32_t us) {
+        dmaWaitStage.add(us);
+    }
+
+    void reset() {
+        pending = false;
+        lastTotalUs = 0;
+        inputStage.clear();
+        selectorStage.clear();
+        drawStage.clear();
+        totalStage.clear();
+        wakeStage.clear();
+        composeStage.clear();
+        pushStage.clear();
+        dmaWaitStage.clear();
+        frames = 0;
+        pixels = 0;
+        droppedKeys = 0;
+        sleeps = 0;
+        sleptUs = 0;
+        windowStartMs = millis();
+    }
+
+    const LatencyHistogram& getInputStage() const { return inputStage; }
+    const LatencyHistogram& getSelectorStage() const { return selectorStage; }
+    const LatencyHistogram& getDrawStage() const { return drawStage; }
+    const LatencyHistogram& getTotalStage() const { return totalStage; }
+    const LatencyHistogram& getWakeStage() const { return wakeStage; }
+    const LatencyHistogram& getComposeStage() const { return composeStage; }
+    const LatencyHistogram& getPushStage() const { return pushStage; }
+    const LatencyHistogram& getDmaWaitStage() const { return dmaWaitStage; }
+    uint32_t getFrames() const { return frames; }
+    uint32_t getSleeps() const { return sleeps; }
+    uint32_t getDroppedKeys() const { return droppedKeys; }
+
+    // Share of the time spent in light sleep, the idle current follows it
+    uint8_t sleepResidencyPercent() const {
+        uint64_t windowUs = uint64_t(millis() - windowStartMs) * 1000;
+        return windowUs ? std::min<uint64_t>(100, sleptUs * 100 / windowUs) : 0;
+    }
+    uint32_t getLastTotalUs() const { return lastTotalUs; }
+
+    bool isOverlayEnabled() const { return overlayEnabled; }
+    void setOverlayEnabled(bool enabled) { overlayEnabled = enabled; }
+
+    void dump() const {
+        Serial.println("latency (last 128 keys)");
+        printStage("input", inputStage);
+        printStage("selector", selectorStage);
+        printStage("draw", drawStage);
+        printStage("total", totalStage);
+        printStage("wake", wakeStage);
+        Serial.printf("dropped  n=%u\n", (unsigned)droppedKeys);
+        Serial.println("frames (last 128)");
+        printStage("compose", composeStage);
+        printStage("push", pushStage);
+        printStage("dma wait", dmaWaitStage);
+        Serial.printf("frames   n=%u px/frame=%u\n",
+                      (unsigned)frames, (unsigned)(frames ? pixels / frames : 0));
+        Serial.printf("sleep    n=%u asleep=%u%% over %u s\n",
+                      (unsigned)sleeps, (unsigned)sleepResidencyPercent(), (unsigned)((millis() - windowStartMs) / 1000));
+    }
+
+    // Serial commands: "lat" dump, "lat on" / "lat off" overlay, "lat reset"
+    void pollSerial() {
+        while (Serial.available() > 0) {
+            char c = Serial.read();
+            if (c != '\n' && c != '\r') {
+                if (serialLine.size() < 32) {
+                    serialLine += c;
+                }
+                continue;
+            }
+
+            if (serialLine == "lat") {
+                dump();
+            } else if (serialLine == "lat on") {
+                overlayEnabled = true;
+            } else if (serialLine == "lat off") {
+                overlayEnabled = false;
+            } else if (serialLine == "lat reset") {
+                reset();
+            }
+            serialLine.clear();
+        }
+    }
+};
+
+#endif // LATENCY_MANAGER_H
@@ -0,0 +1,127 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include <sdkconfig.h>
+#include <esp_idf_version.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>
+#endif
+
+enum class PowerLock {
+    CpuMax, // crypto, vault parsing, typing, UI reacting to a key
+    Bus,    // display and SD transfers, the APB clock must not change under them
+    Count
+};
+
+// CPU frequency follows the work: full speed while a lock is held, low while
+// waiting for input. ESP-IDF power management locks when the core is built
+// with CONFIG_PM_ENABLE, setCpuFrequencyMhz() on the transitions otherwise.
+class PowerManager {
+private:
+    static const uint32_t MAX_MHZ = 240;
+    static const uint32_t IDLE_MHZ = 80; // lowest that keeps the APB at 80 MHz, SPI and SD clocks unchanged
+
+    bool started = false;
+    SemaphoreHandle_t mutex = nullptr;
+    uint16_t holders[static_cast<size_t>(PowerLock::Count)] = {};
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_handle_t locks[static_cast<size_t>(PowerLock::Count)] = {};
+#endif
+
+    // Private constructor
+    PowerManager() = default;
+
+public:
+    // Erase Public constructor
+    PowerManager(const PowerManager&) = delete;
+    PowerManager& operator=(const PowerManager&) = delete;
+
+    // Get the unique instance
+    static PowerManager& getInstance() {
+        static PowerManager instance;
+        return instance;
+    }
+
+    // Held for a scope
+    class Hold {
+    public:
+        explicit Hold(PowerLock lock) : lock(lock) { PowerManager::getInstance().acquire(lock); }
+        ~Hold() { PowerManager::getInstance().release(lock); }
+        Hold(const Hold&) = delete;
+        Hold& operator=(const Hold&) = delete;
+
+    private:
+        PowerLock lock;
+    };
+
+    // Locks are no-ops until then, the unit tests never start it
+    void begin() {
+        if (started) {
+            return;
+        }
+        mutex = xSemaphoreCreateMutex();
+
+#if CONFIG_PM_ENABLE
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+        esp_pm_config_t config = {};
+#else
+        esp_pm_config_esp32s3_t config = {};
+#endif
+        config.max_freq_mhz = MAX_MHZ;
+        config.min_freq_mhz = IDLE_MHZ;
+        config.light_sleep_enable = false; // the key scan task decides, see CardputerInput
+        esp_pm_configure(&config);
+        esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "cpuMax", &locks[static_cast<size_t>(PowerLock::CpuMax)]);
+        esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "bus", &locks[static_cast<size_t>(PowerLock::Bus)]);
+#else
+        setCpuFrequencyMhz(IDLE_MHZ);
+#endif
+        started = true;
+    }
+
+    void acquire(PowerLock lock) {
+        if (!started) {
+            return;
+        }
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        if (holders[static_cast<size_t>(lock)]++ == 0) {
+            apply(lock, true);
+        }
+        xSemaphoreGive(mutex);
+    }
+
+    void release(PowerLock lock) {
+        if (!started) {
+            return;
+        }
+        xSemaphoreTake(mutex, portMAX_DELAY);
+        uint16_t& count = holders[static_cast<size_t>(lock)];
+        if (count > 0 && --count == 0) {
+            apply(lock, false);
+        }
+        xSemaphoreGive(mutex);
+    }
+
+    uint32_t getCpuMhz() const {
+        return getCpuFrequencyMhz();
+    }
+
+private:
+    // First holder in, last holder out
+    void apply(PowerLock lock, bool held) {
+#if CONFIG_PM_ENABLE
+        auto handle = locks[static_cast<size_t>(lock)];
+        held ? esp_pm_lock_acquire(handle) : esp_pm_lock_release(handle);
+#else
+        // The APB stays at 80 MHz from IDLE_MHZ up, the bus lock has nothing to change
+        if (lock == PowerLock::CpuMax) {
+            setCpuFrequencyMhz(held ? MAX_MHZ : IDLE_MHZ);
+        }
+#endif
+    }
+};
+
+#endif // POWER_MANAGER_H
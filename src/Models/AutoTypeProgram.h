@@ -0,0 +1,33 @@
+#ifndef AUTO_TYPE_PROGRAM_H
+#define AUTO_TYPE_PROGRAM_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Step kinds of a compiled auto-type template
+enum class AutoTypeOp : uint8_t {
+    Text,   // literals[arg, arg + length)
+    Field,  // entry field, arg is an AutoTypeField
+    Key,    // non printing key, arg is the keyboard code (KEY_ESC...)
+    Delay   // pause of arg ms once the previous keys are typed
+};
+
+enum class AutoTypeField : uint8_t { Username, Password, Notes, Link };
+
+struct AutoTypeStep {
+    AutoTypeOp op;
+    uint16_t arg;
+    uint16_t length;
+};
+
+// Holds no secret, fields are read from the entry when the program runs
+struct AutoTypeProgram {
+    std::vector<AutoTypeStep> steps;
+    std::string literals;
+    std::string error; // empty when the template compiled
+
+    bool valid() const { return error.empty(); }
+};
+
+#endif // AUTO_TYPE_PROGRAM_H
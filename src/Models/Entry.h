@@ -15,6 +15,7 @@ private:
     std::string notes2;
     std::string notes3;
     std::string link;
+    std::string autoType;
     time_t createdAt;
     time_t updatedAt;
     time_t expiresAt;
@@ -23,24 +24,24 @@ public:
     // Constructeurs
     Entry()
         : id(""), serviceName(""), username(""), password(""),
-          categoryIndex(0), notes(""), notes2(""), notes3(""), link(""),
+          categoryIndex(0), notes(""), notes2(""), notes3(""), link(""), autoType(""),
           createdAt(0), updatedAt(0), expiresAt(0) {}
 
     Entry(const std::string& serviceName, const std::string& username, const std::string& password, const std::string& notes)
         : id(""), serviceName(serviceName), username(username), password(password), 
-          categoryIndex(0), notes(notes), notes2(""), notes3(""), link(""),
+          categoryIndex(0), notes(notes), notes2(""), notes3(""), link(""), autoType(""),
           createdAt(0), updatedAt(0), expiresAt(0) {}
 
     Entry(const std::string& id, const std::string& serviceName, const std::string& username, 
           const std::string& password, size_t categoryIndex)
         : id(id), serviceName(serviceName), username(username), password(password), 
-          categoryIndex(categoryIndex), notes(""), notes2(""), notes3(""), link(""),
+          categoryIndex(categoryIndex), notes(""), notes2(""), notes3(""), link(""), autoType(""),
           createdAt(0), updatedAt(0), expiresAt(0) {}
 
     Entry(const std::string& id, const std::string& serviceName, const std::string& username, 
           const std::string& password, size_t categoryIndex, const std::string& link)
         : id(id), serviceName(serviceName), username(username), password(password), 
-          categoryIndex(categoryIndex), notes(""), notes2(""), notes3(""), link(link),
+          categoryIndex(categoryIndex), notes(""), notes2(""), notes3(""), link(link), autoType(""),
           createdAt(0), updatedAt(0), expiresAt(0) {}
 
     // Accesseurs
@@ -53,6 +54,7 @@ public:
     const std::string& getNotes2() const { return notes2; } 
     const std::string& getNotes3() const { return notes3; }
     const std::string& getLink() const { return link; }
+    const std::string& getAutoType() const { return autoType; }
     time_t getCreatedAt() const { return createdAt; }
     time_t getUpdatedAt() const { return updatedAt; }
     time_t getExpiresAt() const { return expiresAt; }
@@ -67,6 +69,7 @@ public:
     void setNotes2(const std::string& newNotes2) { notes2 = newNotes2; updatedAt = time(nullptr); }
     void setNotes3(const std::string& newNotes3) { notes3 = newNotes3; updatedAt = time(nullptr); }
     void setLink(const std::string& newLink) { link = newLink; updatedAt = time(nullptr); }
+    void setAutoType(const std::string& newAutoType) { autoType = newAutoType; updatedAt = time(nullptr); }
     void setExpiresAt(time_t expiry) { expiresAt = expiry; updatedAt = time(nullptr); }
     void setCreatedAt(time_t created) { createdAt = created; }
     void setUpdatedAt(time_t updated) { updatedAt = updated; }
@@ -0,0 +1,44 @@
+#ifndef QR_BITMAP_H
+#define QR_BITMAP_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+// Modules of an encoded QR code, one bit each, row by row, set when dark
+class QrBitmap {
+private:
+    uint8_t size = 0; // modules per side, 0 when the value did not fit
+    uint32_t sourceHash = 0; // salted, tells an edited value from the cached one
+    std::vector<uint8_t> bits;
+
+public:
+    QrBitmap() = default;
+    QrBitmap(uint8_t size, uint32_t sourceHash)
+        : size(size), sourceHash(sourceHash), bits((size * size + 7) / 8, 0) {}
+
+    uint8_t getSize() const { return size; }
+    uint32_t getSourceHash() const { return sourceHash; }
+    bool empty() const { return size == 0; }
+
+    bool module(uint8_t x, uint8_t y) const {
+        size_t i = y * size + x;
+        return bits[i >> 3] & (0x80 >> (i & 7));
+    }
+
+    void setModule(uint8_t x, uint8_t y) {
+        size_t i = y * size + x;
+        bits[i >> 3] |= 0x80 >> (i & 7);
+    }
+
+    // The modules hold the secret, zeroed before the memory is released
+    void wipe() {
+        std::fill(bits.begin(), bits.end(), 0);
+        bits.clear();
+        size = 0;
+        sourceHash = 0;
+    }
+};
+
+#endif // QR_BITMAP_H
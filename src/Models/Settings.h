@@ -0,0 +1,40 @@
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <string>
+#include <cstdint>
+#include <cstring>
+
+// General settings, stored as a single NVS blob and compared byte for byte,
+// so the layout has no padding. Bump the version when it changes.
+struct Settings {
+    static const uint8_t CURRENT_VERSION = 1;
+
+    uint8_t version = CURRENT_VERSION;
+    uint8_t screenBrightness = 0;
+    uint8_t bleEnabled = 0;
+    uint8_t reserved = 0;
+    uint32_t screenTimeoutMs = 0;
+    uint32_t lockTimeoutMs = 0;
+    char keyboardLayout[24] = {}; // empty until chosen at first start
+    char unicodeInput[12] = {};
+    char bleDeviceName[32] = {};
+
+    // Truncated to fit, always terminated
+    static void copy(char* field, size_t size, const std::string& value) {
+        strncpy(field, value.c_str(), size - 1);
+        field[size - 1] = '\0';
+    }
+
+    bool operator==(const Settings& other) const {
+        return memcmp(this, &other, sizeof(Settings)) == 0;
+    }
+
+    bool operator!=(const Settings& other) const {
+        return !(*this == other);
+    }
+};
+
+static_assert(sizeof(Settings) == 80, "Settings is stored as is, keep it free of padding");
+
+#endif // SETTINGS_H
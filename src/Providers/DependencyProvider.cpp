@@ -11,7 +11,10 @@ DependencyProvider::DependencyProvider(IView& view, IInput& input)
       usbService(),
       bleService(),
       ledService(),
+      typingService(usbService, bleService),
+      qrService(),
       inactivityManager(view),
+      bleConnectionManager(bleService, nvsService),
       verticalSelector(view, input, inactivityManager),
       horizontalSelector(view, input, inactivityManager),
       fieldEditorSelector(view, input),
@@ -21,6 +24,7 @@ DependencyProvider::DependencyProvider(IView& view, IInput& input)
       jsonTransformer(),
       modelTransformer(),
       timeTransformer(),
+      autoTypeTransformer(),
       vaultController(view, input, horizontalSelector, verticalSelector, 
                       confirmationSelector, stringPromptSelector, sdService, 
                       nvsService, categoryService, entryService, cryptoService, 
@@ -30,11 +34,14 @@ DependencyProvider::DependencyProvider(IView& view, IInput& input)
                       usbService, ledService, nvsService, modelTransformer),
       utilityController(view, input, horizontalSelector, verticalSelector,  fieldEditorSelector, 
                         stringPromptSelector, confirmationSelector, usbService, bleService, ledService, nvsService,
-                        sdService, timeTransformer)
+                        sdService, typingService, qrService, timeTransformer, autoTypeTransformer, bleConnectionManager)
       {}
 
 void DependencyProvider::setup() {
+    PowerManager::getInstance().begin();
     view.initialize();
+    input.initialize();
+    inactivityManager.begin(input);
 }
 
 // Accessors for core components
@@ -54,11 +61,14 @@ NvsService& DependencyProvider::getNvsService() { return nvsService; }
 UsbService& DependencyProvider::getUsbService() { return usbService; }
 BleService& DependencyProvider::getBleService() { return bleService; }
 LedService& DependencyProvider::getLedService() { return ledService; }
+TypingService& DependencyProvider::getTypingService() { return typingService; }
+QrService& DependencyProvider::getQrService() { return qrService; }
 
 // Accessors for transformers
 JsonTransformer& DependencyProvider::getJsonTransformer() { return jsonTransformer; }
 ModelTransformer& DependencyProvider::getModelTransformer() { return modelTransformer; }
 TimeTransformer& DependencyProvider::getTimeTransformer() { return timeTransformer; }
+AutoTypeTransformer& DependencyProvider::getAutoTypeTransformer() { return autoTypeTransformer; }
 
 
 // Accessors for selectors
@@ -76,3 +86,4 @@ UtilityController& DependencyProvider::getUtilityController() { return utilityCo
 
 // Accessors for managers
 InactivityManager& DependencyProvider::getInactivityManager() { return inactivityManager; };
+BleConnectionManager& DependencyProvider::getBleConnectionManager() { return bleConnectionManager; };
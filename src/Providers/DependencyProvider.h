@@ -11,9 +11,12 @@
 #include "Services/UsbService.h"
 #include "Services/BleService.h"
 #include "Services/LedService.h"
+#include "Services/TypingService.h"
+#include "Services/QrService.h"
 #include "Transformers/JsonTransformer.h"
 #include "Transformers/ModelTransformer.h"
 #include "Transformers/TimeTransformer.h"
+#include "Transformers/AutoTypeTransformer.h"
 #include "Selectors/VerticalSelector.h"
 #include "Selectors/HorizontalSelector.h"
 #include "Selectors/FieldEditorSelector.h"
@@ -26,6 +29,8 @@
 #include "Controllers/EntryController.h"
 #include "Controllers/UtilityController.h"
 #include "Managers/InactivityManager.h"
+#include "Managers/BleConnectionManager.h"
+#include "Managers/PowerManager.h"
 
 class DependencyProvider {
 public:
@@ -49,11 +54,14 @@ public:
     UsbService& getUsbService();
     BleService& getBleService();
     LedService& getLedService();
+    TypingService& getTypingService();
+    QrService& getQrService();
 
     // Transformers
     JsonTransformer& getJsonTransformer();
     ModelTransformer& getModelTransformer();
     TimeTransformer& getTimeTransformer();
+    AutoTypeTransformer& getAutoTypeTransformer();
 
     // Selectors
     VerticalSelector& getVerticalSelector();
@@ -70,6 +78,7 @@ public:
 
     // Managers
     InactivityManager& getInactivityManager();
+    BleConnectionManager& getBleConnectionManager();
 
 private:
     IView& view;
@@ -88,11 +97,14 @@ private:
     UsbService usbService;
     BleService bleService;
     LedService ledService;
+    TypingService typingService;
+    QrService qrService;
 
     // Transformers
     JsonTransformer jsonTransformer;
     ModelTransformer modelTransformer;
     TimeTransformer timeTransformer;
+    AutoTypeTransformer autoTypeTransformer;
 
     // Selectors
     VerticalSelector verticalSelector;
@@ -109,6 +121,7 @@ private:
 
     // Managers
     InactivityManager inactivityManager;
+    BleConnectionManager bleConnectionManager;
 
 };
 
@@ -8,6 +8,9 @@ bool ConfirmationSelector::select(const std::string& title, const std::string& d
     display.topBar(title, false, false);
     display.confirmationPrompt(description);
     while (true) {
+        if (globalState.getVaultIsLocked()) {
+            return false;
+        }
         key = input.handler();
         if (key == KEY_OK) {
             return true;
@@ -15,6 +18,5 @@ bool ConfirmationSelector::select(const std::string& title, const std::string& d
         if (key == KEY_ESC_CUSTOM || key == KEY_ARROW_LEFT) {
             return false;
         }
-        delay(5);
     }
 }
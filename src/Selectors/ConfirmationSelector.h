@@ -4,6 +4,7 @@
 #include <string>
 #include <Inputs/IInput.h>
 #include <Views/IView.h>
+#include <States/GlobalState.h>
 #include <Arduino.h>
 
 class ConfirmationSelector {
@@ -14,6 +15,7 @@ public:
 private:
     IView& display;
     IInput& input;
+    GlobalState& globalState = GlobalState::getInstance();
 };
 
 #endif // CONFIRMATION_SELECTOR_H
@@ -34,6 +34,8 @@ ActionEnum FieldActionSelector::select(const std::string& label, const std::stri
                 return ActionEnum::SendToUsb;
             case 'm':
                 return ActionEnum::UpdateField;
+            case 'q':
+                return ActionEnum::ShowQr;
             case 'v':
                 if (isPasswordField) {
                     reveal = !reveal;
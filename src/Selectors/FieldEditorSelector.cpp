@@ -21,6 +21,9 @@ std::vector<std::string> FieldEditorSelector::select(const std::vector<std::stri
         }
         display.verticalSelection(displayLines, currentIndex);
 
+        if (globalState.getVaultIsLocked()) {
+            return fieldValues; // locked, edits dropped
+        }
         char key = input.handler();
 
         switch (key) {
@@ -5,6 +5,7 @@
 #include <vector>
 #include <Views/IView.h>
 #include <Inputs/IInput.h>
+#include <States/GlobalState.h>
 #include <cctype>
 
 class FieldEditorSelector {
@@ -17,6 +18,7 @@ public:
 private:
     IView& display;
     IInput& input;
+    GlobalState& globalState = GlobalState::getInstance();
 
     std::string processUserInput(const std::string& currentValue, char key);
 };
@@ -8,7 +8,7 @@ int HorizontalSelector::select(
     const std::vector<std::string>& options, 
     const std::string& description1, 
     const std::string& description2,
-    const std::vector<std::string>& icons,
+    const std::vector<IconEnum>& icons,
     bool handleInactivity) {
 
     int currentIndex = 0;
@@ -27,12 +27,16 @@ int HorizontalSelector::select(
 
         // Display the current options horizontally with the selection
         if (lastIndex != currentIndex) {
+            latency.stateChanged();
             display.horizontalSelection(options, currentIndex, description1, description2, icons);
             lastIndex = currentIndex;
         }
 
         // Capture user input
         char key = input.handler();
+        if (handleInactivity && key == KEY_LOCK) {
+            return -1;
+        }
 
         if (handleInactivity && key != KEY_NONE) {
             inactivityManager.reset();
@@ -7,16 +7,18 @@
 #include <Inputs/IInput.h>
 #include <Enums/IconEnum.h>
 #include <Managers/InactivityManager.h>
+#include <Managers/LatencyManager.h>
 
 class HorizontalSelector {
 public:
     HorizontalSelector(IView& display, IInput& input, InactivityManager& inactivityManager);
-    int select(const std::string& title, const std::vector<std::string>& options, const std::string& description1="", const std::string& description2="", const std::vector<std::string>& icons={}, bool handleInactivity=true);
+    int select(const std::string& title, const std::vector<std::string>& options, const std::string& description1="", const std::string& description2="", const std::vector<IconEnum>& icons={}, bool handleInactivity=true);
 
 private:
     IView& display;
     IInput& input;
     InactivityManager& inactivityManager;
+    LatencyManager& latency = LatencyManager::getInstance();
 };
 
 #endif // HORIZONTAL_SELECTOR_H
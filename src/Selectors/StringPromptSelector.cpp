@@ -3,7 +3,7 @@
 StringPromptSelector::StringPromptSelector(IView& display, IInput& input)
     : display(display), input(input) {}
 
-std::string StringPromptSelector::select(
+std::optional<std::string> StringPromptSelector::select(
     const std::string& title, 
     const std::string& label, 
     const std::string& value, 
@@ -13,42 +13,60 @@ std::string StringPromptSelector::select(
     size_t minLength, 
     bool autoDelete
 ) {
-    std::string output = value;
+    EditBuffer buffer(value, getMaxInputLimit(maxInput));
     char key = KEY_NONE;
-    size_t limit = getMaxInputLimit(maxInput);
 
     display.topBar(title, false, false);
-    display.stringPrompt(label, output, backButton, minLength);
+    display.stringPrompt(label, buffer.text(), backButton, minLength, buffer.cursor());
 
     while (true) {
+        if (globalState.getVaultIsLocked()) {
+            return std::nullopt; // locked, even without a back button
+        }
         key = input.handler();
+        bool changed = false;
 
-        if (key == KEY_OK && output.length() >= minLength) {
+        if (key == KEY_OK && buffer.size() >= minLength) {
             break; // confirm if minLength
         }
         if ((key == KEY_ARROW_LEFT || key == KEY_ESC_CUSTOM) && backButton) {
-            return ""; // return
-        }
-        if (key == KEY_DEL && !output.empty()) {
-            if (autoDelete) {
-                output = "";
-                autoDelete = false;
-            } else {
-                output.pop_back();
-            }
+            return std::nullopt; // return
         }
-        else if ((isalnumOnly ? std::isalnum(key) : std::isprint(key)) && output.size() < limit) {
-            output += key;
-            autoDelete = false;
+
+        switch (key) {
+            case KEY_NONE:
+            case KEY_OK:
+                break;
+            case KEY_DEL:
+                if (autoDelete && !buffer.empty()) {
+                    buffer.clear();
+                    changed = true;
+                } else {
+                    changed = buffer.backspace();
+                }
+                break;
+            case KEY_DEL_FORWARD: changed = buffer.deleteForward(); break;
+            case KEY_CURSOR_LEFT: changed = buffer.moveLeft(); break;
+            case KEY_CURSOR_RIGHT: changed = buffer.moveRight(); break;
+            case KEY_WORD_LEFT: changed = buffer.wordLeft(); break;
+            case KEY_WORD_RIGHT: changed = buffer.wordRight(); break;
+            case KEY_CURSOR_HOME: changed = buffer.home(); break;
+            case KEY_CURSOR_END: changed = buffer.end(); break;
+            default:
+                if (isalnumOnly ? std::isalnum(key) : std::isprint(key)) {
+                    changed = buffer.insert(key);
+                }
+                break;
         }
 
-        if (key != KEY_NONE) {
-            display.stringPrompt(label, output, backButton, minLength);  
+        if (changed) {
+            autoDelete = false; // the suggested value is being edited
+            latency.stateChanged();
+            display.stringPrompt(label, buffer.text(), backButton, minLength, buffer.cursor());
         }
-        delay(5);
     }
 
-    return output;
+    return buffer.text();
 }
 
 size_t StringPromptSelector::getMaxInputLimit(bool password) const {
@@ -3,22 +3,27 @@
 
 #include <Arduino.h>
 #include <cctype>
+#include <optional>
 #include <string>
 #include <Inputs/IInput.h>
+#include <Inputs/EditBuffer.h>
 #include <Views/IView.h>
 #include <States/GlobalState.h>
+#include <Managers/LatencyManager.h>
 
 
 class StringPromptSelector {
 public:
     StringPromptSelector(IView& display, IInput& input);
 
-    std::string select(const std::string& title, const std::string& label, const std::string& value = "", bool backButton = true, bool maxInput = false, bool isalnumOnly=false, size_t minLength=3, bool autoDelete=false);
+    // Empty when the prompt is left, with back or by the lock
+    std::optional<std::string> select(const std::string& title, const std::string& label, const std::string& value = "", bool backButton = true, bool maxInput = false, bool isalnumOnly=false, size_t minLength=3, bool autoDelete=false);
 
 private:
     IView& display;
     IInput& input;
     GlobalState& globalState = GlobalState::getInstance();
+    LatencyManager& latency = LatencyManager::getInstance();
     size_t getMaxInputLimit(bool password) const;
 };
 
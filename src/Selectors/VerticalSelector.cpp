@@ -15,15 +15,37 @@ int VerticalSelector::select(
         const std::vector<std::string>& shortcuts, 
         bool visibleMention,
         bool handleInactivity) 
+{
+    VectorListSource vectorSource(options);
+    return select(title, vectorSource, subMenu, searchBar, options2, shortcuts, visibleMention, handleInactivity);
+}
+
+int VerticalSelector::select(
+        const std::string& title, 
+        const IListSource& listSource, 
+        bool subMenu, 
+        bool searchBar, 
+        const std::vector<std::string>& options2,
+        const std::vector<std::string>& shortcuts, 
+        bool visibleMention,
+        bool handleInactivity) 
 {
     int currentIndex = 0;
     int lastIndex = -1;
     int lastQuerySize = 0;
     char key = KEY_NONE;
     std::string searchQuery;
-    std::vector<std::string> filteredOptions = options;
+    source = &listSource;
+    filteredRows.clear();
+    filterActive = false;
     inactivityManager.reset();
 
+    // Only the visible page is materialized for the view
+    std::vector<std::string> pageRows;
+    std::vector<std::string> pageLabels;
+    std::vector<std::string> pageShortcuts;
+    pageRows.reserve(visibleRows);
+
     while (true) {
         // Inactivity
         if (handleInactivity) {
@@ -33,14 +55,39 @@ int VerticalSelector::select(
 
         // Display the current options and selection
         if (lastIndex != currentIndex || lastQuerySize != searchQuery.size()) {
-            display.topBar(searchQuery.empty() ? title : searchQuery, subMenu, searchBar);
-            display.verticalSelection(filteredOptions, currentIndex, 4, options2, shortcuts, visibleMention);
+            latency.stateChanged();
+
+            // Top bar only changes with the search text
+            if (lastIndex == -1 || lastQuerySize != searchQuery.size()) {
+                display.topBar(searchQuery.empty() ? title : searchQuery, subMenu, searchBar);
+            }
+
+            size_t pageStart = currentIndex / visibleRows * visibleRows;
+            size_t pageEnd = std::min(pageStart + visibleRows, rowCount());
+            pageRows.clear();
+            pageLabels.clear();
+            pageShortcuts.clear();
+            for (size_t i = pageStart; i < pageEnd; ++i) {
+                size_t row = rowAt(i);
+                pageRows.push_back(source->label(row));
+                if (row < options2.size()) {
+                    pageLabels.push_back(options2[row]);
+                }
+                if (row < shortcuts.size()) {
+                    pageShortcuts.push_back(shortcuts[row]);
+                }
+            }
+
+            display.verticalSelection(pageRows, currentIndex - pageStart, visibleRows, pageLabels, pageShortcuts, visibleMention);
             lastIndex = currentIndex;
             lastQuerySize = searchQuery.size();
         }
 
         // Capture user input
         key = input.handler();
+        if (handleInactivity && key == KEY_LOCK) {
+            return -1;
+        }
 
         if (handleInactivity && key != KEY_NONE) {
             inactivityManager.reset();
@@ -56,16 +103,16 @@ int VerticalSelector::select(
 
         switch (key) {
             case KEY_ARROW_UP:
-                currentIndex = (currentIndex > 0) ? currentIndex - 1 : filteredOptions.size() - 1;
+                if (rowCount() == 0) {break;}
+                currentIndex = (currentIndex > 0) ? currentIndex - 1 : rowCount() - 1;
                 break;
             case KEY_ARROW_DOWN:
-                currentIndex = (currentIndex < filteredOptions.size() - 1) ? currentIndex + 1 : 0;
+                if (rowCount() == 0) {break;}
+                currentIndex = (currentIndex < static_cast<int>(rowCount()) - 1) ? currentIndex + 1 : 0;
                 break;
             case KEY_OK:
-                for (size_t i = 0; i < options.size(); ++i) {
-                    if (options[i] == filteredOptions[currentIndex]) {
-                        return i;
-                    }
+                if (rowCount() > 0) {
+                    return source->id(rowAt(currentIndex));
                 }
                 break;
             case KEY_ESC_CUSTOM:
@@ -74,16 +121,14 @@ int VerticalSelector::select(
             case KEY_DEL: // Backspace for text search
                 if (searchBar && !searchQuery.empty()) {
                     searchQuery.pop_back();
-                    filteredOptions = filterOptions(options, searchQuery);
+                    filterRows(searchQuery, false);
                     currentIndex = 0;
-                } else {
-                    filteredOptions = options;
                 }
                 break;
             default:
                 if (searchBar && std::isalnum(key)) {
                     searchQuery += key;
-                    filteredOptions = filterOptions(options, searchQuery);
+                    filterRows(searchQuery, true); // a longer query only narrows the rows
                     currentIndex = 0;
                 }
                 
@@ -92,21 +137,55 @@ int VerticalSelector::select(
     }
 }
 
-std::string VerticalSelector::toLowerCase(const std::string& input) {
-    std::string result = input;
-    std::transform(result.begin(), result.end(), result.begin(), ::tolower);
-    return result;
+size_t VerticalSelector::rowCount() const {
+    return filterActive ? filteredRows.size() : source->size();
 }
 
-std::vector<std::string> VerticalSelector::filterOptions(const std::vector<std::string>& options, const std::string& query) {
-    std::vector<std::string> filtered;
+size_t VerticalSelector::rowAt(size_t index) const {
+    return filterActive ? filteredRows[index] : index;
+}
+
+void VerticalSelector::filterRows(const std::string& query, bool narrow) {
+    if (query.empty()) {
+        filteredRows.clear();
+        filterActive = false;
+        return;
+    }
+
     std::string lowerQuery = toLowerCase(query);
-    for (const auto& option : options) {
-        if (toLowerCase(option).find(lowerQuery) != std::string::npos) {
-            filtered.push_back(option);
+    std::vector<uint16_t> rows;
+
+    if (narrow && filterActive) {
+        for (auto row : filteredRows) {
+            if (containsIgnoreCase(source->label(row), lowerQuery)) {
+                rows.push_back(row);
+            }
+        }
+    } else {
+        for (size_t row = 0; row < source->size(); ++row) {
+            if (containsIgnoreCase(source->label(row), lowerQuery)) {
+                rows.push_back(row);
+            }
         }
     }
-    return filtered;
+
+    filteredRows.swap(rows);
+    filterActive = true;
+}
+
+bool VerticalSelector::containsIgnoreCase(const std::string& text, const std::string& lowerQuery) const {
+    auto it = std::search(
+        text.begin(), text.end(),
+        lowerQuery.begin(), lowerQuery.end(),
+        [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; }
+    );
+    return it != text.end() || lowerQuery.empty();
+}
+
+std::string VerticalSelector::toLowerCase(const std::string& input) {
+    std::string result = input;
+    std::transform(result.begin(), result.end(), result.begin(), ::tolower);
+    return result;
 }
 
 int VerticalSelector::checkShortcut(const std::vector<std::string>& shortcuts, char key) {
@@ -117,4 +196,3 @@ int VerticalSelector::checkShortcut(const std::vector<std::string>& shortcuts, c
     }
     return -1; // Aucun raccourci correspondant trouvé
 }
-
@@ -6,23 +6,38 @@
 #include <vector>
 #include <Views/IView.h>
 #include <Inputs/IInput.h>
+#include <Lists/IListSource.h>
+#include <Lists/VectorListSource.h>
 #include <States/GlobalState.h>
 #include <Managers/InactivityManager.h>
+#include <Managers/LatencyManager.h>
 
 class VerticalSelector {
 public:
     VerticalSelector(IView& display, IInput& input, InactivityManager& inactivityManager);
     int select(const std::string& title, const std::vector<std::string>& options, bool subMenu = false, bool searchBar = false,  const std::vector<std::string>& options2={},  const std::vector<std::string>& shortcuts={}, bool visibleMention=false, bool handleInactivity=true);
+    int select(const std::string& title, const IListSource& source, bool subMenu = false, bool searchBar = false,  const std::vector<std::string>& options2={},  const std::vector<std::string>& shortcuts={}, bool visibleMention=false, bool handleInactivity=true);
 
 private:
+    static const size_t visibleRows = 4;
+
     IView& display;
     IInput& input;
     InactivityManager& inactivityManager;
 
+    // Filtered rows, as source indexes
+    const IListSource* source = nullptr;
+    std::vector<uint16_t> filteredRows;
+    bool filterActive = false;
+
+    size_t rowCount() const;
+    size_t rowAt(size_t index) const;
+    void filterRows(const std::string& query, bool narrow);
+    bool containsIgnoreCase(const std::string& text, const std::string& lowerQuery) const;
     std::string toLowerCase(const std::string& input);
-    std::vector<std::string> filterOptions(const std::vector<std::string>& options, const std::string& query);
     int checkShortcut(const std::vector<std::string>& shortcuts, char key);
     GlobalState& globalState = GlobalState::getInstance();
+    LatencyManager& latency = LatencyManager::getInstance();
 };
 
 #endif // VERTICAL_SELECTOR_H
@@ -14,6 +14,10 @@ void BleService::setLayout(const uint8_t* newLayout) {
     }
 }
 
+void BleService::setUnicodeInput(codepoints::UnicodeInput input) {
+    keyboard.setUnicodeInput(input);
+}
+
 void BleService::setDeviceName(const std::string& name) {
     deviceName = name;
     if (!initialized) {
@@ -21,6 +25,22 @@ void BleService::setDeviceName(const std::string& name) {
     }
 }
 
+void BleService::setTypingDelay(uint32_t ms) {
+    keyboard.setDelay(ms);
+}
+
+std::string BleService::getPeerAddress() const {
+    return keyboard.getPeerAddress();
+}
+
+void BleService::setDirectedPeer(const std::string& address) {
+    keyboard.setDirectedPeer(address);
+}
+
+void BleService::onConnectionChange(std::function<void(bool connected)> callback) {
+    keyboard.onConnectionChange(callback);
+}
+
 void BleService::begin() {
     if (initialized) {
         return;
@@ -48,50 +68,51 @@ bool BleService::isReady() const {
     return initialized && keyboard.isConnected();
 }
 
-void BleService::sendString(const std::string& text) {
+bool BleService::sendString(const std::string& text) {
     if (!initialized) {
-        return;
+        return false;
     }
 
-    const unsigned long connectionTimeoutMs = 5000;
-    unsigned long start = millis();
-    while (!keyboard.isConnected() && (millis() - start < connectionTimeoutMs)) {
-        delay(50);
+    // The connection is kept in the background, never wait for a host here
+    if (!keyboard.isConnected()) {
+        return false;
     }
 
-    if (!keyboard.isConnected()) {
+    // Queued, the reports are notified in the background
+    keyboard.releaseAll();
+    keyboard.clearWriteError();
+    keyboard.write(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+    return !keyboard.getWriteError();
+}
+
+void BleService::sendKey(uint8_t key) {
+    if (!initialized || !keyboard.isConnected()) {
         return;
     }
 
-    keyboard.releaseAll();
-    for (const char& c : text) {
-        keyboard.write(static_cast<uint8_t>(c));
+    // press() notifies directly, let the queued text go first
+    while (keyboard.isSending()) {
+        delay(5);
     }
+    keyboard.write(key);
 }
 
-void BleService::clearBonds() {
-#if defined(USE_NIMBLE)
-    NimBLEDevice::deleteAllBonds();
-#endif
+bool BleService::isSending() const {
+    return initialized && keyboard.isSending();
 }
 
-void BleService::sendChunkedString(const std::string& data, size_t chunkSize, unsigned long delayBetweenChunks) {
-    size_t totalLength = data.length();
-    size_t sentLength = 0;
-
-    while (sentLength < totalLength) {
-        size_t remainingLength = totalLength - sentLength;
-        size_t currentChunkSize = (remainingLength > chunkSize) ? chunkSize : remainingLength;
+void BleService::cancelSending() {
+    if (initialized) {
+        keyboard.cancelTyping();
+    }
+}
 
-        std::string chunk = data.substr(sentLength, currentChunkSize);
-        sendString(chunk);
+uint32_t BleService::getCharsPerSecond() const {
+    return keyboard.getCharsPerSecond();
+}
 
-        sentLength += currentChunkSize;
-        if (!keyboard.isConnected()) {
-            break;
-        }
-        if (sentLength < totalLength) {
-            delay(delayBetweenChunks);
-        }
-    }
+void BleService::clearBonds() {
+#if defined(USE_NIMBLE)
+    NimBLEDevice::deleteAllBonds();
+#endif
 }
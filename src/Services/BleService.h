@@ -4,18 +4,27 @@
 #include <Arduino.h>
 #include <BleKeyboard.h>
 #include <string>
+#include <functional>
 
 class BleService {
 public:
     BleService();
     void begin();
     void end();
-    void sendString(const std::string& text);
-    void sendChunkedString(const std::string& data, size_t chunkSize = 128, unsigned long delayBetweenChunks = 50);
+    bool sendString(const std::string& text); // false when some characters were not queued
+    void sendKey(uint8_t key); // KEY_ESC..., after the queued text
     bool isReady() const;
     bool isConnected() const;
+    bool isSending() const;
+    void cancelSending(); // queued text dropped, keys released
+    uint32_t getCharsPerSecond() const; // last text sent
     void setLayout(const uint8_t* newLayout);
+    void setUnicodeInput(codepoints::UnicodeInput input); // chars missing from the layout
     void setDeviceName(const std::string& name);
+    void setTypingDelay(uint32_t ms);
+    std::string getPeerAddress() const; // connected host, empty when none
+    void setDirectedPeer(const std::string& address);
+    void onConnectionChange(std::function<void(bool connected)> callback);
     void clearBonds();
 
 private:
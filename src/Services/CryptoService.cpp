@@ -36,6 +36,7 @@ std::string CryptoService::generateRandomString(size_t length) {
 
 std::vector<uint8_t> CryptoService::deriveKeyFromPassphrase(const std::string& passphrase, const std::string& salt, size_t keySize) {
     std::vector<uint8_t> key(keySize);
+    PowerManager::Hold boost(PowerLock::CpuMax); // PBKDF2 dominates unlock time
 
     mbedtls_md_context_t mdContext;
     mbedtls_md_init(&mdContext);
@@ -10,6 +10,7 @@
 #include <mbedtls/ctr_drbg.h>
 #include <mbedtls/pkcs5.h>
 #include <States/GlobalState.h>
+#include <Managers/PowerManager.h>
 
 class CryptoService {
 public:
@@ -64,6 +64,8 @@ bool EntryService::updateField(Entry& entry, const Field& field) {
         entry.setPassword(newValue);
     } else if (fieldName == "Note") {
         entry.setNotes(newValue);
+    } else if (fieldName == "Auto") {
+        entry.setAutoType(newValue);
     }  else {
         return false;
     }
@@ -26,6 +26,17 @@ int NvsService::getInt(const std::string& key, int defaultValue) {
     return preferences.getInt(key.c_str(), defaultValue);
 }
 
+void NvsService::saveBytes(const std::string& key, const void* data, size_t size) {
+    preferences.putBytes(key.c_str(), data, size);
+}
+
+size_t NvsService::getBytes(const std::string& key, void* data, size_t size) {
+    if (preferences.getBytesLength(key.c_str()) != size) {
+        return 0;
+    }
+    return preferences.getBytes(key.c_str(), data, size);
+}
+
 void NvsService::remove(const std::string& key) {
     preferences.remove(key.c_str());
 }
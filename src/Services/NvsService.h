@@ -18,6 +18,10 @@ public:
     void saveInt(const std::string& key, int value);
     int getInt(const std::string& key, int defaultValue = 0);
 
+    // Read/write blob, 0 read when missing or of another size
+    void saveBytes(const std::string& key, const void* data, size_t size);
+    size_t getBytes(const std::string& key, void* data, size_t size);
+
     // Utils
     void remove(const std::string& key);
     void clearNamespace();
@@ -0,0 +1,74 @@
+#include "QrService.h"
+#include <lgfx/utility/lgfx_qrcode.h>
+#include <esp_random.h>
+#include <vector>
+
+QrService::QrService() : salt(esp_random()) {}
+
+QrService::~QrService() {
+    wipe();
+}
+
+const QrBitmap& QrService::encode(const std::string& key, const std::string& value) {
+    uint32_t hash = hashOf(value);
+    auto it = cache.find(key);
+    if (it != cache.end() && it->second.getSourceHash() == hash) {
+        return it->second;
+    }
+
+    if (it != cache.end()) {
+        it->second.wipe();
+    }
+    QrBitmap& bitmap = cache[key];
+    bitmap = build(value, hash);
+    return bitmap;
+}
+
+void QrService::wipe() {
+    for (auto& entry : cache) {
+        entry.second.wipe();
+    }
+    cache.clear();
+    salt = esp_random();
+}
+
+size_t QrService::cachedCount() const {
+    return cache.size();
+}
+
+QrBitmap QrService::build(const std::string& value, uint32_t hash) {
+    // Smallest version that holds the value, low correction keeps the modules big
+    for (uint8_t version = 1; 4 * version + 17 <= MAX_MODULES; version++) {
+        std::vector<uint8_t> buffer(lgfx_qrcode_getBufferSize(version));
+        QRCode qrcode;
+        QrBitmap bitmap;
+        if (lgfx_qrcode_initText(&qrcode, buffer.data(), version, 0, value.c_str()) == 0) {
+            bitmap = QrBitmap(qrcode.size, hash);
+            for (uint8_t y = 0; y < qrcode.size; y++) {
+                for (uint8_t x = 0; x < qrcode.size; x++) {
+                    if (lgfx_qrcode_getModule(&qrcode, x, y)) {
+                        bitmap.setModule(x, y);
+                    }
+                }
+            }
+        }
+
+        std::fill(buffer.begin(), buffer.end(), 0);
+        if (!bitmap.empty()) {
+            return bitmap;
+        }
+    }
+    return QrBitmap();
+}
+
+// FNV-1a of the salt then the value
+uint32_t QrService::hashOf(const std::string& value) const {
+    uint32_t hash = 2166136261u;
+    for (int shift = 0; shift < 32; shift += 8) {
+        hash = (hash ^ ((salt >> shift) & 0xFF)) * 16777619u;
+    }
+    for (unsigned char c : value) {
+        hash = (hash ^ c) * 16777619u;
+    }
+    return hash;
+}
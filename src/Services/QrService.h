@@ -0,0 +1,30 @@
+#ifndef QR_SERVICE_H
+#define QR_SERVICE_H
+
+#include <map>
+#include <string>
+#include <Models/QrBitmap.h>
+
+// Encodes field values as QR codes for a phone to scan. Bitmaps are kept
+// for the session so showing a field again only blits it, and wiped on lock.
+class QrService {
+public:
+    static const uint8_t MAX_MODULES = 125; // version 27, one pixel per module fills the 135 px panel height
+
+    QrService();
+    ~QrService();
+
+    // Cached per key, encoded again when the value changed. Empty when too long
+    const QrBitmap& encode(const std::string& key, const std::string& value);
+    void wipe(); // also a new salt, the old hashes mean nothing
+    size_t cachedCount() const;
+
+private:
+    std::map<std::string, QrBitmap> cache;
+    uint32_t salt = 0; // random per session, a cached hash can't be matched to a guess offline
+
+    static QrBitmap build(const std::string& value, uint32_t hash);
+    uint32_t hashOf(const std::string& value) const;
+};
+
+#endif // QR_SERVICE_H
@@ -96,6 +96,7 @@ std::vector<uint8_t> SdService::readBinaryFile(const std::string& filePath) {
         return content;
     }
 
+    PowerManager::Hold bus(PowerLock::Bus);
     File file = SD.open(filePath.c_str(), FILE_READ);
     if (file) {
         content.reserve(file.size());
@@ -113,6 +114,7 @@ std::string SdService::readFile(const std::string& filePath) {
         return content;
     }
 
+    PowerManager::Hold bus(PowerLock::Bus);
     File file = SD.open(filePath.c_str());
     if (file) {
         while (file.available()) {
@@ -128,6 +130,7 @@ bool SdService::writeFile(const std::string& filePath, const std::string& data)
         return false;
     }
 
+    PowerManager::Hold bus(PowerLock::Bus);
     File file = SD.open(filePath.c_str(), FILE_WRITE);
     if (file) {
         file.write(reinterpret_cast<const uint8_t*>(data.c_str()), data.size());
@@ -142,6 +145,7 @@ bool SdService::writeBinaryFile(const std::string& filePath, const std::vector<u
         return false;
     }
 
+    PowerManager::Hold bus(PowerLock::Bus);
     File file = SD.open(filePath.c_str(), FILE_WRITE);
     if (file) {
         file.write(data.data(), data.size());
@@ -156,6 +160,7 @@ bool SdService::appendToFile(const std::string& filePath, const std::string& dat
         return false;
     }
 
+    PowerManager::Hold bus(PowerLock::Bus);
     File file = SD.open(filePath.c_str(), FILE_APPEND);
     if (file) {
         file.write(reinterpret_cast<const uint8_t*>(data.c_str()), data.size());
@@ -7,6 +7,7 @@
 #include <string>
 #include <unordered_map>
 #include <States/GlobalState.h>
+#include <Managers/PowerManager.h>
 
 class SdService {
 private:
@@ -0,0 +1,229 @@
+#include "TypingService.h"
+#include <algorithm>
+
+TypingService::TypingService(UsbService& usbService, BleService& bleService)
+    : usbService(usbService), bleService(bleService) {}
+
+bool TypingService::start(const std::string& value, bool ble) {
+    if (busy) {
+        return false;
+    }
+
+    text = value;
+    steps.assign(1, {AutoTypeOp::Text, 0, text.size()});
+    begin(ble);
+    return true;
+}
+
+bool TypingService::start(const AutoTypeProgram& program, const std::string* const fields[4], bool ble) {
+    if (busy) {
+        return false;
+    }
+
+    // Sized up front, a reallocation would leave a copy of the password behind
+    size_t size = 0;
+    for (const auto& step : program.steps) {
+        if (step.op == AutoTypeOp::Text) {
+            size += step.length;
+        } else if (step.op == AutoTypeOp::Field) {
+            size += fields[step.arg]->size();
+        }
+    }
+    text.clear();
+    text.reserve(size);
+    steps.clear();
+
+    for (const auto& step : program.steps) {
+        switch (step.op) {
+            case AutoTypeOp::Text:
+                text.append(program.literals, step.arg, step.length);
+                break;
+            case AutoTypeOp::Field:
+                text += *fields[step.arg];
+                break;
+            case AutoTypeOp::Key:
+            case AutoTypeOp::Delay:
+                steps.push_back({step.op, step.arg, 0});
+                continue;
+        }
+
+        // Text and fields between two keys or delays go out as one run
+        if (!steps.empty() && steps.back().op == AutoTypeOp::Text) {
+            steps.back().end = text.size();
+        } else {
+            steps.push_back({AutoTypeOp::Text, 0, text.size()});
+        }
+    }
+
+    begin(ble);
+    return true;
+}
+
+void TypingService::begin(bool ble) {
+    overBle = ble;
+    typedBytes = 0;
+    complete = false;
+    partial = false;
+    paused = false;
+    cancelRequested = false;
+    busy = true;
+
+    // Same core as the BLE stack, the UI loop keeps core 1
+    if (!task) {
+        xTaskCreatePinnedToCore(typingLoop, "typing", 4096, this, 1, &task, 0);
+    }
+    xTaskNotifyGive(task);
+}
+
+void TypingService::pause() {
+    paused = true;
+}
+
+void TypingService::resume() {
+    paused = false;
+}
+
+void TypingService::cancel() {
+    if (!busy) {
+        return;
+    }
+    cancelRequested = true;
+
+    // Nothing is typed from the UI task on USB, the job releases the keys itself
+    if (overBle) {
+        bleService.cancelSending();
+    }
+}
+
+bool TypingService::isBusy() const {
+    return busy;
+}
+
+bool TypingService::isPaused() const {
+    return paused;
+}
+
+bool TypingService::isComplete() const {
+    return !busy && complete;
+}
+
+bool TypingService::isPartial() const {
+    return !busy && partial;
+}
+
+uint8_t TypingService::getProgress() const {
+    size_t total = text.size();
+    return total ? static_cast<uint8_t>(typedBytes * 100 / total) : 100;
+}
+
+void TypingService::typingLoop(void* arg) {
+    TypingService* self = static_cast<TypingService*>(arg);
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        self->run();
+    }
+}
+
+void TypingService::run() {
+    PowerManager::Hold boost(PowerLock::CpuMax); // bulk typing keeps HID report pacing tight
+    size_t position = 0;
+
+    for (const Step& step : steps) {
+        if (cancelRequested) {
+            break;
+        }
+        switch (step.op) {
+            case AutoTypeOp::Text:
+                typeText(position, step.end);
+                break;
+            case AutoTypeOp::Key:
+                sendKey(step.arg);
+                break;
+            case AutoTypeOp::Delay:
+                wait(step.arg);
+                break;
+            case AutoTypeOp::Field:
+                break; // resolved into text by start()
+        }
+    }
+
+    // Again on BLE, a chunk may have been queued while cancel() flushed
+    if (cancelRequested) {
+        overBle ? bleService.cancelSending() : usbService.releaseAll();
+    }
+
+    // Size kept for the progress, content wiped
+    complete = !cancelRequested && !partial;
+    std::fill(text.begin(), text.end(), '\0');
+    busy = false;
+}
+
+void TypingService::typeText(size_t& position, size_t end) {
+    while (position < end && !cancelRequested) {
+        if (paused) {
+            delay(20);
+            continue;
+        }
+
+        size_t next = chunkEnd(text, position, end);
+        std::string chunk = text.substr(position, next - position);
+        if (overBle) {
+            // One chunk queued at a time, so pause and progress follow what the host got
+            if (!bleService.sendString(chunk)) {
+                partial = true; // missing from the layout, or the host went away
+            }
+            while (bleService.isSending() && !cancelRequested) {
+                delay(5);
+            }
+        } else {
+            if (!usbService.sendString(chunk)) {
+                partial = true;
+            }
+            if (!usbService.isReady()) {
+                cancelRequested = true; // unplugged, or never mounted
+            }
+        }
+        std::fill(chunk.begin(), chunk.end(), '\0');
+
+        position = next;
+        typedBytes = position;
+    }
+}
+
+void TypingService::sendKey(uint8_t key) {
+    while (paused && !cancelRequested) {
+        delay(20);
+    }
+    if (cancelRequested) {
+        return;
+    }
+
+    if (overBle) {
+        bleService.sendKey(key);
+    } else {
+        usbService.sendKey(key);
+        if (!usbService.isReady()) {
+            cancelRequested = true;
+        }
+    }
+}
+
+// The text before it is already typed, chunks wait for the host
+void TypingService::wait(uint32_t ms) {
+    uint32_t start = millis();
+    while (millis() - start < ms && !cancelRequested) {
+        delay(20);
+    }
+}
+
+// Chunks end on a UTF-8 character boundary
+size_t TypingService::chunkEnd(const std::string& text, size_t start, size_t limit) {
+    size_t end = start;
+    for (size_t chars = 0; chars < chunkChars && end < limit; chars++) {
+        end++;
+        while (end < limit && (static_cast<uint8_t>(text[end]) & 0xC0) == 0x80) {
+            end++;
+        }
+    }
+    return end;
+}
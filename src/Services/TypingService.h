@@ -0,0 +1,66 @@
+#ifndef TYPING_SERVICE_H
+#define TYPING_SERVICE_H
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+#include <Models/AutoTypeProgram.h>
+#include <Services/UsbService.h>
+#include <Services/BleService.h>
+#include <Managers/PowerManager.h>
+
+// Types a text from a background task, a few characters at a time so the
+// UI can show the progress, pause or cancel between two chunks
+class TypingService {
+public:
+    TypingService(UsbService& usbService, BleService& bleService);
+
+    bool start(const std::string& text, bool overBle); // false while a job runs
+    // Auto-type, fields holds the values indexed by AutoTypeField
+    bool start(const AutoTypeProgram& program, const std::string* const fields[4], bool overBle);
+    void pause();
+    void resume();
+    void cancel(); // keys released right away on BLE, after the current chunk on USB
+
+    bool isBusy() const;
+    bool isPaused() const;
+    bool isComplete() const; // last job typed to the end
+    bool isPartial() const; // last job skipped characters it could not type
+    uint8_t getProgress() const; // percent of the last job
+
+    static const size_t chunkChars = 8; // a few ms of typing, bounds the cancel latency
+    // End of the chunk starting at start, never inside a UTF-8 character
+    static size_t chunkEnd(const std::string& text, size_t start, size_t limit);
+
+private:
+
+    // Fields are resolved into text when the job starts
+    struct Step {
+        AutoTypeOp op;
+        uint16_t arg; // key code or delay
+        size_t end;   // Text: the run ends here in text
+    };
+
+    UsbService& usbService;
+    BleService& bleService;
+
+    std::string text; // wiped when the job ends
+    std::vector<Step> steps;
+    bool overBle = false;
+    volatile size_t typedBytes = 0;
+    volatile bool busy = false;
+    volatile bool complete = false;
+    volatile bool partial = false;
+    volatile bool paused = false;
+    volatile bool cancelRequested = false;
+    TaskHandle_t task = nullptr;
+
+    static void typingLoop(void* arg);
+    void begin(bool ble);
+    void run();
+    void typeText(size_t& position, size_t end);
+    void sendKey(uint8_t key);
+    void wait(uint32_t ms);
+};
+
+#endif // TYPING_SERVICE_H
@@ -1,18 +1,45 @@
 #include "UsbService.h"
 
+volatile bool UsbService::mounted = false;
+
 UsbService::UsbService() 
-    : keyboard(), layout(KeyboardLayout_en_US), initialized(false), initTime(0) {}
+    : keyboard(), layout(KeyboardLayout_en_US), initialized(false) {}
 
 void UsbService::setLayout(const uint8_t* newLayout) {
     layout = newLayout;
+    keyboard.setLayout(layout); // no need to init again
+}
+
+void UsbService::setUnicodeInput(codepoints::UnicodeInput input) {
+    keyboard.setUnicodeInput(input);
 }
 
 void UsbService::begin() {
     if (!initialized) {
-        USB.begin();
+        USB.onEvent(onUsbEvent);
         keyboard.begin(layout);
+        USB.begin(); // the host enumerates in the background
         initialized = true;
-        initTime = millis(); // HID needs approx 1.5sec to initialize
+    }
+}
+
+void UsbService::onUsbEvent(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    if (base != ARDUINO_USB_EVENTS) {
+        return;
+    }
+    switch (id) {
+        case ARDUINO_USB_STARTED_EVENT:
+        case ARDUINO_USB_RESUME_EVENT:
+            mounted = true;
+            GlobalState::getInstance().setUsbConnected(true);
+            break;
+        case ARDUINO_USB_SUSPEND_EVENT:
+            mounted = false; // still cabled, the host may resume it
+            break;
+        case ARDUINO_USB_STOPPED_EVENT:
+            mounted = false;
+            GlobalState::getInstance().setUsbConnected(false);
+            break;
     }
 }
 
@@ -20,34 +47,29 @@ void UsbService::end() {
     keyboard.end();
 }
 
-void UsbService::sendString(const std::string& text) {
-    // We wait 1.5sec for hid init
-    while (millis() - initTime < 1500) {
+bool UsbService::sendString(const std::string& text) {
+    // Enumerated since boot, only a cable plugged just now waits for the host
+    unsigned long start = millis();
+    while (!mounted && millis() - start < mountTimeoutMs) {
         delay(10);
     }
     
     keyboard.releaseAll();
-    for (const char& c : text) {
-        keyboard.write(c);
-    }
+    keyboard.clearWriteError();
+    keyboard.write(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+    return !keyboard.getWriteError();
 }
 
-bool UsbService::isReady() const {
-    return initialized;
+void UsbService::sendKey(uint8_t key) {
+    keyboard.write(key); // press and release, each report waits for the host
 }
 
-void UsbService::sendChunkedString(const std::string& data, size_t chunkSize, unsigned long delayBetweenChunks) {
-    size_t totalLength = data.length();
-    size_t sentLength = 0;
-
-    while (sentLength < totalLength) {
-        size_t remainingLength = totalLength - sentLength;
-        size_t currentChunkSize = (remainingLength > chunkSize) ? chunkSize : remainingLength;
-
-        std::string chunk = data.substr(sentLength, currentChunkSize);
-        sendString(chunk);
-
-        sentLength += currentChunkSize;
-        delay(delayBetweenChunks);
+void UsbService::releaseAll() {
+    if (initialized) {
+        keyboard.releaseAll();
     }
 }
+
+bool UsbService::isReady() const {
+    return initialized && mounted;
+}
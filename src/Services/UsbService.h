@@ -6,22 +6,29 @@
 #include <USBHIDKeyboard.h> // custom from local lib
 #include <string>
 #include <M5Cardputer.h>
+#include <States/GlobalState.h>
 
 class UsbService {
 public:
     UsbService();
     void begin();
     void end();
-    void sendString(const std::string& text);
-    void sendChunkedString(const std::string& data, size_t chunkSize=128, unsigned long delayBetweenChunks=50);
+    bool sendString(const std::string& text); // false when some characters were not typed
+    void sendKey(uint8_t key); // KEY_ESC...
+    void releaseAll();
     bool isReady() const;
     void setLayout(const uint8_t* newLayout);
+    void setUnicodeInput(codepoints::UnicodeInput input); // chars missing from the layout
 
 private:
     USBHIDKeyboard keyboard;
     const uint8_t* layout;
     bool initialized = false;
-    uint32_t initTime;
+
+    // Host mounted and not suspended, set from the TinyUSB event task
+    static volatile bool mounted;
+    static const uint32_t mountTimeoutMs = 1500; // cable plugged right before a send
+    static void onUsbEvent(void* arg, esp_event_base_t base, int32_t id, void* data);
 };
 
 #endif // USBSERVICE_H
@@ -3,6 +3,8 @@
 
 #include <cstdint>
 #include <string>
+#include <algorithm>
+#include <Enums/BleStatusEnum.h>
 
 class GlobalState {
 private:
@@ -27,24 +29,33 @@ private:
     // Configuration NVS key names
     std::string nvsNamespace = "vault_manager";
     std::string nvsLastUsedVaultPath = "lastUsedVault";
+    std::string nvsSettings = "settings";
+    std::string nvsBleLastHost = "bleLastHost";
+
+    // Before the settings blob, only read once to migrate
     std::string nvsKeyboardLayout = "keyboardLayout";
     std::string nvsScreenBrightness = "screenBright";
     std::string nvsInactivityScreenTimeout = "screenOffTime";
     std::string nvsInactivityLockTimeout = "vaultLockTime";
     std::string nvsBleEnabled = "bleKeyboard";
     std::string nvsBleDeviceName = "bleDeviceName";
+    std::string nvsUnicodeInput = "unicodeInput";
 
     // User config
     std::string selectedKeyboardLayout = "";
+    std::string selectedUnicodeInput = "None";
     uint8_t selectedScreenBrightness = 140;
     std::string defaultVaultPath = "/vaults";
     bool bleKeyboardEnabled = false;
     std::string bleDeviceName = "vault_kb";
 
+    // BLE connection, written by the BLE task
+    volatile BleStatusEnum bleStatus = BleStatusEnum::Off;
+
     // Last Vault
     std::string loadedVaultPath = "";
     std::string loadedVaultPassword = "";
-    bool vaultIsLocked = false;
+    volatile bool vaultIsLocked = false; // set from the inactivity timer task
 
     // Last Entry username
     std::string lastUsedUsername = "";
@@ -54,6 +65,21 @@ private:
     uint32_t inactivityScreenTimeout = 1 * 60 * 1000; // 1 min
     uint32_t inactivityLockTimeout = 10 * 60 * 1000; // 10 mins
 
+    // Keyboard scan timing
+    uint32_t keyScanInterval = 5; // 5 ms
+    uint32_t keyDebounceTime = 15; // 15 ms
+    uint32_t keyRepeatDelay = 400; // first repeat after 400 ms
+    uint32_t keyRepeatInterval = 120; // then every 120 ms
+    uint32_t keyRepeatMinInterval = 30; // accelerated down to 30 ms
+    uint32_t keyRepeatAcceleration = 10; // interval reduced by 10 ms each repeat
+    uint32_t keyWaitTimeout = 50; // max wait for a key before handler returns KEY_NONE
+    uint32_t keyIdleScanInterval = 30; // light sleep between two scans while idle
+    uint32_t idleSleepDelay = 1000; // backlight off for this long before the first light sleep
+
+    // Idle light sleep conditions, written by the view and the USB event task
+    volatile bool backlightOff = false;
+    volatile bool usbConnected = false;
+
     // Private constructor
     GlobalState() = default;
 
@@ -106,36 +132,46 @@ public:
     // Accesseurs pour la configuration NVS
     const std::string& getNvsNamespace() const { return nvsNamespace; }
     const std::string& getNvsLastUsedVaultPath() const { return nvsLastUsedVaultPath; }
+    const std::string& getNvsSettings() const { return nvsSettings; }
     const std::string& getNvsKeyboardLayout() const { return nvsKeyboardLayout; }
     const std::string& getNvsScreenBrightness() const { return nvsScreenBrightness; }
     const std::string& getNvsInactivityScreenTimeout() const { return nvsInactivityScreenTimeout; }
     const std::string& getNvsInactivityLockTimeout() const { return nvsInactivityLockTimeout; }
     const std::string& getNvsBleEnabled() const { return nvsBleEnabled; }
     const std::string& getNvsBleDeviceName() const { return nvsBleDeviceName; }
+    const std::string& getNvsBleLastHost() const { return nvsBleLastHost; }
+    const std::string& getNvsUnicodeInput() const { return nvsUnicodeInput; }
 
     // Accesseurs pour config
     const std::string& getSelectedKeyboardLayout() const { return selectedKeyboardLayout; }
+    const std::string& getSelectedUnicodeInput() const { return selectedUnicodeInput; }
     const uint8_t getSelectedScreenBrightness() const { return selectedScreenBrightness; }
     const std::string& getDefaultVaultPath() const { return defaultVaultPath; }
     bool getBleKeyboardEnabled() const { return bleKeyboardEnabled; }
     const std::string& getBleDeviceName() const { return bleDeviceName; }
+    BleStatusEnum getBleStatus() const { return bleStatus; }
 
     // Mutateurs pour la configuration NVS
     void setNvsNamespace(const std::string& ns) { nvsNamespace = ns; }
     void setNvsLastUsedVaultPath(const std::string& key) { nvsLastUsedVaultPath = key; }
+    void setNvsSettings(const std::string& key) { nvsSettings = key; }
     void setNvsKeyboardLayout(const std::string& key) { nvsKeyboardLayout = key; }
     void setNvsScreenBrightness(const std::string& key) { nvsScreenBrightness = key; }
     void setNvsInactivityScreenTimeout(const std::string& key) { nvsInactivityScreenTimeout = key; }
     void setNvsInactivityLockTimeout(const std::string& key) { nvsInactivityLockTimeout = key; }
     void setNvsBleEnabled(const std::string& key) { nvsBleEnabled = key; }
     void setNvsBleDeviceName(const std::string& key) { nvsBleDeviceName = key; }
+    void setNvsBleLastHost(const std::string& key) { nvsBleLastHost = key; }
+    void setNvsUnicodeInput(const std::string& key) { nvsUnicodeInput = key; }
 
     // Mutateurs config
     void setSelectedKeyboardLayout(const std::string& key) { selectedKeyboardLayout = key; }
+    void setSelectedUnicodeInput(const std::string& name) { selectedUnicodeInput = name; }
     void setSelectedScreenBrightness(uint8_t br) { selectedScreenBrightness = br; }
     void setDefaultVaultPath(const std::string& p) { defaultVaultPath = p; }
     void setBleKeyboardEnabled(bool enabled) { bleKeyboardEnabled = enabled; }
     void setBleDeviceName(const std::string& name) { bleDeviceName = name; }
+    void setBleStatus(BleStatusEnum status) { bleStatus = status; }
 
     // Accesseurs pour les informations du dernier coffre chargé
     const std::string& getLoadedVaultPath() const { return loadedVaultPath; }
@@ -145,6 +181,7 @@ public:
     // Mutateurs pour les informations du dernier coffre chargé
     void setLoadedVaultPath(const std::string& path) { loadedVaultPath = path; }
     void setLoadedVaultPassword(const std::string& password) { loadedVaultPassword = password; }
+    void wipeLoadedVaultPassword() { std::fill(loadedVaultPassword.begin(), loadedVaultPassword.end(), '\0'); } // in place, no reallocation
     void setVaultIsLocked(bool locked) { vaultIsLocked = locked; }
 
     // Accesseurs pour les temps d'inactivité
@@ -157,6 +194,34 @@ public:
     void setInactivityScreenTimeout(size_t timeout) { inactivityScreenTimeout = timeout; }
     void setInactivityLockTimeout(size_t timeout) { inactivityLockTimeout = timeout; }
 
+    // Accesseurs pour le clavier
+    uint32_t getKeyScanInterval() const { return keyScanInterval; }
+    uint32_t getKeyDebounceTime() const { return keyDebounceTime; }
+    uint32_t getKeyRepeatDelay() const { return keyRepeatDelay; }
+    uint32_t getKeyRepeatInterval() const { return keyRepeatInterval; }
+    uint32_t getKeyRepeatMinInterval() const { return keyRepeatMinInterval; }
+    uint32_t getKeyRepeatAcceleration() const { return keyRepeatAcceleration; }
+    uint32_t getKeyWaitTimeout() const { return keyWaitTimeout; }
+    uint32_t getKeyIdleScanInterval() const { return keyIdleScanInterval; }
+    uint32_t getIdleSleepDelay() const { return idleSleepDelay; }
+
+    // Mutateurs pour le clavier
+    void setKeyScanInterval(uint32_t ms) { keyScanInterval = ms; }
+    void setKeyDebounceTime(uint32_t ms) { keyDebounceTime = ms; }
+    void setKeyRepeatDelay(uint32_t ms) { keyRepeatDelay = ms; }
+    void setKeyRepeatInterval(uint32_t ms) { keyRepeatInterval = ms; }
+    void setKeyRepeatMinInterval(uint32_t ms) { keyRepeatMinInterval = ms; }
+    void setKeyRepeatAcceleration(uint32_t ms) { keyRepeatAcceleration = ms; }
+    void setKeyWaitTimeout(uint32_t ms) { keyWaitTimeout = ms; }
+    void setKeyIdleScanInterval(uint32_t ms) { keyIdleScanInterval = ms; }
+    void setIdleSleepDelay(uint32_t ms) { idleSleepDelay = ms; }
+
+    // Accesseurs pour la mise en veille
+    bool getBacklightOff() const { return backlightOff; }
+    bool getUsbConnected() const { return usbConnected; }
+    void setBacklightOff(bool off) { backlightOff = off; }
+    void setUsbConnected(bool connected) { usbConnected = connected; }
+
     // Accesseurs pour le dernier identifiant entry
     const std::string& getLastUsedUsername() const { return lastUsedUsername; }
     
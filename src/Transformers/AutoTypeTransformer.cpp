@@ -0,0 +1,135 @@
+#include "AutoTypeTransformer.h"
+#include <cctype>
+
+AutoTypeTransformer::AutoTypeTransformer() {
+    tokens = {
+        {"USERNAME", AutoTypeOp::Field, static_cast<uint16_t>(AutoTypeField::Username)},
+        {"PASSWORD", AutoTypeOp::Field, static_cast<uint16_t>(AutoTypeField::Password)},
+        {"NOTES", AutoTypeOp::Field, static_cast<uint16_t>(AutoTypeField::Notes)},
+        {"URL", AutoTypeOp::Field, static_cast<uint16_t>(AutoTypeField::Link)},
+
+        // Typed as text, every layout maps them
+        {"TAB", AutoTypeOp::Text, '\t'},
+        {"ENTER", AutoTypeOp::Text, '\n'},
+        {"SPACE", AutoTypeOp::Text, ' '},
+
+        // Keyboard codes of USBHIDKeyboard.h and keys.h
+        {"ESC", AutoTypeOp::Key, 0xB1},
+        {"BACKSPACE", AutoTypeOp::Key, 0xB2},
+        {"BS", AutoTypeOp::Key, 0xB2},
+        {"DELETE", AutoTypeOp::Key, 0xD4},
+        {"DEL", AutoTypeOp::Key, 0xD4},
+        {"UP", AutoTypeOp::Key, 0xDA},
+        {"DOWN", AutoTypeOp::Key, 0xD9},
+        {"LEFT", AutoTypeOp::Key, 0xD8},
+        {"RIGHT", AutoTypeOp::Key, 0xD7},
+        {"HOME", AutoTypeOp::Key, 0xD2},
+        {"END", AutoTypeOp::Key, 0xD5},
+        {"PGUP", AutoTypeOp::Key, 0xD3},
+        {"PGDN", AutoTypeOp::Key, 0xD6},
+    };
+}
+
+static bool parseNumber(const std::string& text, uint32_t max, uint32_t& value) {
+    if (text.empty() || text.size() > 5) {
+        return false;
+    }
+    value = 0;
+    for (char c : text) {
+        if (!std::isdigit(static_cast<unsigned char>(c))) {
+            return false;
+        }
+        value = value * 10 + (c - '0');
+    }
+    return value <= max;
+}
+
+AutoTypeProgram AutoTypeTransformer::toProgram(const std::string& pattern) const {
+    AutoTypeProgram program;
+    size_t i = 0;
+
+    while (i < pattern.size()) {
+        // Escaped braces, {{} and {}}
+        if (pattern.compare(i, 3, "{{}") == 0 || pattern.compare(i, 3, "{}}") == 0) {
+            appendText(program, std::string(1, pattern[i + 1]));
+            i += 3;
+            continue;
+        }
+        if (pattern[i] != '{') {
+            appendText(program, std::string(1, pattern[i]));
+            i++;
+            continue;
+        }
+
+        size_t close = pattern.find('}', i + 1);
+        if (close == std::string::npos) {
+            program.error = "Missing } in template";
+            return program;
+        }
+
+        std::string inner = pattern.substr(i + 1, close - i - 1);
+        size_t space = inner.find(' ');
+        std::string name = inner.substr(0, space);
+        std::string param = space == std::string::npos ? "" : inner.substr(space + 1);
+        for (auto& c : name) {
+            c = std::toupper(static_cast<unsigned char>(c));
+        }
+        i = close + 1;
+
+        uint32_t value = 0;
+        if (name == "DELAY") {
+            if (!parseNumber(param, MAX_DELAY_MS, value)) {
+                program.error = "Bad {DELAY ms}";
+                return program;
+            }
+            program.steps.push_back({AutoTypeOp::Delay, static_cast<uint16_t>(value), 0});
+            continue;
+        }
+
+        const Token* token = findToken(name);
+        if (!token) {
+            program.error = "Unknown {" + name + "}";
+            return program;
+        }
+
+        uint32_t repeat = 1;
+        if (!param.empty() && (!parseNumber(param, MAX_REPEAT, repeat) || repeat == 0)) {
+            program.error = "Bad repeat in {" + name + "}";
+            return program;
+        }
+
+        for (uint32_t r = 0; r < repeat; r++) {
+            if (token->op == AutoTypeOp::Text) {
+                appendText(program, std::string(1, static_cast<char>(token->arg)));
+            } else {
+                program.steps.push_back({token->op, token->arg, 0});
+            }
+        }
+    }
+
+    return program;
+}
+
+const AutoTypeTransformer::Token* AutoTypeTransformer::findToken(const std::string& name) const {
+    for (const auto& token : tokens) {
+        if (token.name == name) {
+            return &token;
+        }
+    }
+    return nullptr;
+}
+
+void AutoTypeTransformer::appendText(AutoTypeProgram& program, const std::string& text) {
+    // Extend the previous text step when it ends the literals
+    if (!program.steps.empty()) {
+        auto& last = program.steps.back();
+        if (last.op == AutoTypeOp::Text && last.arg + last.length == program.literals.size()) {
+            last.length += text.size();
+            program.literals += text;
+            return;
+        }
+    }
+
+    program.steps.push_back({AutoTypeOp::Text, static_cast<uint16_t>(program.literals.size()), static_cast<uint16_t>(text.size())});
+    program.literals += text;
+}
@@ -0,0 +1,32 @@
+#ifndef AUTO_TYPE_TRANSFORMER_H
+#define AUTO_TYPE_TRANSFORMER_H
+
+#include <string>
+#include <vector>
+#include <Models/AutoTypeProgram.h>
+
+// Compiles KeePass style templates like {USERNAME}{TAB}{PASSWORD}{ENTER}
+class AutoTypeTransformer {
+public:
+    static constexpr const char* DEFAULT_PATTERN = "{USERNAME}{TAB}{PASSWORD}{ENTER}";
+    static const uint16_t MAX_DELAY_MS = 10000;
+    static const uint8_t MAX_REPEAT = 50;
+
+    AutoTypeTransformer();
+
+    // Adjacent text is merged so a login goes out as one string, {TAB 3} repeats a key
+    AutoTypeProgram toProgram(const std::string& pattern) const;
+
+private:
+    struct Token {
+        std::string name;
+        AutoTypeOp op;
+        uint16_t arg;  // field, key code, or the char typed for Text
+    };
+    std::vector<Token> tokens;
+
+    const Token* findToken(const std::string& name) const;
+    static void appendText(AutoTypeProgram& program, const std::string& text);
+};
+
+#endif // AUTO_TYPE_TRANSFORMER_H
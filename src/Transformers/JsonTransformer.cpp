@@ -59,6 +59,7 @@ std::vector<Entry> JsonTransformer::fromJsonToEntries(const std::string& jsonCon
         entry.setNotes2(entryObj["notes2"].as<std::string>());
         entry.setNotes3(entryObj["notes3"].as<std::string>());
         entry.setLink(entryObj["link"].as<std::string>());
+        entry.setAutoType(entryObj["autoType"] | ""); // missing in older vaults
         entry.setCreatedAt(entryObj["createdAt"].as<long>());
         entry.setUpdatedAt(entryObj["updatedAt"].as<long>());
         entry.setExpiresAt(entryObj["expiresAt"].as<long>());
@@ -135,6 +136,7 @@ std::string JsonTransformer::mergeEntriesAndCategoriesToJson(const std::vector<E
         entryObj["notes2"] = entry.getNotes2();
         entryObj["notes3"] = entry.getNotes3();
         entryObj["link"] = entry.getLink();
+        entryObj["autoType"] = entry.getAutoType();
         entryObj["createdAt"] = static_cast<long>(entry.getCreatedAt());
         entryObj["updatedAt"] = static_cast<long>(entry.getUpdatedAt());
         entryObj["expiresAt"] = static_cast<long>(entry.getExpiresAt());
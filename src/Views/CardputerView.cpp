@@ -1,19 +1,66 @@
 #include "CardputerView.h"
+#ifndef HEADLESS_VIEW
+#include <M5Cardputer.h>
+#include <esp_timer.h>
+#include "Managers/PowerManager.h"
+#endif
 
 namespace views {
 
-M5GFX* CardputerView::Display = nullptr;
+lgfx::LovyanGFX* CardputerView::Display = nullptr;
+M5GFX* CardputerView::Panel = nullptr;
+
+#ifndef HEADLESS_VIEW
+// Backlight ramp, one step per tick from the esp_timer task
+static const uint32_t FADE_TICK_MS = 10;
+static esp_timer_handle_t fadeTimer = nullptr;
+static SemaphoreHandle_t fadeLock = nullptr; // a step never lands after setBrightness()
+#endif
+
+CardputerView::CardputerView(IInput& input) {
+    input.setIdleListener([this](bool keyHandled) { settleToast(keyHandled); });
+}
 
 void CardputerView::initialize() {
-    Display = &M5Cardputer.Display;
-    Display->setRotation(1);
+#ifdef HEADLESS_VIEW
+    initializeCanvas(nullptr); // no screen on the host
+#else
+    initializeCanvas(&M5Cardputer.Display);
+#endif
+}
+
+void CardputerView::initializeCanvas(M5GFX* panel) {
+    Panel = panel;
+    if (Panel) {
+        Panel->setRotation(1);
+        Panel->fillScreen(BACKGROUND_COLOR);
+        Panel->initDMA();
+        brightness = Panel->getBrightness();
+    }
+
+    // Compose every screen off-screen, PSRAM first, internal RAM if there is none
+    canvas.setColorDepth(16);
+    canvas.setPsram(true);
+    canvasReady = canvas.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT) != nullptr;
+    if (!canvasReady) {
+        canvas.setPsram(false);
+        canvasReady = canvas.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT) != nullptr;
+    }
+    Display = canvasReady ? static_cast<lgfx::LovyanGFX*>(&canvas) : Panel;
+
     Display->setTextColor(TEXT_COLOR);
     Display->fillScreen(BACKGROUND_COLOR);
     Display->setTextDatum(middle_center);
     Display->setFont(&fonts::Font0);
+    createButtonSprites();
+    createIconAtlas();
+    invalidate();
 }
 
 void CardputerView::welcome(uint8_t defaultBrightness) {
+    beginFrame();
+    invalidate();
+    markDirty(0, Display->height());
     Display->fillRoundRect(10, 13, 215, 30, 5, RECT_COLOR_DARK); // Around main title
     Display->drawRoundRect(10, 13, 215, 30, 5, PRIMARY_COLOR); // Around main title
 
@@ -40,11 +87,12 @@ void CardputerView::welcome(uint8_t defaultBrightness) {
     Display->printf("Press any key");
     Display->drawRect(12, 53, ((Display->height() / 2) + 2), ((Display->height() / 2) + 2), PRIMARY_COLOR);
     Display->qrcode("github.com/hrootzel/Password-Manager", 13, 54, Display->height() / 2, 4);
+    present();
 
-    uint8_t currentBrightness = defaultBrightness;
-    while (getBrightness() >= 50) {
-        setBrightness(currentBrightness--);
-        delay(12);
+    // Same pace as before, the key that ends the welcome is read right away
+    setBrightness(defaultBrightness);
+    if (defaultBrightness >= 50) {
+        fadeBrightness(49, (defaultBrightness - 49) * 12);
     }
 }
 
@@ -55,6 +103,17 @@ void CardputerView::topBar(const std::string& title, bool submenu, bool searchBa
     size_t limiter; // char limitation
     float sizeText; // pixels offset depending on text size
 
+    // Already on screen
+    if (topBarState.valid && topBarState.title == title &&
+        topBarState.submenu == submenu && topBarState.searchBar == searchBar) {
+        return;
+    }
+    topBarState.valid = true;
+    topBarState.title = title;
+    topBarState.submenu = submenu;
+    topBarState.searchBar = searchBar;
+
+    beginFrame();
     clearTopBar();
     Display->setTextSize(TEXT_MEDIUM);
 
@@ -82,6 +141,8 @@ void CardputerView::topBar(const std::string& title, bool submenu, bool searchBa
         Display->setCursor(offsetX, marginY);
         Display->printf(truncatedTitle.c_str());
     }
+    drawBleIndicator();
+    present();
 }
 
 void CardputerView::horizontalSelection(
@@ -89,39 +150,29 @@ void CardputerView::horizontalSelection(
     uint16_t selectedIndex,
     const std::string& description1,
     const std::string& description2,
-    const std::vector<std::string>& icons) {
+    const std::vector<IconEnum>& icons) {
 
+    beginFrame();
     if (icons.empty()) {
         horizontalSelectionWithoutIcons(options, selectedIndex, description1, description2);
     } else {
         horizontalSelectionWithIcons(options, selectedIndex, icons);
     }
+    present();
 }
 
 void CardputerView::horizontalSelectionWithIcons(
     const std::vector<std::string>& options,
     uint16_t selectedIndex,
-    const std::vector<std::string>& icons) {
+    const std::vector<IconEnum>& icons) {
 
     // Clear
     clearMainView(5);
+    topBarState.valid = false; // icons overlap the top bar area
+    markDirty(0, TOP_BAR_HEIGHT);
 
     // Icon
-    if (icons[selectedIndex] == "Create Vault") {
-        drawFileIcon();
-    } else if (icons[selectedIndex] == "Load Vault") {
-        drawVaultIcon();
-    } else if (icons[selectedIndex] == "Load File") {
-        drawSdCardIcon();
-    } else if (icons[selectedIndex] == "Settings") {
-        drawSettingsIcon();
-    } else if (icons[selectedIndex] == "New Password") {
-        drawPlusIcon();
-    } else if (icons[selectedIndex] == "Del Password") {
-        drawMinusIcon();
-    } else if (icons[selectedIndex] == "My Passwords") {
-        drawLockIcon();
-    }
+    drawMenuIcon(icons[selectedIndex]);
 
     // Name box
     Display->fillRoundRect(38, 93, Display->width() - 77, 35, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
@@ -194,20 +245,19 @@ void CardputerView::verticalSelection(
     const std::vector<std::string>& shortcuts,
     bool visibleMention) {
 
+    beginFrame();
     if (options.empty()) {
         clearMainView();
         Display->setTextSize(TEXT_BIG);
         Display->fillRoundRect(48, 59, 142, 36, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
         Display->drawRoundRect(48, 59, 142, 36, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
         Display->drawCenterString("No results", 120, 70);
-        return;
-    }
-
-    if (!optionLabels.empty()) {
+    } else if (!optionLabels.empty()) {
         verticalSelectionWithLabelsAndShortcuts(options, selectedIndex, visibleRows, optionLabels, shortcuts, visibleMention);
     } else {
         verticalSelectionSimple(options, selectedIndex, visibleRows);
     }
+    present();
 }
 
 void CardputerView::verticalSelectionSimple(
@@ -217,25 +267,36 @@ void CardputerView::verticalSelectionSimple(
 
     size_t totalOptions = options.size();
     size_t currentStartRow = selectedIndex / visibleRows * visibleRows;
+    size_t endRow = std::min(currentStartRow + visibleRows, totalOptions);
+    std::vector<std::string> rows(options.begin() + currentStartRow, options.begin() + endRow);
+
+    // Same page on screen, only the old and new selected rows change
+    if (canRepaintRows(currentStartRow, visibleRows, false, false, rows, {}, {})) {
+        size_t previousIndex = listState.selectedIndex;
+        if (previousIndex != selectedIndex) {
+            drawSimpleRow(previousIndex - currentStartRow, options[previousIndex], false);
+            drawSimpleRow(selectedIndex - currentStartRow, options[selectedIndex], true);
+            listState.selectedIndex = selectedIndex;
+        }
+        return;
+    }
 
     clearMainView();
 
-    for (size_t i = 0; i < visibleRows; ++i) {
+    for (size_t i = 0; i < rows.size(); ++i) {
         size_t index = currentStartRow + i;
-        if (index >= totalOptions) break;
-
-        bool isSelected = (index == selectedIndex);
-        int x = DEFAULT_MARGIN;
-        int y = TOP_BAR_HEIGHT + (i * 26);
-
-        drawRect(isSelected, DEFAULT_MARGIN, y, Display->width() - 13, 22, 0);
-
-        Display->setCursor(x + 10, y + 12);
-        Display->setTextSize(TEXT_LARGE);
-        Display->setTextColor(TEXT_COLOR);
-
-        Display->printf(truncateString(options[index], 20).c_str());
+        drawSimpleRow(i, options[index], index == selectedIndex);
     }
+
+    listState.valid = true;
+    listState.withLabels = false;
+    listState.withShortcuts = false;
+    listState.startRow = currentStartRow;
+    listState.visibleRows = visibleRows;
+    listState.selectedIndex = selectedIndex;
+    listState.rows = std::move(rows);
+    listState.labels.clear();
+    listState.shortcuts.clear();
 }
 
 void CardputerView::verticalSelectionWithLabelsAndShortcuts(
@@ -249,46 +310,32 @@ void CardputerView::verticalSelectionWithLabelsAndShortcuts(
 
     size_t totalOptions = options.size();
     size_t currentStartRow = selectedIndex / visibleRows * visibleRows;
+    size_t endRow = std::min(currentStartRow + visibleRows, totalOptions);
+    std::vector<std::string> rows(options.begin() + currentStartRow, options.begin() + endRow);
+    std::vector<std::string> labels(optionLabels.begin() + currentStartRow, optionLabels.begin() + endRow);
+    std::vector<std::string> rowShortcuts;
+    if (!shortcuts.empty()) {
+        rowShortcuts.assign(shortcuts.begin() + currentStartRow, shortcuts.begin() + endRow);
+    }
+
+    // Same page on screen, only the old and new selected rows change
+    if (canRepaintRows(currentStartRow, visibleRows, true, !shortcuts.empty(), rows, labels, rowShortcuts)) {
+        size_t previousIndex = listState.selectedIndex;
+        if (previousIndex != selectedIndex) {
+            size_t previousRow = previousIndex - currentStartRow;
+            size_t selectedRow = selectedIndex - currentStartRow;
+            drawLabeledRow(previousRow, rows[previousRow], labels[previousRow], rowShortcuts.empty() ? "" : rowShortcuts[previousRow], false);
+            drawLabeledRow(selectedRow, rows[selectedRow], labels[selectedRow], rowShortcuts.empty() ? "" : rowShortcuts[selectedRow], true);
+            listState.selectedIndex = selectedIndex;
+        }
+        return;
+    }
 
     clearMainView();
 
-    for (size_t i = 0; i < visibleRows; ++i) {
+    for (size_t i = 0; i < rows.size(); ++i) {
         size_t index = currentStartRow + i;
-        if (index >= totalOptions) break;
-
-        bool isSelected = (index == selectedIndex);
-        int x = DEFAULT_MARGIN;
-        int y = TOP_BAR_HEIGHT + (i * 26);
-
-        drawRect(isSelected, DEFAULT_MARGIN, y, Display->width() - 13, 22, 0);
-
-        // Label
-        Display->setTextSize(TEXT_SMALL);
-        auto labelWidth = Display->textWidth(optionLabels[index].c_str());
-        Display->fillRoundRect(x, y, labelWidth+15, 22, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
-        Display->drawRoundRect(x, y, labelWidth+16, 22, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
-        Display->setCursor(x + 8, y + 12);
-        Display->setTextColor(PRIMARY_COLOR);
-        Display->printf(optionLabels[index].c_str());
-
-        // Option principale
-        auto truncatedOption = truncateString(options[index], 18);
-        truncatedOption = optionLabels[index] == "Pass" ? std::string(truncatedOption.size(), '*') : truncatedOption;
-        Display->setCursor(labelWidth+28, y + 12);
-        Display->setTextSize(TEXT_WIDE);
-        Display->setTextColor(TEXT_COLOR);
-        Display->printf(truncatedOption.c_str());
-
-        // Raccourci
-        if (!shortcuts.empty()) {
-            Display->fillRoundRect(Display->width() - 44, y - 1, 39, 22, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
-            Display->drawRoundRect(Display->width() - 45, y, 40, 22, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
-            Display->setTextColor(TEXT_COLOR);
-            Display->setTextSize(TEXT_WIDE);
-            Display->setCursor(Display->width() - 28, y+12);
-            Display->printf(shortcuts[index].c_str());
-        }
-
+        drawLabeledRow(i, rows[i], labels[i], rowShortcuts.empty() ? "" : rowShortcuts[i], index == selectedIndex);
     }
     
     // Keyboard mention
@@ -299,9 +346,99 @@ void CardputerView::verticalSelectionWithLabelsAndShortcuts(
         Display->setCursor(getCenterOffset(mention), 122);
         Display->printf(mention.c_str());
     }
+
+    listState.valid = true;
+    listState.withLabels = true;
+    listState.withShortcuts = !shortcuts.empty();
+    listState.startRow = currentStartRow;
+    listState.visibleRows = visibleRows;
+    listState.selectedIndex = selectedIndex;
+    listState.rows = std::move(rows);
+    listState.labels = std::move(labels);
+    listState.shortcuts = std::move(rowShortcuts);
+}
+
+bool CardputerView::canRepaintRows(
+    size_t startRow,
+    size_t visibleRows,
+    bool withLabels,
+    bool withShortcuts,
+    const std::vector<std::string>& rows,
+    const std::vector<std::string>& labels,
+    const std::vector<std::string>& shortcuts) const {
+
+    return listState.valid &&
+           listState.withLabels == withLabels &&
+           listState.withShortcuts == withShortcuts &&
+           listState.startRow == startRow &&
+           listState.visibleRows == visibleRows &&
+           listState.rows == rows &&
+           listState.labels == labels &&
+           listState.shortcuts == shortcuts;
+}
+
+void CardputerView::drawSimpleRow(size_t row, const std::string& option, bool selected) {
+    int x = DEFAULT_MARGIN;
+    int y = TOP_BAR_HEIGHT + (row * 26);
+    markDirty(y, 22);
+
+    drawRect(selected, DEFAULT_MARGIN, y, Display->width() - 13, 22, 0);
+
+    Display->setCursor(x + 10, y + 12);
+    Display->setTextSize(TEXT_LARGE);
+    Display->setTextColor(TEXT_COLOR);
+
+    Display->printf(truncateString(option, 20).c_str());
+}
+
+void CardputerView::drawLabeledRow(size_t row, const std::string& option, const std::string& label, const std::string& shortcut, bool selected) {
+    int x = DEFAULT_MARGIN;
+    int y = TOP_BAR_HEIGHT + (row * 26);
+    markDirty(y - 1, 23); // shortcut box starts one pixel above
+
+    drawRect(selected, DEFAULT_MARGIN, y, Display->width() - 13, 22, 0);
+
+    // Label
+    Display->setTextSize(TEXT_SMALL);
+    auto labelWidth = measureText(label);
+    Display->fillRoundRect(x, y, labelWidth+15, 22, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
+    Display->drawRoundRect(x, y, labelWidth+16, 22, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
+    Display->setCursor(x + 8, y + 12);
+    Display->setTextColor(PRIMARY_COLOR);
+    Display->printf(label.c_str());
+
+    // Option principale
+    auto truncatedOption = truncateString(option, 18);
+    truncatedOption = label == "Pass" ? std::string(truncatedOption.size(), '*') : truncatedOption;
+    Display->setCursor(labelWidth+28, y + 12);
+    Display->setTextSize(TEXT_WIDE);
+    Display->setTextColor(TEXT_COLOR);
+    Display->printf(truncatedOption.c_str());
+
+    // Raccourci
+    if (!shortcut.empty()) {
+        Display->fillRoundRect(Display->width() - 44, y - 1, 39, 22, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
+        Display->drawRoundRect(Display->width() - 45, y, 40, 22, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
+        Display->setTextColor(TEXT_COLOR);
+        Display->setTextSize(TEXT_WIDE);
+        Display->setCursor(Display->width() - 28, y+12);
+        Display->printf(shortcut.c_str());
+    }
 }
 
 void CardputerView::subMessage(std::string message, int delayMs) {
+    // A held message keeps the panel, a passing one like "Loading..." is composed under it
+    // and a timed one waits its turn
+    if (toastPending) {
+        int32_t leftMs = static_cast<int32_t>(toastUntilMs - millis());
+        if (leftMs > 0 && delayMs > 0) {
+            delay(leftMs);
+            leftMs = 0;
+        }
+        toastPending = leftMs > 0;
+    }
+    beginFrame();
+
     // Clear
     clearMainView(5);
 
@@ -314,63 +451,169 @@ void CardputerView::subMessage(std::string message, int delayMs) {
     Display->setCursor(getCenterOffset(message), 80);
     Display->printf(message.c_str());
     Display->setTextSize(TEXT_MEDIUM);
+    present();
 
-    if (delayMs) {
-        delay(delayMs);
+    // No blocking here, the next screens are composed while the panel keeps the message
+    if (delayMs > 0) {
+        toastPending = true;
+        toastArmed = false;
+        toastUntilMs = millis() + delayMs;
     }
 }
 
-void CardputerView::stringPrompt(std::string label, std::string value, bool backButton, size_t minLength) {
-    // Clear
-    clearMainView(5);
+void CardputerView::progress(std::string label, uint8_t percent, std::string hint) {
+    const int barX = 30;
+    const int barWidth = Display->width() - 60;
+    beginFrame();
 
-    // Box frame
-    Display->drawRoundRect(10, 35, Display->width() - 20, 90, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
+    // Same job on screen, only the bar moves
+    if (!progressState.valid || progressState.label != label || progressState.hint != hint) {
+        clearMainView(5);
+        Display->drawRoundRect(10, 35, Display->width() - 20, 90, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
+
+        Display->setTextSize(TEXT_WIDE);
+        Display->setTextColor(TEXT_COLOR);
+        Display->setCursor(getCenterOffset(label), 55);
+        Display->printf(label.c_str());
+
+        Display->setTextSize(TEXT_SMALL);
+        Display->setTextColor(RECT_COLOR_LIGHT);
+        Display->setCursor(getCenterOffset(hint), 105);
+        Display->printf(hint.c_str());
+
+        progressState.valid = true;
+        progressState.label = label;
+        progressState.hint = hint;
+    }
+
+    int filled = barWidth * std::min<uint8_t>(percent, 100) / 100;
+    Display->fillRoundRect(barX, 78, barWidth, 10, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
+    if (filled > 0) {
+        Display->fillRoundRect(barX, 78, filled, 10, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
+    }
+    markDirty(78, 10);
 
-    // Description
     Display->setTextSize(TEXT_MEDIUM);
-    Display->setTextColor(TEXT_COLOR);
-    Display->setCursor(getCenterOffset(label), 48);
+    present();
+}
+
+void CardputerView::qrCode(const std::string& label, const QrBitmap& bitmap) {
+    const int quietModules = 2; // phones read it fine with half the standard margin
+    const int side = Display->height();
+    beginFrame();
+    invalidate();
+    markDirty(0, side);
+
+    // Biggest whole pixels per module, the code on a white square on the left
+    int scale = std::max(1, side / (bitmap.getSize() + 2 * quietModules));
+    int offset = (side - bitmap.getSize() * scale) / 2;
+    Display->fillScreen(BACKGROUND_COLOR);
+    Display->fillRect(0, 0, side, side, TFT_WHITE);
+
+    // One rect per run of dark modules
+    for (uint8_t y = 0; y < bitmap.getSize(); y++) {
+        uint8_t x = 0;
+        while (x < bitmap.getSize()) {
+            if (!bitmap.module(x, y)) {
+                x++;
+                continue;
+            }
+            uint8_t start = x;
+            while (x < bitmap.getSize() && bitmap.module(x, y)) {
+                x++;
+            }
+            Display->fillRect(offset + start * scale, offset + y * scale, (x - start) * scale, scale, TFT_BLACK);
+        }
+    }
+
+    int textX = side + 8;
+    Display->setTextSize(TEXT_WIDE);
+    Display->setTextColor(PRIMARY_COLOR);
+    Display->setCursor(textX, 40);
     Display->printf(label.c_str());
 
-    // Check the length of the input and truncate if necessary
-    std::string truncatedInput;
-    if (value.length() > 20) {
-        truncatedInput = value.substr(value.length() - 20); // Get the last characters
-    } else {
-        truncatedInput = value;
+    Display->setTextSize(TEXT_SMALL);
+    Display->setTextColor(RECT_COLOR_LIGHT);
+    Display->setCursor(textX, 65);
+    Display->printf("%dx%d", bitmap.getSize(), bitmap.getSize());
+    Display->setCursor(textX, 110);
+    Display->printf("Any key back");
+
+    Display->setTextColor(TEXT_COLOR);
+    Display->setTextSize(TEXT_MEDIUM);
+    present();
+}
+
+void CardputerView::stringPrompt(std::string label, std::string value, bool backButton, size_t minLength, size_t cursor) {
+    const size_t visibleChars = 20;
+    beginFrame();
+
+    bool okEnabled = value.length() >= minLength;
+    bool newPrompt = !promptState.valid || promptState.label != label;
+    cursor = std::min(cursor, value.length());
+
+    // Same prompt on screen, only the input line changes
+    if (newPrompt || promptState.backButton != backButton || promptState.okEnabled != okEnabled) {
+        // Clear
+        clearMainView(5);
+
+        // Box frame
+        Display->drawRoundRect(10, 35, Display->width() - 20, 90, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
+
+        // Description
+        Display->setTextSize(TEXT_MEDIUM);
+        Display->setTextColor(TEXT_COLOR);
+        Display->setCursor(getCenterOffset(label), 48);
+        Display->printf(label.c_str());
+
+        size_t xPos = 110; 
+        if (backButton) {
+            // < button
+            drawButton(Button::PromptBack, 53, 95);
+            xPos = 135;
+        }
+
+        // Button ok
+        drawButton(okEnabled ? Button::PromptOk : Button::PromptOkDisabled, xPos-30, 95);
+
+        promptState.valid = true;
+        promptState.label = label;
+        promptState.backButton = backButton;
+        promptState.okEnabled = okEnabled;
     }
 
+    // Scroll the input so the cursor stays visible
+    size_t& start = promptState.viewStart;
+    if (newPrompt) {
+        start = 0;
+    }
+    if (cursor < start) {
+        start = cursor;
+    }
+    if (cursor > start + visibleChars) {
+        start = cursor - visibleChars;
+    }
+    start = std::min(start, value.length() > visibleChars ? value.length() - visibleChars : 0);
+
     // input
     Display->setTextSize(TEXT_MEDIUM_LARGE);
+    Display->setTextColor(TEXT_COLOR);
     Display->fillRoundRect(42, 62, 155, 25, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
     Display->setCursor(51, 73);
-    Display->printf(truncatedInput.c_str());
-
-    size_t xPos = 110; 
-    if (backButton) {
-        // < button
-        Display->fillRoundRect(53, 95, 40, 20, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
-        Display->drawRoundRect(53, 95, 40, 20, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
-        Display->setCursor(70, 105);
-        Display->printf("<");
-        xPos = 135;
-    }
-
-    // Button ok
-    if (value.length() < minLength) {
-        Display->fillRoundRect(xPos-30, 95, 80, 20, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
-        Display->drawRoundRect(xPos-30, 95, 80, 20, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
-    } else {
-        Display->fillRoundRect(xPos-30, 95, 80, 20, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
-    }
+    Display->print(value.substr(start, visibleChars).c_str());
+
+    // Cursor, measured uncached, every prefix of a typed password would land in the cache
+    int caretX = 51 + measureText(value.substr(start, cursor - start), false);
+    Display->fillRect(caretX, 67, 1, 12, PRIMARY_COLOR);
+    markDirty(62, 25);
 
     Display->setTextSize(TEXT_MEDIUM);
-    Display->setCursor(xPos+5, 106);
-    Display->printf("OK");
+    present();
 }
 
 void CardputerView::confirmationPrompt(std::string label) {
+    beginFrame();
+
     // Clear
     clearMainView(5);
 
@@ -386,36 +629,35 @@ void CardputerView::confirmationPrompt(std::string label) {
     Display->setTextSize(TEXT_MEDIUM);
 
     // < button
-    Display->fillRoundRect(65, 85, 40, 20, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
-    Display->drawRoundRect(65, 85, 40, 20, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
-    Display->setCursor(81, 96);
-    Display->printf("<");
+    drawButton(Button::ConfirmBack, 65, 85);
 
     // ok button
-    Display->fillRoundRect(128, 85, 40, 20, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
-    Display->setCursor(142, 96);
-    Display->printf("OK");
+    drawButton(Button::ConfirmOk, 128, 85);
+    present();
 }
 
 void CardputerView::value(std::string label, std::string value) {
+    beginFrame();
     clearMainView(5);
 
     // Initial text size
     float textSize = TEXT_BIG;
 
     // Adjust text size to fit the screen width
-    adjustTextSizeToFit(value, Display->width() - 40, textSize);
+    // Values may be revealed passwords, kept out of the width cache
+    adjustTextSizeToFit(value, Display->width() - 40, textSize, false);
 
     // Determine position
-    auto x = getCenterOffset(value);
+    auto valueWidth = measureText(value, false);
+    auto x = (Display->width() - valueWidth) / 2;
     auto y = 40;
-    auto biggerThanScreen = Display->textWidth(value.c_str()) > Display->width();
+    auto biggerThanScreen = valueWidth > Display->width();
 
     // Draw background if the text fits on the screen
     if (!biggerThanScreen) {
         y = 60;
-        Display->fillRoundRect(x - 9, y - 15, Display->textWidth(value.c_str()) + 18, 32, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
-        Display->drawRoundRect(x - 9, y - 15, Display->textWidth(value.c_str()) + 18, 32, DEFAULT_ROUND_RECT, RECT_COLOR_LIGHT);
+        Display->fillRoundRect(x - 9, y - 15, valueWidth + 18, 32, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
+        Display->drawRoundRect(x - 9, y - 15, valueWidth + 18, 32, DEFAULT_ROUND_RECT, RECT_COLOR_LIGHT);
     }
 
     Display->setCursor(x, y);
@@ -459,6 +701,7 @@ void CardputerView::value(std::string label, std::string value) {
     Display->printf("to send keys");
 
     Display->setTextColor(TEXT_COLOR);
+    present();
 }
 
 void CardputerView::drawRect(bool selected, uint8_t margin, uint16_t startY, uint16_t sizeX, uint16_t sizeY, uint16_t stepY) {
@@ -492,38 +735,428 @@ void CardputerView::drawSearchIcon(int x, int y, int size, uint16_t color) {
 
 void CardputerView::clearMainView(uint8_t offsetY) {
     Display->fillRect(0, TOP_BAR_HEIGHT-offsetY, Display->width(), Display->height(), BACKGROUND_COLOR);
+    markDirty(TOP_BAR_HEIGHT-offsetY, Display->height());
+    listState.valid = false;
+    promptState.valid = false;
+    progressState.valid = false;
+}
+
+void CardputerView::invalidate() {
+    topBarState.valid = false;
+    listState.valid = false;
+    promptState.valid = false;
+    progressState.valid = false;
+}
+
+void CardputerView::bleStatus(BleStatusEnum status) {
+    if (status == bleIndicator) {
+        return;
+    }
+    bleIndicator = status;
+
+    beginFrame();
+    drawBleIndicator();
+    present();
+}
+
+// Dot in the top right corner, orange when a host is connected, gray while advertising
+void CardputerView::drawBleIndicator() {
+    uint16_t color = BACKGROUND_COLOR;
+    if (bleIndicator == BleStatusEnum::Connected) {
+        color = PRIMARY_COLOR;
+    } else if (bleIndicator == BleStatusEnum::Advertising) {
+        color = RECT_COLOR_LIGHT;
+    }
+    Display->fillCircle(Display->width() - 6, 5, 2, color);
+    markDirty(2, 7);
 }
 
 void CardputerView::clearTopBar() {
     Display->fillRect(0, 0, Display->width(), TOP_BAR_HEIGHT, BACKGROUND_COLOR);
+    markDirty(0, TOP_BAR_HEIGHT);
+}
+
+void CardputerView::wipeTextCache() {
+    textMetrics.clear();
 }
 
 void CardputerView::debug(const std::string& message) {
+    beginFrame();
     Display->setTextSize(TEXT_MEDIUM);
     Display->fillScreen(TFT_BLACK);
+    invalidate();
+    markDirty(0, Display->height());
     Display->setCursor(100, 10);
     Display->printf("DEBUG");
     Display->setCursor(10, 50);
     Display->printf(message.c_str());
+    present();
     delay(3000);
 }
 
-void CardputerView::setBrightness(uint16_t brightness) {
-    Display->setBrightness(brightness);
+void CardputerView::setBrightness(uint16_t value) {
+#ifndef HEADLESS_VIEW
+    // Instant, a fade still running is dropped
+    if (fadeTimer) {
+        xSemaphoreTake(fadeLock, portMAX_DELAY);
+        esp_timer_stop(fadeTimer);
+    }
+#endif
+    brightness = value;
+    if (Panel) {
+        Panel->setBrightness(value);
+    }
+    globalState.setBacklightOff(value <= 1); // the input may light sleep, PWM stops with it
+#ifndef HEADLESS_VIEW
+    if (fadeTimer) {
+        xSemaphoreGive(fadeLock);
+    }
+#endif
 }
 
 uint8_t CardputerView::getBrightness() {
-    return Display->getBrightness();
+    return brightness;
+}
+
+void CardputerView::fadeBrightness(uint8_t target, uint32_t durationMs) {
+#ifndef HEADLESS_VIEW
+    uint8_t from = brightness;
+    if (Panel && durationMs >= FADE_TICK_MS && from != target) {
+        if (!fadeTimer) {
+            fadeLock = xSemaphoreCreateMutex();
+            esp_timer_create_args_t args = {};
+            args.callback = &CardputerView::onFadeTimer;
+            args.arg = this;
+            args.name = "fade";
+            esp_timer_create(&args, &fadeTimer);
+        }
+
+        xSemaphoreTake(fadeLock, portMAX_DELAY);
+        esp_timer_stop(fadeTimer);
+        globalState.setBacklightOff(false); // the timer needs the chip awake
+        uint32_t ticks = durationMs / FADE_TICK_MS;
+        uint32_t distance = from > target ? from - target : target - from;
+        fadeTarget = target;
+        fadeStep = std::max<uint32_t>(1, (distance + ticks - 1) / ticks);
+        esp_timer_start_periodic(fadeTimer, FADE_TICK_MS * 1000);
+        xSemaphoreGive(fadeLock);
+        return;
+    }
+#endif
+    setBrightness(target); // no backlight to ramp on the host
+}
+
+void CardputerView::onFadeTimer(void* arg) {
+    static_cast<CardputerView*>(arg)->stepFade();
+}
+
+void CardputerView::stepFade() {
+#ifndef HEADLESS_VIEW
+    // Busy means setBrightness() is taking over, this step is skipped
+    if (xSemaphoreTake(fadeLock, 0) != pdTRUE) {
+        return;
+    }
+
+    uint8_t current = brightness;
+    if (current > fadeTarget) {
+        current = current - fadeTarget > fadeStep ? current - fadeStep : fadeTarget;
+    } else {
+        current = fadeTarget - current > fadeStep ? current + fadeStep : fadeTarget;
+    }
+    brightness = current;
+    Panel->setBrightness(current);
+    if (current == fadeTarget) {
+        esp_timer_stop(fadeTimer);
+        globalState.setBacklightOff(current <= 1);
+    }
+    xSemaphoreGive(fadeLock);
+#endif
+}
+
+void CardputerView::beginFrame() {
+    // The canvas must not change while the previous band is still being pushed
+    waitPush();
+    frameStartUs = micros();
+}
+
+// The UI waits for a key again, the message ends once expired or after a key
+void CardputerView::settleToast(bool keyHandled) {
+    if (!toastPending) {
+        return;
+    }
+
+    // Keys reported by the first wait came before the message
+    bool dismissed = toastArmed && keyHandled;
+    toastArmed = true;
+    if (!dismissed && static_cast<int32_t>(toastUntilMs - millis()) > 0) {
+        return;
+    }
+
+    // Push what was drawn under it meanwhile
+    toastPending = false;
+    beginFrame();
+    present();
+}
+
+void CardputerView::markDirty(int16_t y, int16_t h) {
+    int16_t top = std::max<int16_t>(y, 0);
+    int16_t bottom = std::min<int16_t>(y + h, Display->height());
+    if (bottom <= top) {
+        return;
+    }
+    dirtyTop = dirtyTop < 0 ? top : std::min(dirtyTop, top);
+    dirtyBottom = dirtyBottom < 0 ? bottom : std::max(dirtyBottom, bottom);
+}
+
+void CardputerView::present() {
+    if (dirtyTop < 0) {
+        return; // nothing changed
+    }
+
+    // The panel keeps the message, the band grows until it is settled
+    if (toastPending) {
+        return;
+    }
+
+    if (latency.isOverlayEnabled()) {
+        drawLatencyOverlay();
+    }
+
+    uint32_t composedUs = micros();
+    uint32_t pixels = 0;
+    onPresent(dirtyTop, dirtyBottom);
+
+    // Push the dirty band with DMA, the CPU goes back to input while it transfers
+    if (canvasReady && Panel) {
+        int16_t width = canvas.width();
+        int16_t height = dirtyBottom - dirtyTop;
+        auto buffer = static_cast<const lgfx::swap565_t*>(canvas.getBuffer());
+#ifndef HEADLESS_VIEW
+        PowerManager::getInstance().acquire(PowerLock::Bus); // released once the transfer is reaped
+#endif
+        Panel->startWrite();
+        Panel->pushImageDMA(0, dirtyTop, width, height, buffer + dirtyTop * width);
+        dmaPending = true;
+        pixels = width * height;
+    }
+
+    uint32_t pushedUs = micros();
+    latency.framePresented(composedUs - frameStartUs, pushedUs - composedUs, pixels);
+
+    dirtyTop = -1;
+    dirtyBottom = -1;
+}
+
+void CardputerView::drawLatencyOverlay() {
+    // Last key and p99 of the last keys, press to frame pushed
+    auto total = latency.getTotalStage().summary();
+    char text[40];
+    snprintf(text, sizeof(text), "key %.1fms p99 %.1fms",
+             latency.getLastTotalUs() / 1000.0f, total.p99 / 1000.0f);
+
+    auto style = Display->getTextStyle(); // the overlay must not leak into the next frame
+    int16_t y = Display->height() - 9;
+    Display->fillRect(0, y, Display->width(), 9, BACKGROUND_COLOR);
+    Display->setTextSize(TEXT_SMALL);
+    Display->setTextColor(PRIMARY_COLOR);
+    Display->setCursor(2, y + 1);
+    Display->print(text);
+    Display->setTextStyle(style);
+    markDirty(y, 9);
+}
+
+void CardputerView::waitPush() {
+    if (!dmaPending) {
+        return;
+    }
+
+    uint32_t start = micros();
+    Panel->waitDMA();
+    Panel->endWrite();
+#ifndef HEADLESS_VIEW
+    PowerManager::getInstance().release(PowerLock::Bus);
+#endif
+    dmaPending = false;
+    latency.pushWaited(micros() - start);
+}
+
+int16_t CardputerView::measureText(const std::string& text, bool cache) {
+    if (!cache) {
+        return static_cast<int16_t>(Display->textWidth(text.c_str()));
+    }
+
+    // Width in pixels with the current font and size, measured once per string
+    return textMetrics.width(text, Display->getFont(), Display->getTextSizeX(), [&]() {
+        return static_cast<int16_t>(Display->textWidth(text.c_str()));
+    });
 }
 
 int CardputerView::getCenterOffset(const std::string& text, int screenWidth) {
     // Measure the width of the text in pixels using the current font and size
-    int textWidth = Display->textWidth(text.c_str());
+    int textWidth = measureText(text);
 
     // Calculate the centered X position
     return (screenWidth - textWidth) / 2;
 }
 
+void CardputerView::createButtonSprites() {
+    // 16 bits like the canvas so copies are plain memcpy, about 11 KB for all of them
+    buttonSpritesReady = true;
+    for (size_t i = 0; i < static_cast<size_t>(Button::Count); ++i) {
+        auto button = static_cast<Button>(i);
+        auto& sprite = buttonSprites[i];
+        bool wide = button == Button::PromptOk || button == Button::PromptOkDisabled;
+        sprite.setColorDepth(16);
+        sprite.setPsram(false);
+        if (!sprite.createSprite(wide ? 80 : 40, 20)) {
+            buttonSpritesReady = false;
+            break;
+        }
+        sprite.setTextDatum(Display->getTextDatum());
+        sprite.setFont(&fonts::Font0);
+        sprite.fillSprite(BACKGROUND_COLOR);
+        renderButton(&sprite, button, 0, 0);
+    }
+
+    // Not enough memory, buttons are drawn every time
+    if (!buttonSpritesReady) {
+        for (auto& sprite : buttonSprites) {
+            sprite.deleteSprite();
+        }
+    }
+}
+
+void CardputerView::renderButton(lgfx::LovyanGFX* target, Button button, int x, int y) {
+    target->setTextColor(TEXT_COLOR);
+    switch (button) {
+        case Button::PromptBack:
+            target->fillRoundRect(x, y, 40, 20, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
+            target->drawRoundRect(x, y, 40, 20, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
+            target->setTextSize(TEXT_MEDIUM_LARGE);
+            target->setCursor(x + 17, y + 10);
+            target->printf("<");
+            break;
+        case Button::PromptOk:
+        case Button::PromptOkDisabled:
+            if (button == Button::PromptOkDisabled) {
+                target->fillRoundRect(x, y, 80, 20, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
+                target->drawRoundRect(x, y, 80, 20, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
+            } else {
+                target->fillRoundRect(x, y, 80, 20, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
+            }
+            target->setTextSize(TEXT_MEDIUM);
+            target->setCursor(x + 35, y + 11);
+            target->printf("OK");
+            break;
+        case Button::ConfirmBack:
+            target->fillRoundRect(x, y, 40, 20, DEFAULT_ROUND_RECT, RECT_COLOR_DARK);
+            target->drawRoundRect(x, y, 40, 20, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
+            target->setTextSize(TEXT_MEDIUM);
+            target->setCursor(x + 16, y + 11);
+            target->printf("<");
+            break;
+        case Button::ConfirmOk:
+            target->fillRoundRect(x, y, 40, 20, DEFAULT_ROUND_RECT, PRIMARY_COLOR);
+            target->setTextSize(TEXT_MEDIUM);
+            target->setCursor(x + 14, y + 11);
+            target->printf("OK");
+            break;
+        default:
+            break;
+    }
+}
+
+void CardputerView::drawButton(Button button, int x, int y) {
+    if (buttonSpritesReady) {
+        buttonSprites[static_cast<size_t>(button)].pushSprite(Display, x, y);
+    } else {
+        renderButton(Display, button, x, y);
+    }
+}
+
+void CardputerView::createIconAtlas() {
+    const uint16_t transparentKey = TFT_MAGENTA; // never used by the icons
+    const size_t iconCount = static_cast<size_t>(IconEnum::DeleteEntry) + 1;
+
+    // About 22 KB for all the icons, PSRAM first, internal RAM if there is none
+    iconAtlas.setColorDepth(2);
+    iconAtlas.setPsram(true);
+    if (!iconAtlas.createSprite(ICON_CELL_WIDTH, ICON_CELL_HEIGHT * iconCount)) {
+        iconAtlas.setPsram(false);
+        if (!iconAtlas.createSprite(ICON_CELL_WIDTH, ICON_CELL_HEIGHT * iconCount)) {
+            return; // icons are drawn every time
+        }
+    }
+    iconAtlas.createPalette();
+    iconAtlas.setPaletteColor(0, static_cast<uint16_t>(transparentKey));
+    iconAtlas.setPaletteColor(1, static_cast<uint16_t>(BACKGROUND_COLOR));
+    iconAtlas.setPaletteColor(2, static_cast<uint16_t>(PRIMARY_COLOR));
+    iconAtlas.setPaletteColor(3, static_cast<uint16_t>(RECT_COLOR_DARK));
+
+    // Icons are drawn once at full color in a scratch cell, then packed to palette indexes
+    M5Canvas cell;
+    cell.setColorDepth(16);
+    if (!cell.createSprite(ICON_CELL_WIDTH, ICON_CELL_HEIGHT)) {
+        iconAtlas.deleteSprite();
+        return;
+    }
+    cell.setFont(&fonts::Font0);
+    cell.setTextDatum(Display->getTextDatum());
+
+    auto target = Display;
+    Display = &cell;
+    auto atlas = static_cast<uint8_t*>(iconAtlas.getBuffer());
+    const size_t stride = ICON_CELL_WIDTH / 4; // 4 pixels per byte
+
+    for (size_t i = 0; i < iconCount; ++i) {
+        cell.fillSprite(transparentKey);
+        renderIcon(static_cast<IconEnum>(i), -ICON_CELL_X, -ICON_CELL_Y);
+
+        for (int y = 0; y < ICON_CELL_HEIGHT; ++y) {
+            uint8_t* row = atlas + (i * ICON_CELL_HEIGHT + y) * stride;
+            memset(row, 0, stride);
+            for (int x = 0; x < ICON_CELL_WIDTH; ++x) {
+                uint16_t color = cell.readPixel(x, y);
+                uint8_t index = color == transparentKey ? 0
+                              : color == BACKGROUND_COLOR ? 1
+                              : color == RECT_COLOR_DARK ? 3
+                              : 2;
+                row[x >> 2] |= index << ((3 - (x & 3)) * 2); // leftmost pixel in the high bits
+            }
+        }
+    }
+
+    Display = target;
+    cell.deleteSprite();
+    iconAtlasReady = true;
+}
+
+void CardputerView::renderIcon(IconEnum icon, int offsetX, int offsetY) {
+    switch (icon) {
+        case IconEnum::CreateVault: drawFileIcon(92 + offsetX, 10 + offsetY); break;
+        case IconEnum::LoadVault: drawVaultIcon(86 + offsetX, 10 + offsetY); break;
+        case IconEnum::SdCard: drawSdCardIcon(90 + offsetX, 10 + offsetY); break;
+        case IconEnum::Settings: drawSettingsIcon(80 + offsetX, 5 + offsetY); break;
+        case IconEnum::AddEntry: drawPlusIcon(120 + offsetX, 47 + offsetY); break;
+        case IconEnum::DeleteEntry: drawMinusIcon(120 + offsetX, 47 + offsetY); break;
+        case IconEnum::SelectEntry: drawLockIcon(120 + offsetX, 78 + offsetY); break;
+        default: break;
+    }
+}
+
+void CardputerView::drawMenuIcon(IconEnum icon) {
+    if (!iconAtlasReady) {
+        renderIcon(icon, 0, 0);
+        return;
+    }
+
+    // Only the icon cell of the atlas is copied, transparent pixels keep what is under them
+    int atlasY = ICON_CELL_Y - static_cast<int>(icon) * ICON_CELL_HEIGHT;
+    Display->setClipRect(ICON_CELL_X, ICON_CELL_Y, ICON_CELL_WIDTH, ICON_CELL_HEIGHT);
+    iconAtlas.pushSprite(Display, ICON_CELL_X, atlasY, 0);
+    Display->clearClipRect();
+}
+
 void CardputerView::drawVaultIcon(int x, int y, uint16_t color, size_t w, size_t h) {
     // Taille ajustée de l'icône
     int width = w;  // Largeur du coffre
@@ -661,7 +1294,7 @@ void CardputerView::drawSdCardIcon(int x, int y) {
 
     Display->setTextSize(2); // Taille du texte
     Display->setTextColor(PRIMARY_COLOR);
-    Display->setCursor(textX - (Display->textWidth("SD") / 2), textY - (Display->fontHeight() / 2));
+    Display->setCursor(textX - (measureText("SD") / 2), textY - (Display->fontHeight() / 2));
     Display->print("SD");
 
 
@@ -758,10 +1391,20 @@ std::string CardputerView::truncateString(const std::string& input, size_t maxLe
     return firstPart + ellipsis + secondPart;
 }
 
-void CardputerView::adjustTextSizeToFit(const std::string& text, uint16_t maxWidth, float textSize) {
+void CardputerView::adjustTextSizeToFit(const std::string& text, uint16_t maxWidth, float textSize, bool cache) {
     Display->setTextSize(textSize);
-    
-    while (Display->textWidth(text.c_str()) > maxWidth && textSize > TEXT_WIDE) {
+    if (measureText(text, cache) <= maxWidth) {
+        return;
+    }
+
+    // Width grows linearly with the size, solve it from the width at size 1
+    Display->setTextSize(1);
+    float unitWidth = std::max<int16_t>(measureText(text, cache), 1);
+    textSize = std::max<float>(std::floor(maxWidth / unitWidth * 100) / 100, TEXT_WIDE);
+    Display->setTextSize(textSize);
+
+    // Glyph scaling rounds, a step or two down may still be needed
+    while (measureText(text, cache) > maxWidth && textSize > TEXT_WIDE) {
         textSize-= 0.01; // Réduit progressivement la taille du texte
         Display->setTextSize(textSize);
     }
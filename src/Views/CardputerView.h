@@ -4,14 +4,28 @@
 #include <vector>
 #include <string>
 #include <cstring>
-#include <M5Cardputer.h>
+#include <algorithm>
+#include <cmath>
+#include <M5GFX.h>
+#include <Managers/LatencyManager.h>
+#include <States/GlobalState.h>
+#include <Inputs/IInput.h>
+#include "TextMetricsCache.h"
 #include "IView.h"
 
 // SIZING
+#define SCREEN_WIDTH 240
+#define SCREEN_HEIGHT 135
 #define DEFAULT_MARGIN 5
 #define DEFAULT_ROUND_RECT 5
 #define TOP_BAR_HEIGHT 30
 
+// Menu icons area, every icon of the horizontal menus is drawn inside it
+#define ICON_CELL_X 76
+#define ICON_CELL_Y 0
+#define ICON_CELL_WIDTH 136
+#define ICON_CELL_HEIGHT 93
+
 // PALETTE
 #define BACKGROUND_COLOR TFT_BLACK
 #define PRIMARY_COLOR 0xfc20
@@ -32,12 +46,14 @@ namespace views {
 
 class CardputerView : public IView {
 public:
+    explicit CardputerView(IInput& input);
     void initialize() override;
     void setBrightness(uint16_t brightness) override;
     uint8_t getBrightness() override;
+    void fadeBrightness(uint8_t target, uint32_t durationMs) override;
     void welcome(uint8_t defaultBrightness=140);
     void topBar(const std::string& title, bool submenu, bool searchBar) override;
-    void horizontalSelection(const std::vector<std::string>& options, uint16_t selectedIndex, const std::string& description1="", const std::string& description2="", const std::vector<std::string>& icons={});
+    void horizontalSelection(const std::vector<std::string>& options, uint16_t selectedIndex, const std::string& description1="", const std::string& description2="", const std::vector<IconEnum>& icons={});
     void verticalSelection(
         const std::vector<std::string>& options,
         uint16_t selectedIndex,
@@ -48,9 +64,13 @@ public:
     );
     void value(std::string label, std::string val);
     void subMessage(std::string message, int delayMs);
-    void stringPrompt(std::string label, std::string value, bool backButton, size_t minLength);
+    void progress(std::string label, uint8_t percent, std::string hint) override;
+    void qrCode(const std::string& label, const QrBitmap& bitmap) override;
+    void stringPrompt(std::string label, std::string value, bool backButton, size_t minLength, size_t cursor = std::string::npos);
     void confirmationPrompt(std::string label);
+    void bleStatus(BleStatusEnum status) override;
     void debug(const std::string& message) override;
+    void wipeTextCache() override;
     void drawVaultIcon(int x = 86, int y = 10, uint16_t color = PRIMARY_COLOR, size_t w=70, size_t h=50);
     void drawFileIcon(int x = 92, int y = 10);
     void drawSettingsIcon(int x = 80, int y = 5);
@@ -58,20 +78,115 @@ public:
     void drawPlusIcon(int x=120, int y=47, uint16_t color = PRIMARY_COLOR);
     void drawMinusIcon(int x=120, int y=47, uint16_t color = PRIMARY_COLOR);
     void drawLockIcon(int x=120, int y=78, uint16_t color = PRIMARY_COLOR, size_t w=60, size_t h=45);
+protected:
+    // Shared by the device and headless backends, panel is null when there is no screen
+    void initializeCanvas(M5GFX* panel);
+    // Called with the dirty band of each frame, before it is pushed
+    virtual void onPresent(int16_t top, int16_t bottom) {}
+
+    static lgfx::LovyanGFX* Display; // Draw target, the off-screen canvas when available
+    static M5GFX* Panel; // Physical screen
+    M5Canvas canvas;
+    bool canvasReady = false;
+
 private:
-    static M5GFX* Display; // Variable statique pour l'affichage
+    // What is currently drawn on screen, used to repaint only what changed
+    struct TopBarState {
+        bool valid = false;
+        std::string title;
+        bool submenu = false;
+        bool searchBar = false;
+    };
+
+    // Buttons drawn once at startup, then copied into each frame
+    enum class Button { PromptBack, PromptOk, PromptOkDisabled, ConfirmBack, ConfirmOk, Count };
+
+    struct PromptState {
+        bool valid = false;
+        std::string label;
+        bool backButton = false;
+        bool okEnabled = false;
+        size_t viewStart = 0; // first visible char of the input
+    };
+
+    struct ProgressState {
+        bool valid = false;
+        std::string label;
+        std::string hint;
+    };
+
+    struct VerticalListState {
+        bool valid = false;
+        bool withLabels = false;
+        bool withShortcuts = false;
+        size_t startRow = 0;
+        size_t visibleRows = 0;
+        uint16_t selectedIndex = 0;
+        std::vector<std::string> rows; // visible rows only
+        std::vector<std::string> labels;
+        std::vector<std::string> shortcuts;
+    };
+
+    bool dmaPending = false;
+    BleStatusEnum bleIndicator = BleStatusEnum::Off;
+    volatile uint8_t brightness = 0; // also written by the fade timer
+    uint8_t fadeTarget = 0;
+    uint8_t fadeStep = 1;
+    int16_t dirtyTop = -1;
+    int16_t dirtyBottom = -1;
+    uint32_t frameStartUs = 0;
+    TopBarState topBarState;
+    VerticalListState listState;
+    PromptState promptState;
+    ProgressState progressState;
+    LatencyManager& latency = LatencyManager::getInstance();
+    GlobalState& globalState = GlobalState::getInstance();
+
+    // Message left on the panel until its expiry or a key, whichever comes first
+    bool toastPending = false;
+    bool toastArmed = false; // a wait went by since it was shown
+    uint32_t toastUntilMs = 0;
+    TextMetricsCache textMetrics;
+    M5Canvas buttonSprites[static_cast<size_t>(Button::Count)];
+    bool buttonSpritesReady = false;
+    M5Canvas iconAtlas; // 2 bits palette, one cell per IconEnum, index 0 is transparent
+    bool iconAtlasReady = false;
+
+    static void onFadeTimer(void* arg);
+    void stepFade();
+    void beginFrame();
+    void settleToast(bool keyHandled);
+    void markDirty(int16_t y, int16_t h);
+    void present();
+    void waitPush();
+    void drawLatencyOverlay();
     void drawRect(bool selected, uint8_t margin, uint16_t startY, uint16_t sizeX, uint16_t sizeY, uint16_t stepY);
     void drawSubMenuReturn(uint8_t x, uint8_t y);
     void drawSearchIcon(int x, int y, int size, uint16_t color);
+    void drawBleIndicator();
     void clearMainView(uint8_t offsetY = 0);
     void clearTopBar();
+    void invalidate();
+    bool canRepaintRows(size_t startRow, size_t visibleRows, bool withLabels, bool withShortcuts,
+                        const std::vector<std::string>& rows,
+                        const std::vector<std::string>& labels,
+                        const std::vector<std::string>& shortcuts) const;
+    void drawSimpleRow(size_t row, const std::string& option, bool selected);
+    void drawLabeledRow(size_t row, const std::string& option, const std::string& label, const std::string& shortcut, bool selected);
+    int16_t measureText(const std::string& text, bool cache = true); // no cache for values and prompts
     int getCenterOffset(const std::string& text, int screenWidth=240);
+    void createButtonSprites();
+    void renderButton(lgfx::LovyanGFX* target, Button button, int x, int y);
+    void drawButton(Button button, int x, int y);
+    void createIconAtlas();
+    void renderIcon(IconEnum icon, int offsetX, int offsetY);
+    void drawMenuIcon(IconEnum icon);
     std::string truncateString(const std::string& input, size_t maxLength);
-    void adjustTextSizeToFit(const std::string& text, uint16_t maxWidth, float textSize);
+    void adjustTextSizeToFit(const std::string& text, uint16_t maxWidth, float textSize, bool cache = true);
     void horizontalSelectionWithIcons(
         const std::vector<std::string>& options,
         uint16_t selectedIndex,
-        const std::vector<std::string>& icons);
+        const std::vector<IconEnum>& icons);
     void horizontalSelectionWithoutIcons(
         const std::vector<std::string>& options,
         uint16_t selectedIndex,
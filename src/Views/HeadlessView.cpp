@@ -0,0 +1,117 @@
+#include "HeadlessView.h"
+#include <cstdio>
+#include <cstdlib>
+
+namespace views {
+
+HeadlessView::HeadlessView(IInput& input) : CardputerView(input) {}
+
+void HeadlessView::initialize() {
+    initializeCanvas(nullptr);
+    previousFrame.assign(framebuffer(), framebuffer() + SCREEN_WIDTH * SCREEN_HEIGHT);
+}
+
+uint16_t HeadlessView::pixel(int16_t x, int16_t y) {
+    return canvas.readPixel(x, y);
+}
+
+const uint16_t* HeadlessView::framebuffer() const {
+    return static_cast<const uint16_t*>(canvas.getBuffer());
+}
+
+bool HeadlessView::savePng(const std::string& path) {
+    size_t length = 0;
+    void* png = canvas.createPng(&length, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    if (!png) {
+        return false;
+    }
+
+    FILE* file = fopen(path.c_str(), "wb");
+    bool saved = file && fwrite(png, 1, length, file) == length;
+    if (file) {
+        fclose(file);
+    }
+    free(png);
+    return saved;
+}
+
+bool HeadlessView::matchesPng(const std::string& path, uint32_t* mismatches) const {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    std::vector<uint8_t> png(length > 0 ? length : 0);
+    bool read = fread(png.data(), 1, png.size(), file) == png.size();
+    fclose(file);
+    if (!read) {
+        return false;
+    }
+
+    // Decode the golden into a canvas of the same format and compare raw pixels
+    M5Canvas expected;
+    expected.setColorDepth(16);
+    if (!expected.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT)) {
+        return false;
+    }
+    expected.fillSprite(BACKGROUND_COLOR);
+    if (!expected.drawPng(png.data(), png.size(), 0, 0)) {
+        return false; // not a PNG, mismatches left at 0
+    }
+
+    auto expectedPixels = static_cast<const uint16_t*>(expected.getBuffer());
+    auto actualPixels = framebuffer();
+    uint32_t count = 0;
+    for (size_t i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; ++i) {
+        if (expectedPixels[i] != actualPixels[i]) {
+            count++;
+        }
+    }
+
+    if (mismatches) {
+        *mismatches = count;
+    }
+    return count == 0;
+}
+
+const FrameMetrics& HeadlessView::getFrameMetrics() const {
+    return frameMetrics;
+}
+
+void HeadlessView::resetFrameMetrics() {
+    frameMetrics = FrameMetrics();
+}
+
+void HeadlessView::onPresent(int16_t top, int16_t bottom) {
+    // Compare with what the panel shows, only the dirty band reaches it
+    auto current = framebuffer();
+    size_t bandStart = top * SCREEN_WIDTH;
+    size_t bandEnd = bottom * SCREEN_WIDTH;
+    uint32_t changed = 0;
+    uint32_t missed = 0;
+    for (size_t i = 0; i < previousFrame.size(); ++i) {
+        if (current[i] == previousFrame[i]) {
+            continue;
+        }
+        if (i >= bandStart && i < bandEnd) {
+            previousFrame[i] = current[i];
+            changed++;
+        } else {
+            missed++;
+        }
+    }
+
+    uint32_t pushed = (bottom - top) * SCREEN_WIDTH;
+    frameMetrics.frames++;
+    frameMetrics.lastPixelsPushed = pushed;
+    frameMetrics.lastPixelsChanged = changed;
+    frameMetrics.lastPixelsMissed = missed;
+    frameMetrics.totalPixelsPushed += pushed;
+    frameMetrics.totalPixelsChanged += changed;
+    frameMetrics.totalPixelsMissed += missed;
+}
+
+}
@@ -0,0 +1,50 @@
+#ifndef HEADLESS_VIEW_H
+#define HEADLESS_VIEW_H
+
+#include <string>
+#include <vector>
+#include "CardputerView.h"
+
+namespace views {
+
+// Pixels per frame, pushed is what the panel would receive, changed is what really differs
+struct FrameMetrics {
+    uint32_t frames = 0;
+    uint32_t lastPixelsPushed = 0;
+    uint32_t lastPixelsChanged = 0;
+    uint32_t lastPixelsMissed = 0; // changed outside the dirty band, never reach the panel
+    uint64_t totalPixelsPushed = 0;
+    uint64_t totalPixelsChanged = 0;
+    uint64_t totalPixelsMissed = 0;
+
+    // Pushed pixels per changed pixel, 1.0 means nothing was redrawn for nothing
+    float overdraw() const {
+        return totalPixelsChanged ? static_cast<float>(totalPixelsPushed) / totalPixelsChanged : 0.0f;
+    }
+};
+
+// Same layouts as CardputerView, rendered in memory only, for host side golden and performance tests
+class HeadlessView : public CardputerView {
+public:
+    explicit HeadlessView(IInput& input);
+    void initialize() override;
+
+    uint16_t pixel(int16_t x, int16_t y); // RGB565
+    const uint16_t* framebuffer() const; // 240x135, byte swapped RGB565 like the panel
+    bool savePng(const std::string& path);
+    bool matchesPng(const std::string& path, uint32_t* mismatches = nullptr) const;
+
+    const FrameMetrics& getFrameMetrics() const;
+    void resetFrameMetrics();
+
+protected:
+    void onPresent(int16_t top, int16_t bottom) override;
+
+private:
+    std::vector<uint16_t> previousFrame; // what the panel would show before this frame
+    FrameMetrics frameMetrics;
+};
+
+}
+
+#endif // HEADLESS_VIEW_H
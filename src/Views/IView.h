@@ -4,6 +4,9 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <Enums/IconEnum.h>
+#include <Enums/BleStatusEnum.h>
+#include <Models/QrBitmap.h>
 
 class IView {
 public:
@@ -13,14 +16,19 @@ public:
     virtual void welcome(uint8_t defaultBrightness=100) = 0;
     virtual void setBrightness(uint16_t brightness) = 0;
     virtual uint8_t getBrightness() = 0;
+    virtual void fadeBrightness(uint8_t target, uint32_t durationMs) = 0; // returns at once, setBrightness() stops it
     virtual void topBar(const std::string& title, bool submenu, bool searchBar) = 0;
-    virtual void horizontalSelection(const std::vector<std::string>& options, uint16_t selectedIndex, const std::string& description1="", const std::string& description2="", const std::vector<std::string>& icons={}) = 0;
+    virtual void horizontalSelection(const std::vector<std::string>& options, uint16_t selectedIndex, const std::string& description1="", const std::string& description2="", const std::vector<IconEnum>& icons={}) = 0;
     virtual void verticalSelection(const std::vector<std::string>& options, uint16_t selectedIndex, size_t visibleRows = 4, const std::vector<std::string>& optionLabels = {}, const std::vector<std::string>& shortcuts = {}, bool visibleMention=false) = 0;
     virtual void value(std::string label, std::string val) = 0; 
     virtual void subMessage(std::string message, int delayMs) = 0;
-    virtual void stringPrompt(std::string label, std::string value, bool backButton, size_t minLength) = 0;
+    virtual void progress(std::string label, uint8_t percent, std::string hint) = 0;
+    virtual void qrCode(const std::string& label, const QrBitmap& bitmap) = 0;
+    virtual void stringPrompt(std::string label, std::string value, bool backButton, size_t minLength, size_t cursor = std::string::npos) = 0;
     virtual void confirmationPrompt(std::string label) = 0;
+    virtual void bleStatus(BleStatusEnum status) = 0;
     virtual void debug(const std::string& message) = 0;
+    virtual void wipeTextCache() = 0; // on lock, cached strings may have been on screen
 };
 
 #endif
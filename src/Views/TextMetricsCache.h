@@ -0,0 +1,79 @@
+#ifndef TEXT_METRICS_CACHE_H
+#define TEXT_METRICS_CACHE_H
+
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace views {
+
+// Text widths by string, font and size, least recently used entry is replaced
+class TextMetricsCache {
+public:
+    static const size_t capacity = 32;
+
+    // Cached width, or measure() once and keep it
+    template <typename Measure>
+    int16_t width(const std::string& text, const void* font, float size, Measure measure) {
+        uint16_t sizeKey = static_cast<uint16_t>(size * 100 + 0.5f);
+        size_t hash = std::hash<std::string>{}(text);
+        tick++;
+
+        Entry* oldest = &entries[0];
+        for (auto& entry : entries) {
+            if (entry.used && entry.hash == hash && entry.sizeKey == sizeKey &&
+                entry.font == font && entry.text == text) {
+                entry.lastUse = tick;
+                hits++;
+                return entry.width;
+            }
+            if (!entry.used || (oldest->used && entry.lastUse < oldest->lastUse)) {
+                oldest = &entry;
+            }
+        }
+
+        misses++;
+        oldest->used = true;
+        oldest->hash = hash;
+        oldest->sizeKey = sizeKey;
+        oldest->font = font;
+        oldest->text = text;
+        oldest->width = measure();
+        oldest->lastUse = tick;
+        return oldest->width;
+    }
+
+    // Zeroed in place, not just released, the strings may have been secrets
+    void clear() {
+        for (auto& entry : entries) {
+            std::fill(entry.text.begin(), entry.text.end(), '\0');
+            entry.text.clear();
+            entry = Entry();
+        }
+    }
+
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+
+private:
+    struct Entry {
+        bool used = false;
+        size_t hash = 0;
+        uint16_t sizeKey = 0;
+        const void* font = nullptr;
+        std::string text;
+        int16_t width = 0;
+        uint32_t lastUse = 0;
+    };
+
+    std::array<Entry, capacity> entries;
+    uint32_t tick = 0;
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+};
+
+}
+
+#endif // TEXT_METRICS_CACHE_H
@@ -13,8 +13,8 @@ void setup() {
     auto cfg = M5.config();
     M5Cardputer.begin(cfg, true);
 
-    CardputerView display;
     CardputerInput input;
+    CardputerView display(input);
 
     DependencyProvider provider(display, input);
     provider.setup();
@@ -112,6 +112,48 @@ void test_handleEntryUpdate() {
     TEST_ASSERT_EQUAL_STRING("johny", entries[0].getUsername().c_str());
 }
 
+void test_handleEntryUpdate_stops_when_locked() {
+    MockView mockDisplay;
+    MockInput mockInput;
+    EntryRepository entryRepository;
+    EntryService entryService(entryRepository);
+    CryptoService cryptoService;
+    UsbService usbService;
+    LedService ledService;
+    NvsService nvsService;
+    ModelTransformer modelTransformer;
+    InactivityManager inactivityManager(mockDisplay);
+    GlobalState& globalState = GlobalState::getInstance();
+
+    StringPromptSelector stringPromptSelector(mockDisplay, mockInput);
+    VerticalSelector verticalSelector(mockDisplay, mockInput, inactivityManager);
+    HorizontalSelector horizontalSelector(mockDisplay, mockInput, inactivityManager);
+    FieldActionSelector fieldActionSelector(mockDisplay, mockInput, inactivityManager);
+    ConfirmationSelector confirmationSelector(mockDisplay, mockInput);
+
+    EntryController controller(mockDisplay, mockInput, horizontalSelector, verticalSelector,
+                               fieldActionSelector, confirmationSelector, stringPromptSelector,
+                               entryService, cryptoService, usbService, ledService, nvsService, modelTransformer);
+
+    Entry entry("Gmail", "john", "pass", "note");
+    entryService.addEntry(entry);
+
+    // Locked while the prompt is open, keys still pending
+    globalState.setVaultIsLocked(true);
+    mockInput.enqueueKey(KEY_OK);
+
+    Field field("User", "john", "U");
+    bool result = controller.handleEntryUpdate(entry, field);
+    globalState.setVaultIsLocked(false);
+
+    TEST_ASSERT_FALSE(result); // the dispatcher saves the vault only on true
+    TEST_ASSERT_EQUAL_STRING("john", field.getValue().c_str());
+    TEST_ASSERT_EQUAL_STRING("john", entry.getUsername().c_str());
+    auto entries = entryService.getAllEntries();
+    TEST_ASSERT_EQUAL(1, entries.size());
+    TEST_ASSERT_EQUAL_STRING("john", entries[0].getUsername().c_str());
+}
+
 void test_handleEntryDeletion() {
     MockView mockDisplay;
     MockInput mockInput;
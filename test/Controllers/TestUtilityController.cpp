@@ -5,6 +5,7 @@
 #include "../src/Controllers/UtilityController.h"
 #include "../src/Services/NvsService.h"
 #include "../src/Services/UsbService.h"
+#include "../src/Services/BleService.h"
 #include "../src/Services/LedService.h"
 #include "../src/Services/SdService.h"
 #include "../src/Selectors/HorizontalSelector.h"
@@ -13,6 +14,7 @@
 #include "../src/Selectors/StringPromptSelector.h"
 #include "../src/Selectors/ConfirmationSelector.h"
 #include "../src/Managers/InactivityManager.h"
+#include "../src/Managers/BleConnectionManager.h"
 #include "../src/Transformers/TimeTransformer.h"
 #include "../Views/MockView.h"
 #include "../Inputs/MockInput.h"
@@ -22,10 +24,15 @@ void test_handleGeneralSettings() {
     MockInput mockInput;
     NvsService nvsService;
     UsbService usbService;
+    BleService bleService;
     LedService ledService;
     SdService sdService;
+    TypingService typingService(usbService, bleService);
+    QrService qrService;
     InactivityManager inactivityManager(mockDisplay);
     TimeTransformer timeTransformer;
+    AutoTypeTransformer autoTypeTransformer;
+    BleConnectionManager bleConnectionManager(bleService, nvsService);
 
     HorizontalSelector horizontalSelector(mockDisplay, mockInput, inactivityManager);
     VerticalSelector verticalSelector(mockDisplay, mockInput, inactivityManager);
@@ -35,10 +42,96 @@ void test_handleGeneralSettings() {
 
     UtilityController controller(mockDisplay, mockInput, horizontalSelector, verticalSelector,
                                  fieldEditorSelector, stringPromptSelector, confirmationSelector,
-                                 usbService, ledService, nvsService, sdService, timeTransformer);
+                                 usbService, bleService, ledService, nvsService, sdService, typingService, qrService, timeTransformer,
+                                 autoTypeTransformer, bleConnectionManager);
 
     // Not really usefull to test it
     TEST_ASSERT_TRUE(true);
 }
 
+void test_handleLoadNvs_migrates_string_keys() {
+    MockView mockDisplay;
+    MockInput mockInput;
+    NvsService nvsService;
+    UsbService usbService;
+    BleService bleService;
+    LedService ledService;
+    SdService sdService;
+    TypingService typingService(usbService, bleService);
+    QrService qrService;
+    InactivityManager inactivityManager(mockDisplay);
+    TimeTransformer timeTransformer;
+    AutoTypeTransformer autoTypeTransformer;
+    BleConnectionManager bleConnectionManager(bleService, nvsService);
+    GlobalState& globalState = GlobalState::getInstance();
+
+    HorizontalSelector horizontalSelector(mockDisplay, mockInput, inactivityManager);
+    VerticalSelector verticalSelector(mockDisplay, mockInput, inactivityManager);
+    FieldEditorSelector fieldEditorSelector(mockDisplay, mockInput);
+    StringPromptSelector stringPromptSelector(mockDisplay, mockInput);
+    ConfirmationSelector confirmationSelector(mockDisplay, mockInput);
+
+    UtilityController controller(mockDisplay, mockInput, horizontalSelector, verticalSelector,
+                                 fieldEditorSelector, stringPromptSelector, confirmationSelector,
+                                 usbService, bleService, ledService, nvsService, sdService, typingService, qrService, timeTransformer,
+                                 autoTypeTransformer, bleConnectionManager);
+
+    // Settings of the device under test, put back at the end
+    Settings previous;
+    bool hadSettings = nvsService.getBytes(globalState.getNvsSettings(), &previous, sizeof(previous)) == sizeof(previous);
+    auto layout = globalState.getSelectedKeyboardLayout();
+    auto unicodeInput = globalState.getSelectedUnicodeInput();
+    auto brightness = globalState.getSelectedScreenBrightness();
+    auto screenTimeout = globalState.getInactivityScreenTimeout();
+    auto lockTimeout = globalState.getInactivityLockTimeout();
+    auto bleEnabled = globalState.getBleKeyboardEnabled();
+    auto bleDeviceName = globalState.getBleDeviceName();
+
+    // Saved by a firmware from before the settings blob
+    nvsService.remove(globalState.getNvsSettings());
+    nvsService.saveString(globalState.getNvsKeyboardLayout(), "German (DE)");
+    nvsService.saveString(globalState.getNvsUnicodeInput(), "macOS");
+    nvsService.saveString(globalState.getNvsScreenBrightness(), "60");
+    nvsService.saveString(globalState.getNvsInactivityScreenTimeout(), "3 minutes");
+    nvsService.saveString(globalState.getNvsInactivityLockTimeout(), "10 minutes");
+    nvsService.saveString(globalState.getNvsBleEnabled(), "1");
+    nvsService.saveString(globalState.getNvsBleDeviceName(), "Vault test");
+
+    controller.handleLoadNvs();
+
+    TEST_ASSERT_EQUAL_STRING("German (DE)", globalState.getSelectedKeyboardLayout().c_str());
+    TEST_ASSERT_EQUAL_STRING("macOS", globalState.getSelectedUnicodeInput().c_str());
+    TEST_ASSERT_EQUAL(60, globalState.getSelectedScreenBrightness());
+    TEST_ASSERT_EQUAL(3 * 60 * 1000, globalState.getInactivityScreenTimeout());
+    TEST_ASSERT_EQUAL(10 * 60 * 1000, globalState.getInactivityLockTimeout());
+    TEST_ASSERT_TRUE(globalState.getBleKeyboardEnabled());
+    TEST_ASSERT_EQUAL_STRING("Vault test", globalState.getBleDeviceName().c_str());
+
+    // The blob replaces the string keys
+    Settings stored;
+    TEST_ASSERT_EQUAL(sizeof(stored), nvsService.getBytes(globalState.getNvsSettings(), &stored, sizeof(stored)));
+    TEST_ASSERT_EQUAL_STRING("German (DE)", stored.keyboardLayout);
+    TEST_ASSERT_EQUAL_STRING("Vault test", stored.bleDeviceName);
+    TEST_ASSERT_EQUAL_STRING("default", nvsService.getString(globalState.getNvsKeyboardLayout(), "default").c_str());
+    TEST_ASSERT_EQUAL_STRING("default", nvsService.getString(globalState.getNvsBleDeviceName(), "default").c_str());
+
+    // Loaded again, the blob is read as is
+    globalState.setSelectedKeyboardLayout("");
+    controller.handleLoadNvs();
+    TEST_ASSERT_EQUAL_STRING("German (DE)", globalState.getSelectedKeyboardLayout().c_str());
+
+    if (hadSettings) {
+        nvsService.saveBytes(globalState.getNvsSettings(), &previous, sizeof(previous));
+    } else {
+        nvsService.remove(globalState.getNvsSettings());
+    }
+    globalState.setSelectedKeyboardLayout(layout);
+    globalState.setSelectedUnicodeInput(unicodeInput);
+    globalState.setSelectedScreenBrightness(brightness);
+    globalState.setInactivityScreenTimeout(screenTimeout);
+    globalState.setInactivityLockTimeout(lockTimeout);
+    globalState.setBleKeyboardEnabled(bleEnabled);
+    globalState.setBleDeviceName(bleDeviceName);
+}
+
 #endif // TEST_UTILITY_CONTROLLER
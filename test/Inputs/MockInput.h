@@ -13,19 +13,52 @@ public:
         inputQueue.push(key);
     }
 
+    void initialize() override {}
+
     char handler() override {
+        if (idleListener) {
+            idleListener(keyHandedOut);
+        }
+        keyHandedOut = false;
+
         if (inputQueue.empty()) {
             return KEY_NONE;
         }
         char key = inputQueue.front();
         inputQueue.pop();
+        keyHandedOut = true;
         return key;
     }
 
-    void waitPress() override {}
+    void waitPress() override {
+        if (idleListener) {
+            idleListener(keyHandedOut);
+        }
+        keyHandedOut = true;
+    }
+
+    char waitKey(uint32_t timeoutMs) override {
+        return handler();
+    }
+
+    void postKey(char key) override {
+        enqueueKey(key);
+    }
+
+    void setActivityListener(std::function<void()> listener) override {
+        activityListener = listener;
+    }
+
+    void setIdleListener(std::function<void(bool keyHandled)> listener) override {
+        idleListener = listener;
+    }
+
+    std::function<void()> activityListener;
+    std::function<void(bool keyHandled)> idleListener;
 
 private:
     std::queue<char> inputQueue;
+    bool keyHandedOut = false;
 };
 
 #endif // MOCK_INPUT_H
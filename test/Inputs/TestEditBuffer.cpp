@@ -0,0 +1,52 @@
+#ifndef TEST_EDIT_BUFFER_H
+#define TEST_EDIT_BUFFER_H
+
+#include <unity.h>
+#include "../src/Inputs/EditBuffer.h"
+
+void test_edit_buffer_insert_at_cursor() {
+    EditBuffer buffer("Jhn");
+
+    TEST_ASSERT_EQUAL(3, buffer.cursor());
+    buffer.moveLeft();
+    buffer.moveLeft();
+    buffer.insert('o');
+
+    TEST_ASSERT_EQUAL_STRING("John", buffer.text().c_str());
+    TEST_ASSERT_EQUAL(2, buffer.cursor());
+}
+
+void test_edit_buffer_delete_both_sides() {
+    EditBuffer buffer("abcd");
+    buffer.home();
+
+    TEST_ASSERT_FALSE(buffer.backspace());
+    TEST_ASSERT_TRUE(buffer.deleteForward());
+    TEST_ASSERT_EQUAL_STRING("bcd", buffer.text().c_str());
+
+    buffer.end();
+    TEST_ASSERT_FALSE(buffer.deleteForward());
+    TEST_ASSERT_TRUE(buffer.backspace());
+    TEST_ASSERT_EQUAL_STRING("bc", buffer.text().c_str());
+}
+
+void test_edit_buffer_word_moves() {
+    EditBuffer buffer("my secret pass");
+
+    TEST_ASSERT_TRUE(buffer.wordLeft());
+    TEST_ASSERT_EQUAL(10, buffer.cursor());
+    buffer.wordLeft();
+    TEST_ASSERT_EQUAL(3, buffer.cursor());
+    buffer.wordRight();
+    TEST_ASSERT_EQUAL(10, buffer.cursor());
+}
+
+void test_edit_buffer_limit() {
+    EditBuffer buffer("ab", 3);
+
+    TEST_ASSERT_TRUE(buffer.insert('c'));
+    TEST_ASSERT_FALSE(buffer.insert('d'));
+    TEST_ASSERT_EQUAL_STRING("abc", buffer.text().c_str());
+}
+
+#endif // TEST_EDIT_BUFFER_H
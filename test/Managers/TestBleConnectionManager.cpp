@@ -0,0 +1,54 @@
+#ifndef TEST_BLE_CONNECTION_MANAGER_H
+#define TEST_BLE_CONNECTION_MANAGER_H
+
+#include <unity.h>
+#include "../src/Managers/BleConnectionManager.h"
+#include "../src/Services/BleService.h"
+#include "../src/Services/NvsService.h"
+
+void test_ble_profile_round_trip() {
+    BleService bleService;
+    NvsService nvsService;
+    BleConnectionManager bleConnectionManager(bleService, nvsService);
+
+    BleConnectionManager::HostProfile saved;
+    saved.layout = "French (FR)";
+    saved.typingDelayMs = 20;
+    saved.unicodeInput = "Linux";
+    bleConnectionManager.saveProfile("AA:BB:CC:DD:EE:FF", saved);
+
+    BleConnectionManager::HostProfile loaded;
+    TEST_ASSERT_TRUE(bleConnectionManager.loadProfile("AA:BB:CC:DD:EE:FF", loaded));
+    TEST_ASSERT_EQUAL_STRING("French (FR)", loaded.layout.c_str());
+    TEST_ASSERT_EQUAL(20, loaded.typingDelayMs);
+    TEST_ASSERT_EQUAL_STRING("Linux", loaded.unicodeInput.c_str());
+
+    // Stored without the colons, NVS keys are 15 chars max
+    TEST_ASSERT_EQUAL_STRING("French (FR);20;Linux", nvsService.getString("bhAABBCCDDEEFF").c_str());
+    nvsService.remove("bhAABBCCDDEEFF");
+}
+
+void test_ble_profile_without_input_takes_the_current_one() {
+    BleService bleService;
+    NvsService nvsService;
+    BleConnectionManager bleConnectionManager(bleService, nvsService);
+    GlobalState& globalState = GlobalState::getInstance();
+    auto selectedInput = globalState.getSelectedUnicodeInput();
+    globalState.setSelectedUnicodeInput("Windows");
+
+    // Saved before the input method was part of the profile
+    nvsService.saveString("bh112233445566", "German (DE);8");
+    BleConnectionManager::HostProfile loaded;
+    TEST_ASSERT_TRUE(bleConnectionManager.loadProfile("11:22:33:44:55:66", loaded));
+    TEST_ASSERT_EQUAL_STRING("German (DE)", loaded.layout.c_str());
+    TEST_ASSERT_EQUAL(8, loaded.typingDelayMs);
+    TEST_ASSERT_EQUAL_STRING("Windows", loaded.unicodeInput.c_str());
+
+    // Unknown host
+    nvsService.remove("bh112233445566");
+    TEST_ASSERT_FALSE(bleConnectionManager.loadProfile("11:22:33:44:55:66", loaded));
+
+    globalState.setSelectedUnicodeInput(selectedInput);
+}
+
+#endif // TEST_BLE_CONNECTION_MANAGER_H
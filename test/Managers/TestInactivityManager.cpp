@@ -0,0 +1,90 @@
+#ifndef TEST_INACTIVITY_MANAGER_H
+#define TEST_INACTIVITY_MANAGER_H
+
+#include <unity.h>
+#include "../src/Managers/InactivityManager.h"
+#include "../Views/MockView.h"
+#include "../Inputs/MockInput.h"
+
+void test_inactivity_manager_dim_does_not_block() {
+    MockView mockView;
+    InactivityManager inactivityManager(mockView);
+    mockView.setBrightness(140);
+
+    unsigned long start = millis();
+    inactivityManager.dimScreen();
+    inactivityManager.shutdownScreen();
+
+    // The former ramp took 5 ms per brightness unit
+    TEST_ASSERT_TRUE(millis() - start < 20);
+    TEST_ASSERT_TRUE(mockView.fadeCalled);
+    TEST_ASSERT_EQUAL(1, mockView.getBrightness());
+}
+
+void test_inactivity_manager_restore_is_instant() {
+    MockView mockView;
+    InactivityManager inactivityManager(mockView);
+    mockView.setBrightness(140);
+
+    inactivityManager.dimScreen();
+    inactivityManager.reset();
+
+    TEST_ASSERT_EQUAL(GlobalState::getInstance().getSelectedScreenBrightness(), mockView.getBrightness());
+}
+
+void test_inactivity_manager_lock_only_flags() {
+    MockView mockView;
+    InactivityManager inactivityManager(mockView);
+    mockView.setBrightness(140);
+    inactivityManager.shutdownScreen();
+    GlobalState& globalState = GlobalState::getInstance();
+    globalState.setLoadedVaultPassword("hunter2");
+
+    inactivityManager.lockVault();
+
+    // The timer task leaves the secrets to the UI task
+    TEST_ASSERT_TRUE(inactivityManager.getVaultIsLocked());
+    TEST_ASSERT_EQUAL_STRING("hunter2", globalState.getLoadedVaultPassword().c_str());
+
+    // A key does not light the screen of a locked device
+    inactivityManager.activity();
+    TEST_ASSERT_EQUAL(1, mockView.getBrightness());
+
+    globalState.setLoadedVaultPassword("");
+    globalState.setVaultIsLocked(false);
+}
+
+void test_inactivity_manager_deadlines_fire() {
+    MockView mockView;
+    MockInput mockInput;
+    GlobalState& globalState = GlobalState::getInstance();
+    auto dimTimeout = globalState.getInactivityBrightnessTimeout();
+    auto screenTimeout = globalState.getInactivityScreenTimeout();
+    auto lockTimeout = globalState.getInactivityLockTimeout();
+    globalState.setInactivityBrightnessTimeout(20);
+    globalState.setInactivityScreenTimeout(40);
+    globalState.setInactivityLockTimeout(60);
+    mockView.setBrightness(140);
+
+    {
+        InactivityManager inactivityManager(mockView);
+        inactivityManager.begin(mockInput);
+
+        // A key restarts the three deadlines
+        delay(30);
+        mockInput.activityListener();
+        TEST_ASSERT_FALSE(inactivityManager.getVaultIsLocked());
+
+        delay(100);
+        TEST_ASSERT_TRUE(inactivityManager.getVaultIsLocked());
+        TEST_ASSERT_EQUAL(1, mockView.getBrightness());
+        TEST_ASSERT_EQUAL(KEY_LOCK, mockInput.handler());
+    }
+
+    globalState.setInactivityBrightnessTimeout(dimTimeout);
+    globalState.setInactivityScreenTimeout(screenTimeout);
+    globalState.setInactivityLockTimeout(lockTimeout);
+    globalState.setVaultIsLocked(false);
+}
+
+#endif // TEST_INACTIVITY_MANAGER_H
@@ -0,0 +1,96 @@
+#ifndef TEST_LATENCY_MANAGER_H
+#define TEST_LATENCY_MANAGER_H
+
+#include <unity.h>
+#include "../src/Managers/LatencyManager.h"
+
+void test_latency_histogram_summary() {
+    LatencyHistogram histogram;
+
+    for (uint32_t i = 1; i <= 100; ++i) {
+        histogram.add(i);
+    }
+
+    auto summary = histogram.summary();
+    TEST_ASSERT_EQUAL(100, summary.count);
+    TEST_ASSERT_EQUAL(1, summary.min);
+    TEST_ASSERT_EQUAL(51, summary.median);
+    TEST_ASSERT_EQUAL(99, summary.p99);
+    TEST_ASSERT_EQUAL(100, summary.max);
+}
+
+void test_latency_histogram_keeps_last_samples() {
+    LatencyHistogram histogram;
+
+    // Old slow samples are overwritten
+    for (size_t i = 0; i < LatencyHistogram::capacity; ++i) {
+        histogram.add(50000);
+    }
+    for (size_t i = 0; i < LatencyHistogram::capacity; ++i) {
+        histogram.add(1000);
+    }
+
+    auto summary = histogram.summary();
+    TEST_ASSERT_EQUAL(LatencyHistogram::capacity, summary.count);
+    TEST_ASSERT_EQUAL(1000, summary.max);
+}
+
+void test_latency_manager_records_drawn_keys_only() {
+    auto& latency = LatencyManager::getInstance();
+    latency.reset();
+
+    // Key drawn
+    latency.keyHandled(micros());
+    latency.stateChanged();
+    latency.framePresented(4000, 300, 240 * 20);
+    latency.inputIdle();
+
+    // Key ignored by the UI
+    latency.keyHandled(micros());
+    latency.inputIdle();
+
+    TEST_ASSERT_EQUAL(1, latency.getTotalStage().size());
+    TEST_ASSERT_EQUAL(1, latency.getDrawStage().size());
+}
+
+void test_latency_manager_records_light_sleep() {
+    auto& latency = LatencyManager::getInstance();
+    latency.reset();
+
+    latency.sleptFor(30000);
+    latency.sleptFor(30000);
+    latency.wokeToKey(16000);
+    latency.keyDropped();
+
+    TEST_ASSERT_EQUAL(2, latency.getSleeps());
+    TEST_ASSERT_EQUAL(1, latency.getDroppedKeys());
+    TEST_ASSERT_EQUAL(1, latency.getWakeStage().size());
+    TEST_ASSERT_TRUE(latency.sleepResidencyPercent() <= 100);
+
+    latency.reset();
+    TEST_ASSERT_EQUAL(0, latency.getSleeps());
+    TEST_ASSERT_EQUAL(0, latency.getDroppedKeys());
+    TEST_ASSERT_EQUAL(0, latency.getWakeStage().size());
+}
+
+void test_latency_manager_records_every_frame() {
+    auto& latency = LatencyManager::getInstance();
+    latency.reset();
+
+    // No key pending, frames are still counted
+    latency.framePresented(4000, 300, 240 * 20);
+    latency.framePresented(6000, 300, 240 * 135);
+    latency.pushWaited(2000);
+
+    TEST_ASSERT_EQUAL(2, latency.getFrames());
+    TEST_ASSERT_EQUAL(2, latency.getComposeStage().size());
+    TEST_ASSERT_EQUAL(6000, latency.getComposeStage().summary().max);
+    TEST_ASSERT_EQUAL(1, latency.getDmaWaitStage().size());
+    TEST_ASSERT_EQUAL(0, latency.getTotalStage().size());
+
+    latency.reset();
+    TEST_ASSERT_EQUAL(0, latency.getFrames());
+    TEST_ASSERT_EQUAL(0, latency.getPushStage().size());
+}
+
+#endif // TEST_LATENCY_MANAGER_H
@@ -0,0 +1,33 @@
+#ifndef TEST_POWER_MANAGER_H
+#define TEST_POWER_MANAGER_H
+
+#include <unity.h>
+#include "../src/Managers/PowerManager.h"
+
+void test_power_manager_nested_holds_keep_max_frequency() {
+    PowerManager& power = PowerManager::getInstance();
+    power.begin();
+    TEST_ASSERT_EQUAL(80, power.getCpuMhz());
+
+    {
+        PowerManager::Hold outer(PowerLock::CpuMax);
+        TEST_ASSERT_EQUAL(240, power.getCpuMhz());
+        {
+            PowerManager::Hold inner(PowerLock::CpuMax);
+        }
+        // Still held by the outer scope
+        TEST_ASSERT_EQUAL(240, power.getCpuMhz());
+    }
+
+    TEST_ASSERT_EQUAL(80, power.getCpuMhz());
+}
+
+void test_power_manager_bus_lock_leaves_cpu_low() {
+    PowerManager& power = PowerManager::getInstance();
+    power.begin();
+
+    PowerManager::Hold bus(PowerLock::Bus);
+    TEST_ASSERT_EQUAL(80, power.getCpuMhz());
+}
+
+#endif // TEST_POWER_MANAGER_H
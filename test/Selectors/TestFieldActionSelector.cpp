@@ -62,4 +62,17 @@ void test_field_action_selector_cancel() {
     TEST_ASSERT_TRUE(mockView.valueCalled);
 }
 
+void test_field_action_selector_show_qr() {
+    MockView mockView;
+    MockInput mockInput;
+    InactivityManager inactivityManager(mockView);
+    FieldActionSelector fieldActionSelector(mockView, mockInput, inactivityManager);
+
+    mockInput.enqueueKey('q');
+
+    ActionEnum action = fieldActionSelector.select("Pass", "secret");
+
+    TEST_ASSERT_EQUAL(ActionEnum::ShowQr, action);
+}
+
 #endif // TEST_FIELD_ACTION_SELECTOR_H
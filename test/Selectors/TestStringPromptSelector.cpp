@@ -19,9 +19,10 @@ void test_string_selector_confirm() {
     mockInput.enqueueKey('n');
     mockInput.enqueueKey(KEY_OK);
 
-    std::string result = stringPrompt.select("Test", description);
+    auto result = stringPrompt.select("Test", description);
 
-    TEST_ASSERT_EQUAL_STRING("John", result.c_str());
+    TEST_ASSERT_TRUE(result.has_value());
+    TEST_ASSERT_EQUAL_STRING("John", result->c_str());
     TEST_ASSERT_TRUE(mockView.topBarCalled);
     TEST_ASSERT_TRUE(mockView.stringPromptCalled);
     TEST_ASSERT_EQUAL_STRING("Test", mockView.lastTitle.c_str());
@@ -36,12 +37,61 @@ void test_string_selector_cancel() {
     std::string description = "Enter your name:";
     mockInput.enqueueKey(KEY_ESC_CUSTOM);
 
-    std::string result = stringPrompt.select("Title", description);
+    auto result = stringPrompt.select("Title", description);
 
-    TEST_ASSERT_EQUAL_STRING("", result.c_str());
+    TEST_ASSERT_FALSE(result.has_value());
     TEST_ASSERT_TRUE(mockView.topBarCalled);
     TEST_ASSERT_TRUE(mockView.stringPromptCalled);
     TEST_ASSERT_EQUAL_STRING("Title", mockView.lastTitle.c_str());
 }
 
+void test_string_selector_insert_at_cursor() {
+    MockView mockView;
+    MockInput mockInput;
+
+    StringPromptSelector stringPrompt(mockView, mockInput);
+
+    // "Jhn" -> back two chars -> "John"
+    mockInput.enqueueKey(KEY_CURSOR_LEFT);
+    mockInput.enqueueKey(KEY_CURSOR_LEFT);
+    mockInput.enqueueKey('o');
+
+    std::string description = "Enter your name:";
+    mockInput.enqueueKey(KEY_OK);
+    auto result = stringPrompt.select("Test", description, "Jhn");
+
+    TEST_ASSERT_EQUAL_STRING("John", result->c_str());
+    TEST_ASSERT_EQUAL_STRING("John", mockView.promptValue.c_str());
+    TEST_ASSERT_EQUAL(2, mockView.promptCursor);
+}
+
+void test_string_selector_returns_when_locked() {
+    MockView mockView;
+    MockInput mockInput;
+    StringPromptSelector stringPromptSelector(mockView, mockInput);
+
+    // Locked, the KEY_LOCK event itself was lost, keys still pending
+    GlobalState::getInstance().setVaultIsLocked(true);
+    mockInput.enqueueKey('a');
+    mockInput.enqueueKey(KEY_OK);
+
+    auto result = stringPromptSelector.select("Open encrypted vault", "Enter master password", "", false, true);
+    GlobalState::getInstance().setVaultIsLocked(false);
+
+    TEST_ASSERT_FALSE(result.has_value()); // not an empty password
+}
+
+void test_string_selector_accepts_empty_input() {
+    MockView mockView;
+    MockInput mockInput;
+    StringPromptSelector stringPromptSelector(mockView, mockInput);
+
+    mockInput.enqueueKey(KEY_OK);
+
+    auto result = stringPromptSelector.select("Notes (Optionnal)", "Enter notes (OK to pass)", "", false, true, false, 0);
+
+    TEST_ASSERT_TRUE(result.has_value());
+    TEST_ASSERT_EQUAL_STRING("", result->c_str());
+}
+
 #endif // TEST_STRING_SELECTOR_H
@@ -69,4 +69,61 @@ void test_vertical_selector_shortcut() {
     TEST_ASSERT_EQUAL(1, selectedIndex); // "Create Vault" index 1
 }
 
+void test_vertical_selector_search_duplicate_labels() {
+    MockView mockView;
+    MockInput mockInput;
+    InactivityManager manager(mockView);
+    VerticalSelector verticalSelector(mockView, mockInput, manager);
+
+    std::vector<std::string> options = {"Mail", "Bank", "Mail", "Forum", "Mail"};
+    std::string title = "Vertical Selector Test";
+
+    // Search "mail", then pick the second match
+    mockInput.enqueueKey('m');
+    mockInput.enqueueKey('a');
+    mockInput.enqueueKey(KEY_ARROW_DOWN);
+    mockInput.enqueueKey(KEY_OK);
+
+    int selectedIndex = verticalSelector.select(title, options, false, true);
+
+    TEST_ASSERT_EQUAL(2, selectedIndex); // second "Mail", not the first one
+    TEST_ASSERT_EQUAL(3, mockView.displayedOptions.size()); // only the matching rows
+}
+
+void test_vertical_selector_returns_on_lock() {
+    MockView mockView;
+    MockInput mockInput;
+    InactivityManager manager(mockView);
+    VerticalSelector verticalSelector(mockView, mockInput, manager);
+
+    std::vector<std::string> options = {"Option1", "Option2"};
+
+    // Posted by the lock timer
+    mockInput.enqueueKey(KEY_ARROW_DOWN);
+    mockInput.postKey(KEY_LOCK);
+    mockInput.enqueueKey(KEY_OK);
+
+    int selectedIndex = verticalSelector.select("Vault", options);
+
+    TEST_ASSERT_EQUAL(-1, selectedIndex);
+}
+
+void test_vertical_selector_without_inactivity_ignores_lock() {
+    MockView mockView;
+    MockInput mockInput;
+    InactivityManager manager(mockView);
+    VerticalSelector verticalSelector(mockView, mockInput, manager);
+
+    std::vector<std::string> options = {"Option1", "Option2"};
+
+    // The caller checks the lock itself, the index stays valid
+    mockInput.enqueueKey(KEY_ARROW_DOWN);
+    mockInput.postKey(KEY_LOCK);
+    mockInput.enqueueKey(KEY_OK);
+
+    int selectedIndex = verticalSelector.select("Settings", options, false, false, {}, {}, false, false);
+
+    TEST_ASSERT_EQUAL(1, selectedIndex);
+}
+
 #endif // TEST_VERTICAL_SELECTORS_H
@@ -0,0 +1,74 @@
+#ifndef TEST_KEY_REPORT_PACKER_H
+#define TEST_KEY_REPORT_PACKER_H
+
+#include <unity.h>
+#include <vector>
+#include <KeyReportPacker.h>
+
+static std::vector<KeyReport> packReports(const std::vector<KeyStroke>& strokes) {
+    std::vector<KeyReport> reports;
+    auto send = [&](const KeyReport& report) { reports.push_back(report); return true; };
+
+    KeyReportPacker packer;
+    for (const auto& stroke : strokes) {
+        packer.push(stroke, send);
+    }
+    packer.finish(send);
+    return reports;
+}
+
+void test_key_report_packer_holds_up_to_six_keys() {
+    // "abcdefg", one report per key then one release when the report is full
+    std::vector<KeyStroke> strokes;
+    for (uint8_t k = 0x04; k <= 0x0a; ++k) {
+        strokes.push_back({0, k});
+    }
+    auto reports = packReports(strokes);
+
+    TEST_ASSERT_EQUAL(9, reports.size());
+    TEST_ASSERT_EQUAL(0x09, reports[5].keys[5]);
+    TEST_ASSERT_EQUAL(0, reports[6].keys[0]); // full, released
+    TEST_ASSERT_EQUAL(0x0a, reports[7].keys[0]);
+    TEST_ASSERT_EQUAL(0, reports[8].keys[0]);
+}
+
+void test_key_report_packer_releases_repeated_key() {
+    // "aa" needs a release between the two presses
+    auto reports = packReports({{0, 0x04}, {0, 0x04}});
+
+    TEST_ASSERT_EQUAL(4, reports.size());
+    TEST_ASSERT_EQUAL(0x04, reports[0].keys[0]);
+    TEST_ASSERT_EQUAL(0, reports[1].keys[0]);
+    TEST_ASSERT_EQUAL(0x04, reports[2].keys[0]);
+}
+
+void test_key_report_packer_modifier_transition() {
+    // "aB": the shift goes down with no key pressed in the same report
+    auto reports = packReports({{0, 0x04}, {KeyReportPacker::MOD_LEFT_SHIFT, 0x05}});
+
+    TEST_ASSERT_EQUAL(4, reports.size());
+    TEST_ASSERT_EQUAL(KeyReportPacker::MOD_LEFT_SHIFT, reports[1].modifiers);
+    TEST_ASSERT_EQUAL(0, reports[1].keys[0]);
+    TEST_ASSERT_EQUAL(KeyReportPacker::MOD_LEFT_SHIFT, reports[2].modifiers);
+    TEST_ASSERT_EQUAL(0x05, reports[2].keys[0]);
+    TEST_ASSERT_EQUAL(0, reports[3].modifiers);
+}
+
+void test_key_report_packer_stroke_for_layout() {
+    uint8_t layout[128] = {0};
+    layout['A'] = 0x04 | 0x80;  // SHIFT
+    layout['@'] = 0x1f | 0xc0;  // ALT_GR
+    layout['<'] = 0x32;         // ISO key
+
+    KeyStroke shifted = KeyReportPacker::strokeFor('A', layout);
+    KeyStroke altGr = KeyReportPacker::strokeFor('@', layout);
+
+    TEST_ASSERT_EQUAL(KeyReportPacker::MOD_LEFT_SHIFT, shifted.modifiers);
+    TEST_ASSERT_EQUAL(0x04, shifted.keycode);
+    TEST_ASSERT_EQUAL(KeyReportPacker::MOD_RIGHT_ALT, altGr.modifiers);
+    TEST_ASSERT_EQUAL(0x1f, altGr.keycode);
+    TEST_ASSERT_EQUAL(0x64, KeyReportPacker::strokeFor('<', layout).keycode);
+    TEST_ASSERT_EQUAL(0, KeyReportPacker::strokeFor('z', layout).keycode);
+}
+
+#endif // TEST_KEY_REPORT_PACKER_H
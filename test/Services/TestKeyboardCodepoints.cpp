@@ -0,0 +1,138 @@
+#ifndef TEST_KEYBOARD_CODEPOINTS_H
+#define TEST_KEYBOARD_CODEPOINTS_H
+
+#include <unity.h>
+#include <vector>
+#include <KeyboardCodepoints.h>
+
+extern const uint8_t KeyboardLayout_en_US[];
+extern const uint8_t KeyboardLayout_fr_FR[];
+extern const uint8_t KeyboardLayout_de_DE[];
+
+static std::vector<KeyReport> typeReports(const char* text, const uint8_t* layout, size_t* typed = nullptr) {
+    std::vector<KeyReport> reports;
+    auto send = [&](const KeyReport& report) { reports.push_back(report); return true; };
+
+    size_t count = codepoints::typeText(reinterpret_cast<const uint8_t*>(text), strlen(text), layout, codepoints::UnicodeInput::Off, send);
+    if (typed) {
+        *typed = count;
+    }
+    return reports;
+}
+
+void test_keyboard_codepoints_decode_utf8() {
+    const uint8_t text[] = {'a', 0xC3, 0xA9, 0xE2, 0x82, 0xAC, 0xC3};
+    uint32_t codepoint = 0;
+
+    TEST_ASSERT_EQUAL(1, codepoints::decodeUtf8(text, sizeof(text), codepoint));
+    TEST_ASSERT_EQUAL('a', codepoint);
+    TEST_ASSERT_EQUAL(2, codepoints::decodeUtf8(text + 1, sizeof(text) - 1, codepoint));
+    TEST_ASSERT_EQUAL(0xE9, codepoint);
+    TEST_ASSERT_EQUAL(3, codepoints::decodeUtf8(text + 3, sizeof(text) - 3, codepoint));
+    TEST_ASSERT_EQUAL(0x20AC, codepoint);
+    // Truncated sequence
+    TEST_ASSERT_EQUAL(1, codepoints::decodeUtf8(text + 6, 1, codepoint));
+    TEST_ASSERT_EQUAL(0xFFFD, codepoint);
+}
+
+void test_keyboard_codepoints_direct_and_altgr_keys() {
+    KeyStroke strokes[2];
+
+    // é is a key of its own on fr_FR, € needs AltGr
+    TEST_ASSERT_EQUAL(1, codepoints::strokesFor(0xE9, KeyboardLayout_fr_FR, strokes));
+    TEST_ASSERT_EQUAL(0, strokes[0].modifiers);
+    TEST_ASSERT_EQUAL(0x1f, strokes[0].keycode);
+    TEST_ASSERT_EQUAL(1, codepoints::strokesFor(0x20AC, KeyboardLayout_de_DE, strokes));
+    TEST_ASSERT_EQUAL(KeyReportPacker::MOD_RIGHT_ALT, strokes[0].modifiers);
+    TEST_ASSERT_EQUAL(0x08, strokes[0].keycode);
+    // en_US only types ASCII
+    TEST_ASSERT_EQUAL(0, codepoints::strokesFor(0xE9, KeyboardLayout_en_US, strokes));
+    TEST_ASSERT_EQUAL(1, codepoints::strokesFor('a', KeyboardLayout_en_US, strokes));
+}
+
+void test_keyboard_codepoints_dead_key_composition() {
+    KeyStroke strokes[2];
+
+    // ê on fr_FR: dead ^ then e
+    TEST_ASSERT_EQUAL(2, codepoints::strokesFor(0xEA, KeyboardLayout_fr_FR, strokes));
+    TEST_ASSERT_EQUAL(0x2f, strokes[0].keycode);
+    TEST_ASSERT_EQUAL(0x08, strokes[1].keycode);
+    // ^ alone on de_DE: dead ^ then space
+    TEST_ASSERT_EQUAL(2, codepoints::strokesFor('^', KeyboardLayout_de_DE, strokes));
+    TEST_ASSERT_EQUAL(0x35, strokes[0].keycode);
+    TEST_ASSERT_EQUAL(0x2c, strokes[1].keycode);
+}
+
+void test_keyboard_codepoints_type_text_releases_dead_key() {
+    size_t typed = 0;
+    auto reports = typeReports("\xC3\xAA", KeyboardLayout_fr_FR, &typed); // ê
+
+    // Dead key down, released, e down, released
+    TEST_ASSERT_EQUAL(1, typed);
+    TEST_ASSERT_EQUAL(4, reports.size());
+    TEST_ASSERT_EQUAL(0x2f, reports[0].keys[0]);
+    TEST_ASSERT_EQUAL(0, reports[1].keys[0]);
+    TEST_ASSERT_EQUAL(0x08, reports[2].keys[0]);
+    TEST_ASSERT_EQUAL(0, reports[3].keys[0]);
+}
+
+void test_keyboard_codepoints_type_text_stops_at_unknown_char() {
+    const char* text = "ab\xE2\x82\xAC" "c"; // ab€c
+    auto send = [](const KeyReport&) { return true; };
+    bool complete = true;
+
+    size_t typed = codepoints::typeText(reinterpret_cast<const uint8_t*>(text), strlen(text), KeyboardLayout_en_US, codepoints::UnicodeInput::Off, send, &complete);
+
+    TEST_ASSERT_EQUAL(2, typed);
+    TEST_ASSERT_FALSE(complete);
+}
+
+void test_keyboard_codepoints_linux_input_for_missing_char() {
+    KeyStroke strokes[codepoints::maxInputStrokes];
+
+    // € on en_US: Ctrl+Shift+U, released, 2 0 a c, space, released
+    uint8_t count = codepoints::inputStrokesFor(0x20AC, KeyboardLayout_en_US, codepoints::UnicodeInput::Linux, strokes);
+    TEST_ASSERT_EQUAL(8, count);
+    TEST_ASSERT_EQUAL(0x03, strokes[0].modifiers);
+    TEST_ASSERT_EQUAL(0x18, strokes[0].keycode);
+    TEST_ASSERT_EQUAL(0, strokes[1].keycode);
+    TEST_ASSERT_EQUAL(0x1f, strokes[2].keycode);
+    TEST_ASSERT_EQUAL(0x27, strokes[3].keycode);
+    TEST_ASSERT_EQUAL(0x04, strokes[4].keycode);
+    TEST_ASSERT_EQUAL(0x06, strokes[5].keycode);
+    TEST_ASSERT_EQUAL(0x2c, strokes[6].keycode);
+    TEST_ASSERT_EQUAL(0, strokes[7].keycode);
+}
+
+void test_keyboard_codepoints_windows_and_macos_input() {
+    KeyStroke strokes[codepoints::maxInputStrokes];
+
+    // é: Alt held on numpad 0 2 3 3
+    TEST_ASSERT_EQUAL(5, codepoints::inputStrokesFor(0xE9, KeyboardLayout_en_US, codepoints::UnicodeInput::Windows, strokes));
+    TEST_ASSERT_EQUAL(0x04, strokes[0].modifiers);
+    TEST_ASSERT_EQUAL(0x62, strokes[0].keycode);
+    TEST_ASSERT_EQUAL(0x5A, strokes[1].keycode);
+    TEST_ASSERT_EQUAL(0x5B, strokes[3].keycode);
+    // €: Alt held on numpad + then hex
+    TEST_ASSERT_EQUAL(6, codepoints::inputStrokesFor(0x20AC, KeyboardLayout_en_US, codepoints::UnicodeInput::Windows, strokes));
+    TEST_ASSERT_EQUAL(0x57, strokes[0].keycode);
+    // U+1F600 on macOS: two groups of four digits with Option held
+    TEST_ASSERT_EQUAL(9, codepoints::inputStrokesFor(0x1F600, KeyboardLayout_fr_FR, codepoints::UnicodeInput::MacOS, strokes));
+    TEST_ASSERT_EQUAL(0x04, strokes[0].modifiers);
+    TEST_ASSERT_EQUAL(0x07, strokes[0].keycode); // d of d83d
+    // Off types nothing
+    TEST_ASSERT_EQUAL(0, codepoints::inputStrokesFor(0x20AC, KeyboardLayout_en_US, codepoints::UnicodeInput::Off, strokes));
+}
+
+void test_keyboard_codepoints_type_text_falls_back_to_input() {
+    const char* text = "ab\xE2\x82\xAC" "c"; // ab€c
+    auto send = [](const KeyReport&) { return true; };
+    bool complete = false;
+
+    size_t typed = codepoints::typeText(reinterpret_cast<const uint8_t*>(text), strlen(text), KeyboardLayout_en_US, codepoints::UnicodeInput::Linux, send, &complete);
+
+    TEST_ASSERT_EQUAL(4, typed);
+    TEST_ASSERT_TRUE(complete);
+}
+
+#endif // TEST_KEYBOARD_CODEPOINTS_H
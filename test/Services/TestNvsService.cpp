@@ -3,6 +3,7 @@
 
 #include <unity.h>
 #include "../src/Services/NvsService.h"
+#include "../src/Models/Settings.h"
 
 void test_save_and_get_string() {
     NvsService nvsService;
@@ -38,4 +39,35 @@ void test_remove_key() {
     TEST_ASSERT_EQUAL_STRING("default", retrievedValue.c_str());
 }
 
+void test_save_and_get_settings_blob() {
+    NvsService nvsService;
+    std::string key = "unitTestBlob";
+    Settings settings;
+    settings.screenBrightness = 200;
+    settings.lockTimeoutMs = 300000;
+    Settings::copy(settings.keyboardLayout, sizeof(settings.keyboardLayout), "French (FR)");
+
+    nvsService.saveBytes(key, &settings, sizeof(settings));
+    Settings retrieved;
+    size_t read = nvsService.getBytes(key, &retrieved, sizeof(retrieved));
+
+    TEST_ASSERT_EQUAL(sizeof(Settings), read);
+    TEST_ASSERT_TRUE(retrieved == settings);
+    TEST_ASSERT_EQUAL_STRING("French (FR)", retrieved.keyboardLayout);
+
+    // A blob of another size is not read into the struct
+    uint8_t shorter[4] = {};
+    nvsService.saveBytes(key, shorter, sizeof(shorter));
+    TEST_ASSERT_EQUAL(0, nvsService.getBytes(key, &retrieved, sizeof(retrieved)));
+    nvsService.remove(key);
+}
+
+void test_settings_copy_truncates() {
+    Settings settings;
+    Settings::copy(settings.unicodeInput, sizeof(settings.unicodeInput), "a name longer than the field");
+
+    TEST_ASSERT_EQUAL(sizeof(settings.unicodeInput) - 1, strlen(settings.unicodeInput));
+    TEST_ASSERT_TRUE(settings != Settings());
+}
+
 #endif // TEST_NVS_SERVICE
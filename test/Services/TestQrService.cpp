@@ -0,0 +1,51 @@
+#ifndef TEST_QR_SERVICE
+#define TEST_QR_SERVICE
+
+#include <unity.h>
+#include "../src/Services/QrService.h"
+
+void test_qr_service_encode_is_cached() {
+    QrService qrService;
+
+    const QrBitmap& first = qrService.encode("Mail/Pass", "secret");
+    const QrBitmap& second = qrService.encode("Mail/Pass", "secret");
+
+    TEST_ASSERT_EQUAL(21, first.getSize()); // version 1
+    TEST_ASSERT_EQUAL_PTR(&first, &second);
+    TEST_ASSERT_EQUAL(1, qrService.cachedCount());
+    // Finder pattern corner
+    TEST_ASSERT_TRUE(first.module(0, 0));
+}
+
+void test_qr_service_encode_again_when_value_changes() {
+    QrService qrService;
+
+    qrService.encode("Mail/Pass", "secret");
+    const QrBitmap& bitmap = qrService.encode("Mail/Pass", "otpauth://totp/Mail?secret=JBSWY3DPEHPK3PXP&issuer=Mail");
+
+    TEST_ASSERT_TRUE(bitmap.getSize() > 21);
+    TEST_ASSERT_EQUAL(1, qrService.cachedCount());
+}
+
+void test_qr_service_too_long_and_wipe() {
+    QrService qrService;
+
+    TEST_ASSERT_TRUE(qrService.encode("Mail/Note", std::string(2000, 'x')).empty());
+
+    qrService.encode("Mail/User", "someone");
+    qrService.wipe();
+    TEST_ASSERT_EQUAL(0, qrService.cachedCount());
+}
+
+void test_qr_service_wipe_changes_the_salt() {
+    QrService qrService;
+
+    // Same value, the hash kept for the session can't be compared across sessions
+    uint32_t before = qrService.encode("Mail/Pass", "secret").getSourceHash();
+    qrService.wipe();
+    uint32_t after = qrService.encode("Mail/Pass", "secret").getSourceHash();
+
+    TEST_ASSERT_TRUE(before != after);
+}
+
+#endif // TEST_QR_SERVICE
@@ -0,0 +1,87 @@
+#ifndef TEST_TYPING_SERVICE_H
+#define TEST_TYPING_SERVICE_H
+
+#include <unity.h>
+#include "../src/Services/TypingService.h"
+#include "../src/Services/UsbService.h"
+#include "../src/Services/BleService.h"
+
+// "abc", a pause, then "def", halfway through while it waits
+static AutoTypeProgram pausedProgram(uint16_t pauseMs) {
+    AutoTypeProgram program;
+    program.literals = "abcdef";
+    program.steps = {{AutoTypeOp::Text, 0, 3}, {AutoTypeOp::Delay, pauseMs, 0}, {AutoTypeOp::Text, 3, 3}};
+    return program;
+}
+
+static void waitIdle(TypingService& typingService) {
+    uint32_t start = millis();
+    while (typingService.isBusy() && millis() - start < 2000) {
+        delay(10);
+    }
+}
+
+void test_typing_service_chunk_end() {
+    std::string ascii = "0123456789ABCDEF0123";
+    TEST_ASSERT_EQUAL(TypingService::chunkChars, TypingService::chunkEnd(ascii, 0, ascii.size()));
+    TEST_ASSERT_EQUAL(ascii.size(), TypingService::chunkEnd(ascii, 16, ascii.size()));
+    TEST_ASSERT_EQUAL(10, TypingService::chunkEnd(ascii, 5, 10)); // stops at the run end
+
+    // Counted in characters, never cut inside one
+    std::string accents = "\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9"; // 9 x é
+    TEST_ASSERT_EQUAL(2 * TypingService::chunkChars, TypingService::chunkEnd(accents, 0, accents.size()));
+    TEST_ASSERT_EQUAL(accents.size(), TypingService::chunkEnd(accents, 16, accents.size()));
+
+    std::string mixed = "a\xE2\x82\xAC" "b\xF0\x9F\x94\x91"; // a € b 🔑
+    TEST_ASSERT_EQUAL(4, TypingService::chunkEnd(mixed, 0, 4));
+    TEST_ASSERT_EQUAL(mixed.size(), TypingService::chunkEnd(mixed, 0, mixed.size()));
+}
+
+void test_typing_service_progress() {
+    UsbService usbService;
+    BleService bleService; // not started, nothing reaches a host
+    TypingService typingService(usbService, bleService);
+    std::string empty;
+    const std::string* fields[4] = {&empty, &empty, &empty, &empty};
+
+    TEST_ASSERT_TRUE(typingService.start(pausedProgram(300), fields, true));
+    TEST_ASSERT_FALSE(typingService.start("busy", true)); // one job at a time
+    delay(100);
+    TEST_ASSERT_TRUE(typingService.isBusy());
+    TEST_ASSERT_EQUAL(50, typingService.getProgress());
+
+    waitIdle(typingService);
+    TEST_ASSERT_FALSE(typingService.isBusy());
+    TEST_ASSERT_EQUAL(100, typingService.getProgress());
+
+    // No BLE host, reported as partial rather than sent
+    TEST_ASSERT_TRUE(typingService.isPartial());
+    TEST_ASSERT_FALSE(typingService.isComplete());
+}
+
+void test_typing_service_cancel() {
+    UsbService usbService;
+    BleService bleService;
+    TypingService typingService(usbService, bleService);
+    std::string empty;
+    const std::string* fields[4] = {&empty, &empty, &empty, &empty};
+
+    TEST_ASSERT_TRUE(typingService.start(pausedProgram(1000), fields, true));
+    delay(100);
+    uint32_t cancelledMs = millis();
+    typingService.cancel();
+    waitIdle(typingService);
+
+    // The pause is cut short, what follows it is never typed
+    TEST_ASSERT_TRUE(millis() - cancelledMs < 200);
+    TEST_ASSERT_FALSE(typingService.isBusy());
+    TEST_ASSERT_FALSE(typingService.isComplete());
+    TEST_ASSERT_EQUAL(50, typingService.getProgress());
+
+    // Ready for the next job
+    TEST_ASSERT_TRUE(typingService.start(pausedProgram(0), fields, true));
+    waitIdle(typingService);
+    TEST_ASSERT_EQUAL(100, typingService.getProgress());
+}
+
+#endif // TEST_TYPING_SERVICE_H
@@ -0,0 +1,52 @@
+#ifndef TEST_AUTO_TYPE_TRANSFORMER
+#define TEST_AUTO_TYPE_TRANSFORMER
+
+#include <unity.h>
+#include "../src/Transformers/AutoTypeTransformer.h"
+
+void test_auto_type_default_login_is_one_string() {
+    AutoTypeTransformer transformer;
+    auto program = transformer.toProgram(AutoTypeTransformer::DEFAULT_PATTERN);
+
+    // User, tab, pass, enter: fields and text only, typed in one pass
+    TEST_ASSERT_TRUE(program.valid());
+    TEST_ASSERT_EQUAL(4, program.steps.size());
+    TEST_ASSERT_EQUAL(AutoTypeOp::Field, program.steps[0].op);
+    TEST_ASSERT_EQUAL(static_cast<uint16_t>(AutoTypeField::Username), program.steps[0].arg);
+    TEST_ASSERT_EQUAL(AutoTypeOp::Text, program.steps[1].op);
+    TEST_ASSERT_EQUAL(static_cast<uint16_t>(AutoTypeField::Password), program.steps[2].arg);
+    TEST_ASSERT_EQUAL_STRING("\t\n", program.literals.c_str());
+}
+
+void test_auto_type_merges_text_and_repeats() {
+    AutoTypeTransformer transformer;
+    auto program = transformer.toProgram("id:{tab 2}{{}x{}}");
+
+    TEST_ASSERT_TRUE(program.valid());
+    TEST_ASSERT_EQUAL(1, program.steps.size());
+    TEST_ASSERT_EQUAL(8, program.steps[0].length);
+    TEST_ASSERT_EQUAL_STRING("id:\t\t{x}", program.literals.c_str());
+}
+
+void test_auto_type_keys_and_delays() {
+    AutoTypeTransformer transformer;
+    auto program = transformer.toProgram("{ESC}{DELAY 300}{PASSWORD}");
+
+    TEST_ASSERT_TRUE(program.valid());
+    TEST_ASSERT_EQUAL(3, program.steps.size());
+    TEST_ASSERT_EQUAL(AutoTypeOp::Key, program.steps[0].op);
+    TEST_ASSERT_EQUAL(0xB1, program.steps[0].arg);
+    TEST_ASSERT_EQUAL(AutoTypeOp::Delay, program.steps[1].op);
+    TEST_ASSERT_EQUAL(300, program.steps[1].arg);
+}
+
+void test_auto_type_rejects_bad_templates() {
+    AutoTypeTransformer transformer;
+
+    TEST_ASSERT_FALSE(transformer.toProgram("{USERNAME").valid());
+    TEST_ASSERT_FALSE(transformer.toProgram("{F13}").valid());
+    TEST_ASSERT_FALSE(transformer.toProgram("{DELAY 99999}").valid());
+    TEST_ASSERT_FALSE(transformer.toProgram("{TAB 0}").valid());
+}
+
+#endif // TEST_AUTO_TYPE_TRANSFORMER
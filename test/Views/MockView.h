@@ -25,6 +25,15 @@ public:
         return this->brightness;
     }
 
+    void wipeTextCache() override {
+        textCacheWiped = true;
+    }
+
+    void fadeBrightness(uint8_t target, uint32_t durationMs) override {
+        this->brightness = target;
+        fadeCalled = true;
+    }
+
     void topBar(const std::string& title, bool submenu, bool searchBar) override {
         lastTitle = title;
         this->submenu = submenu;
@@ -32,7 +41,7 @@ public:
         topBarCalled = true;
     }
 
-    void horizontalSelection(const std::vector<std::string>& options, uint16_t selectedIndex, const std::string& description1 = "", const std::string& description2 = "", const std::vector<std::string>& icons = {}) override {
+    void horizontalSelection(const std::vector<std::string>& options, uint16_t selectedIndex, const std::string& description1 = "", const std::string& description2 = "", const std::vector<IconEnum>& icons = {}) override {
         displayedOptions = options;
         lastSelectedIndex = selectedIndex;
         horizontalSelectionCalled = true;
@@ -61,11 +70,27 @@ public:
         subMessageCalled = true;
     }
 
+    void progress(std::string label, uint8_t percent, std::string hint) override {
+        lastProgress = percent;
+        progressCalled = true;
+    }
+
+    void qrCode(const std::string& label, const QrBitmap& bitmap) override {
+        lastQrSize = bitmap.getSize();
+        qrCodeCalled = true;
+    }
+
+    void bleStatus(BleStatusEnum status) override {
+        lastBleStatus = status;
+    }
+
     void confirmationPrompt(std::string label) {
         confirmationPromptCalled = true;
     }
 
-    void stringPrompt(std::string label, std::string value, bool backButton, size_t minLength) {
+    void stringPrompt(std::string label, std::string value, bool backButton, size_t minLength, size_t cursor = std::string::npos) {
+        promptValue = value;
+        promptCursor = cursor;
         stringPromptCalled = true;
     }
 
@@ -86,6 +111,8 @@ public:
     std::string message;
     std::string debugMessage;
     bool welcomeCalled = false;
+    bool fadeCalled = false;
+    bool textCacheWiped = false;
     bool topBarCalled = false;
     bool verticalSelectionCalled = false;
     bool horizontalSelectionCalled = false;
@@ -94,6 +121,13 @@ public:
     bool debugCalled = false;
     bool confirmationPromptCalled = false;
     bool stringPromptCalled = false;
+    BleStatusEnum lastBleStatus = BleStatusEnum::Off;
+    uint8_t lastProgress = 0;
+    bool progressCalled = false;
+    uint8_t lastQrSize = 0;
+    bool qrCodeCalled = false;
+    std::string promptValue;
+    size_t promptCursor = 0;
 };
 
 #endif // MOCK_VIEW_H
@@ -0,0 +1,51 @@
+#ifndef TEST_TEXT_METRICS_CACHE_H
+#define TEST_TEXT_METRICS_CACHE_H
+
+#include <unity.h>
+#include "../src/Views/TextMetricsCache.h"
+
+void test_text_metrics_cache_measures_once() {
+    views::TextMetricsCache cache;
+    int measures = 0;
+    auto measure = [&]() { measures++; return static_cast<int16_t>(42); };
+
+    TEST_ASSERT_EQUAL(42, cache.width("Password", nullptr, 1.1f, measure));
+    TEST_ASSERT_EQUAL(42, cache.width("Password", nullptr, 1.1f, measure));
+    TEST_ASSERT_EQUAL(1, measures);
+
+    // Another size is another width
+    cache.width("Password", nullptr, 1.4f, measure);
+    TEST_ASSERT_EQUAL(2, measures);
+}
+
+void test_text_metrics_cache_evicts_least_recent() {
+    views::TextMetricsCache cache;
+    int measures = 0;
+    auto measure = [&]() { measures++; return static_cast<int16_t>(10); };
+
+    for (size_t i = 0; i < views::TextMetricsCache::capacity; ++i) {
+        cache.width(std::to_string(i), nullptr, 1.0f, measure);
+    }
+    cache.width("0", nullptr, 1.0f, measure); // keep "0" recent
+    cache.width("new", nullptr, 1.0f, measure); // replaces "1"
+    measures = 0;
+
+    cache.width("0", nullptr, 1.0f, measure);
+    TEST_ASSERT_EQUAL(0, measures);
+    cache.width("1", nullptr, 1.0f, measure);
+    TEST_ASSERT_EQUAL(1, measures);
+}
+
+void test_text_metrics_cache_clear_forgets_strings() {
+    views::TextMetricsCache cache;
+    int measures = 0;
+    auto measure = [&]() { measures++; return static_cast<int16_t>(10); };
+
+    cache.width("hunter2", nullptr, 1.0f, measure);
+    cache.clear();
+    cache.width("hunter2", nullptr, 1.0f, measure);
+
+    TEST_ASSERT_EQUAL(2, measures);
+}
+
+#endif // TEST_TEXT_METRICS_CACHE_H
@@ -5,9 +5,14 @@
 #include "Services/TestCategoryService.cpp"
 #include "Services/TestSdService.cpp"
 #include "Services/TestNvsService.cpp"
+#include "Services/TestKeyReportPacker.cpp"
+#include "Services/TestKeyboardCodepoints.cpp"
+#include "Services/TestQrService.cpp"
+#include "Services/TestTypingService.cpp"
 #include "Transformers/TestJsonTransformer.cpp"
 #include "Transformers/TestModelTransformer.cpp"
 #include "Transformers/TestTimeTransformer.cpp"
+#include "Transformers/TestAutoTypeTransformer.cpp"
 #include "Selectors/TestVerticalSelector.cpp"
 #include "Selectors/TestHorizontalSelector.cpp"
 #include "Selectors/TestFieldEditorSelector.cpp"
@@ -21,6 +26,12 @@
 #include "Controllers/TestVaultController.cpp"
 #include "Controllers/TestEntryController.cpp"
 #include "Controllers/TestUtilityController.cpp"
+#include "Managers/TestLatencyManager.cpp"
+#include "Managers/TestInactivityManager.cpp"
+#include "Managers/TestPowerManager.cpp"
+#include "Managers/TestBleConnectionManager.cpp"
+#include "Views/TestTextMetricsCache.cpp"
+#include "Inputs/TestEditBuffer.cpp"
 
 void setup() {
     UNITY_BEGIN();
@@ -67,6 +78,8 @@ void setup() {
     RUN_TEST(test_save_and_get_string);
     RUN_TEST(test_save_and_get_int);
     RUN_TEST(test_remove_key);
+    RUN_TEST(test_save_and_get_settings_blob);
+    RUN_TEST(test_settings_copy_truncates);
 
     // JsonTransformer
     RUN_TEST(test_to_json_categories);
@@ -85,10 +98,19 @@ void setup() {
     RUN_TEST(test_get_all_time_labels);
     RUN_TEST(test_get_all_time_values);
 
+    // AutoTypeTransformer
+    RUN_TEST(test_auto_type_default_login_is_one_string);
+    RUN_TEST(test_auto_type_merges_text_and_repeats);
+    RUN_TEST(test_auto_type_keys_and_delays);
+    RUN_TEST(test_auto_type_rejects_bad_templates);
+
     // VerticalSelector
     RUN_TEST(test_vertical_selector_confirm);
     RUN_TEST(test_vertical_selector_cancel);
     RUN_TEST(test_vertical_selector_shortcut);
+    RUN_TEST(test_vertical_selector_search_duplicate_labels);
+    RUN_TEST(test_vertical_selector_returns_on_lock);
+    RUN_TEST(test_vertical_selector_without_inactivity_ignores_lock);
 
     // HorizontalSelector
     RUN_TEST(test_horizontal_selector_confirm);
@@ -102,6 +124,7 @@ void setup() {
     RUN_TEST(test_field_action_selector_send_keystrokes);
     RUN_TEST(test_field_action_selector_update_field);
     RUN_TEST(test_field_action_selector_cancel);
+    RUN_TEST(test_field_action_selector_show_qr);
 
     // ConfirmationSelector
     RUN_TEST(test_confirmation_selector_confirm);
@@ -110,6 +133,9 @@ void setup() {
     // StringPromptSelector
     RUN_TEST(test_string_selector_confirm);
     RUN_TEST(test_string_selector_cancel);
+    RUN_TEST(test_string_selector_insert_at_cursor);
+    RUN_TEST(test_string_selector_returns_when_locked);
+    RUN_TEST(test_string_selector_accepts_empty_input);
 
     // ActionEnumMapper
     RUN_TEST(test_action_enum_to_string);
@@ -140,10 +166,71 @@ void setup() {
     // EntryController
     RUN_TEST(test_handleEntryCreation);
     RUN_TEST(test_handleEntryUpdate);
+    RUN_TEST(test_handleEntryUpdate_stops_when_locked);
     RUN_TEST(test_handleEntryDeletion);
 
     // UtilityController
     RUN_TEST(test_handleGeneralSettings);
+    RUN_TEST(test_handleLoadNvs_migrates_string_keys);
+
+    // InactivityManager
+    RUN_TEST(test_inactivity_manager_dim_does_not_block);
+    RUN_TEST(test_inactivity_manager_restore_is_instant);
+    RUN_TEST(test_inactivity_manager_lock_only_flags);
+    RUN_TEST(test_inactivity_manager_deadlines_fire);
+
+    // PowerManager
+    RUN_TEST(test_power_manager_nested_holds_keep_max_frequency);
+    RUN_TEST(test_power_manager_bus_lock_leaves_cpu_low);
+
+    // BleConnectionManager
+    RUN_TEST(test_ble_profile_round_trip);
+    RUN_TEST(test_ble_profile_without_input_takes_the_current_one);
+
+    // LatencyManager
+    RUN_TEST(test_latency_histogram_summary);
+    RUN_TEST(test_latency_histogram_keeps_last_samples);
+    RUN_TEST(test_latency_manager_records_drawn_keys_only);
+    RUN_TEST(test_latency_manager_records_light_sleep);
+    RUN_TEST(test_latency_manager_records_every_frame);
+
+    // TextMetricsCache
+    RUN_TEST(test_text_metrics_cache_measures_once);
+    RUN_TEST(test_text_metrics_cache_evicts_least_recent);
+    RUN_TEST(test_text_metrics_cache_clear_forgets_strings);
+
+    // KeyReportPacker
+    RUN_TEST(test_key_report_packer_holds_up_to_six_keys);
+    RUN_TEST(test_key_report_packer_releases_repeated_key);
+    RUN_TEST(test_key_report_packer_modifier_transition);
+    RUN_TEST(test_key_report_packer_stroke_for_layout);
+
+    // KeyboardCodepoints
+    RUN_TEST(test_keyboard_codepoints_decode_utf8);
+    RUN_TEST(test_keyboard_codepoints_direct_and_altgr_keys);
+    RUN_TEST(test_keyboard_codepoints_dead_key_composition);
+    RUN_TEST(test_keyboard_codepoints_type_text_releases_dead_key);
+    RUN_TEST(test_keyboard_codepoints_type_text_stops_at_unknown_char);
+    RUN_TEST(test_keyboard_codepoints_linux_input_for_missing_char);
+    RUN_TEST(test_keyboard_codepoints_windows_and_macos_input);
+    RUN_TEST(test_keyboard_codepoints_type_text_falls_back_to_input);
+
+    // QrService
+    RUN_TEST(test_qr_service_encode_is_cached);
+    RUN_TEST(test_qr_service_encode_again_when_value_changes);
+    RUN_TEST(test_qr_service_too_long_and_wipe);
+    RUN_TEST(test_qr_service_wipe_changes_the_salt);
+
+    // TypingService
+    RUN_TEST(test_typing_service_chunk_end);
+    RUN_TEST(test_typing_service_progress);
+    RUN_TEST(test_typing_service_cancel);
+
+    // EditBuffer
+    RUN_TEST(test_edit_buffer_insert_at_cursor);
+    RUN_TEST(test_edit_buffer_delete_both_sides);
+    RUN_TEST(test_edit_buffer_word_moves);
+    RUN_TEST(test_edit_buffer_limit);
 
     UNITY_END();
 }
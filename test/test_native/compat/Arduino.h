@@ -0,0 +1,41 @@
+#ifndef NATIVE_ARDUINO_COMPAT_H
+#define NATIVE_ARDUINO_COMPAT_H
+
+// Just enough of Arduino for the view and keyboard layout code to build on the host
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#define PROGMEM
+
+inline unsigned long millis() {
+    using namespace std::chrono;
+    static const auto start = steady_clock::now();
+    return duration_cast<milliseconds>(steady_clock::now() - start).count();
+}
+
+inline unsigned long micros() {
+    using namespace std::chrono;
+    static const auto start = steady_clock::now();
+    return duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+inline void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+class HostSerial {
+public:
+    int available() { return 0; }
+    int read() { return -1; }
+    template <typename... Args>
+    void printf(const char* format, Args... args) { std::printf(format, args...); }
+    void println(const char* text) { std::puts(text); }
+};
+
+inline HostSerial Serial;
+
+#endif // NATIVE_ARDUINO_COMPAT_H
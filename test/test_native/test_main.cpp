@@ -0,0 +1,191 @@
+#include <unity.h>
+#include <fstream>
+#include <string>
+#include "../src/Views/HeadlessView.h"
+#include "../Inputs/MockInput.h"
+
+using namespace views;
+
+// Golden images live next to this file, "pio test -e native_record" rewrites them
+static const std::string goldenDir = "test/test_native/golden/";
+
+static void assertMatchesGolden(HeadlessView& view, const std::string& name) {
+    std::string path = goldenDir + name + ".png";
+    uint32_t mismatches = 0;
+
+#ifdef RECORD_GOLDENS
+    TEST_ASSERT_TRUE(view.savePng(path));
+    TEST_IGNORE_MESSAGE(("recorded " + path + ", check it in").c_str());
+#endif
+
+    // Reported, not passed, until the image is recorded on a machine with M5GFX
+    if (!std::ifstream(path).good()) {
+        TEST_IGNORE_MESSAGE((path + " not recorded yet, run -e native_record and check it in").c_str());
+    }
+
+    if (view.matchesPng(path, &mismatches)) {
+        return;
+    }
+
+    view.savePng(goldenDir + name + ".actual.png");
+    if (mismatches == 0) {
+        TEST_FAIL_MESSAGE((path + " is not a PNG, record it again with -e native_record").c_str());
+    }
+    TEST_FAIL_MESSAGE(("rendering differs from " + path + " on " + std::to_string(mismatches) + " pixels").c_str());
+}
+
+void test_headless_confirmation_prompt_golden() {
+    MockInput input;
+    HeadlessView view(input);
+    view.initialize();
+
+    view.topBar("Erase Password", false, false);
+    view.confirmationPrompt("Delete Mail ?");
+
+    assertMatchesGolden(view, "confirmation_prompt");
+    TEST_ASSERT_EQUAL(0, view.getFrameMetrics().totalPixelsMissed);
+}
+
+void test_headless_vertical_list_golden() {
+    MockInput input;
+    HeadlessView view(input);
+    view.initialize();
+
+    view.topBar("Vault", true, true);
+    view.verticalSelection({"Mail", "Bank", "Forum", "Cloud"}, 1);
+
+    assertMatchesGolden(view, "vertical_list");
+    TEST_ASSERT_EQUAL(0, view.getFrameMetrics().totalPixelsMissed);
+}
+
+void test_headless_menu_icons_golden() {
+    MockInput input;
+    HeadlessView view(input);
+    view.initialize();
+
+    std::vector<IconEnum> icons = {IconEnum::LoadVault, IconEnum::CreateVault, IconEnum::Settings};
+    view.topBar("", false, false);
+    view.horizontalSelection({"Open Vault", "Create Vault", "Settings"}, 2, "", "", icons);
+
+    assertMatchesGolden(view, "menu_settings");
+    TEST_ASSERT_EQUAL(0, view.getFrameMetrics().totalPixelsMissed);
+}
+
+void test_headless_list_move_pushes_two_rows() {
+    MockInput input;
+    HeadlessView view(input);
+    view.initialize();
+
+    std::vector<std::string> rows = {"Mail", "Bank", "Forum", "Cloud"};
+    view.topBar("Vault", true, true);
+    view.verticalSelection(rows, 0);
+    auto fullFrame = view.getFrameMetrics().lastPixelsPushed;
+
+    // Moving the selection on the same page only repaints the old and new rows
+    view.verticalSelection(rows, 1);
+    auto metrics = view.getFrameMetrics();
+
+    TEST_ASSERT_TRUE(metrics.lastPixelsChanged > 0);
+    TEST_ASSERT_TRUE(metrics.lastPixelsPushed < fullFrame);
+    TEST_ASSERT_TRUE(metrics.lastPixelsPushed <= 2 * 26 * SCREEN_WIDTH);
+    TEST_ASSERT_EQUAL(0, metrics.totalPixelsMissed);
+}
+
+void test_headless_same_top_bar_pushes_nothing() {
+    MockInput input;
+    HeadlessView view(input);
+    view.initialize();
+
+    view.topBar("Vault", false, false);
+    auto frames = view.getFrameMetrics().frames;
+    view.topBar("Vault", false, false);
+
+    TEST_ASSERT_EQUAL(frames, view.getFrameMetrics().frames);
+}
+
+void test_headless_toast_holds_frames_until_a_key() {
+    MockInput input;
+    HeadlessView view(input);
+    view.initialize();
+
+    view.subMessage("Field updated", 60000);
+    auto frames = view.getFrameMetrics().frames;
+
+    // The next screen is composed under the message, the panel keeps the message
+    view.topBar("Vault", true, true);
+    view.verticalSelection({"Mail", "Bank", "Forum"}, 0);
+    input.handler();
+    TEST_ASSERT_EQUAL(frames, view.getFrameMetrics().frames);
+
+    // A key handled while it shows dismisses it, the queue is left alone
+    input.enqueueKey(KEY_ARROW_DOWN);
+    TEST_ASSERT_EQUAL(KEY_ARROW_DOWN, input.handler());
+    input.handler();
+    TEST_ASSERT_EQUAL(frames + 1, view.getFrameMetrics().frames);
+    TEST_ASSERT_EQUAL(0, view.getFrameMetrics().totalPixelsMissed);
+}
+
+void test_headless_toast_expires_without_a_key() {
+    MockInput input;
+    HeadlessView view(input);
+    view.initialize();
+
+    view.subMessage("Field updated", 20);
+    auto frames = view.getFrameMetrics().frames;
+    view.topBar("Vault", true, true);
+    input.handler();
+    TEST_ASSERT_EQUAL(frames, view.getFrameMetrics().frames);
+
+    delay(30);
+    input.handler();
+    TEST_ASSERT_EQUAL(frames + 1, view.getFrameMetrics().frames);
+}
+
+void test_headless_toast_outlives_a_passing_message() {
+    MockInput input;
+    HeadlessView view(input);
+    view.initialize();
+
+    // "Invalid Password" then "Loading..." right away, the error stays on the panel
+    view.subMessage("Invalid Password", 60000);
+    auto frames = view.getFrameMetrics().frames;
+    view.subMessage("Loading...", 0);
+    input.handler();
+    TEST_ASSERT_EQUAL(frames, view.getFrameMetrics().frames);
+
+    // Shown once the error is dismissed
+    input.enqueueKey(KEY_OK);
+    input.handler();
+    input.handler();
+    TEST_ASSERT_EQUAL(frames + 1, view.getFrameMetrics().frames);
+}
+
+void test_headless_timed_message_waits_for_the_held_one() {
+    MockInput input;
+    HeadlessView view(input);
+    view.initialize();
+
+    view.subMessage("Invalid File", 30);
+    auto shownMs = millis();
+    auto frames = view.getFrameMetrics().frames;
+    view.subMessage("No elements found", 20);
+    TEST_ASSERT_TRUE(millis() - shownMs >= 25);
+    TEST_ASSERT_EQUAL(frames + 1, view.getFrameMetrics().frames);
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    // HeadlessView
+    RUN_TEST(test_headless_confirmation_prompt_golden);
+    RUN_TEST(test_headless_vertical_list_golden);
+    RUN_TEST(test_headless_menu_icons_golden);
+    RUN_TEST(test_headless_list_move_pushes_two_rows);
+    RUN_TEST(test_headless_same_top_bar_pushes_nothing);
+    RUN_TEST(test_headless_toast_holds_frames_until_a_key);
+    RUN_TEST(test_headless_toast_expires_without_a_key);
+    RUN_TEST(test_headless_toast_outlives_a_passing_message);
+    RUN_TEST(test_headless_timed_message_waits_for_the_held_one);
+
+    return UNITY_END();
+}
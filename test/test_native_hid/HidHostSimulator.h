@@ -0,0 +1,223 @@
+#ifndef HID_HOST_SIMULATOR_H
+#define HID_HOST_SIMULATOR_H
+
+#include <KeyReportPacker.h>
+#include <KeyboardCodepoints.h>
+#include "ReferenceKeymaps.h"
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+// Stand-in for the PC behind USBHID or BleKeyboard. Reports are decoded back
+// into characters with a host keymap (dead keys included), the link models
+// the polling or connection interval and lost reports.
+class HidHostSimulator {
+public:
+    struct Link {
+        uint32_t intervalUs;        // USB polling, BLE connection interval
+        uint8_t reportsPerInterval; // 1 on USB, notifications per connection event on BLE
+        uint32_t dropOneIn;         // 0 never, else about one report in N is lost
+        bool acknowledged;          // USB sees the loss and retries, a BLE notify is lost silently
+    };
+
+    static Link usbFullSpeed() { return {1000, 1, 0, true}; }
+    static Link ble() { return {15000, 4, 0, false}; }
+
+    struct Stats {
+        uint32_t reports = 0;
+        uint32_t dropped = 0;
+        uint32_t characters = 0;
+        uint32_t errors = 0; // edit distance to the expected text
+        uint64_t elapsedUs = 0;
+
+        float charsPerSecond() const {
+            return elapsedUs ? characters * 1000000.0f / elapsedUs : 0;
+        }
+    };
+
+    // Decodes with the xkb keymap of the layout, what a real host would type
+    HidHostSimulator(const ReferenceKeymap& reference, Link link, uint32_t seed = 1)
+        : link(link), random(seed) {
+        memset(&previous, 0, sizeof(previous));
+        loadReference(reference);
+    }
+
+    // Decodes with the inverse of the encoder's own tables, so a wrong layout
+    // entry still round trips: only for packing and drop tests
+    HidHostSimulator(const uint8_t* asciimap, Link link, uint32_t seed = 1)
+        : link(link), random(seed) {
+        memset(&previous, 0, sizeof(previous));
+        buildKeymap(asciimap);
+    }
+
+    // Report sink, false when an acknowledged link lost it
+    bool send(const KeyReport& report) {
+        stats.reports++;
+        if (link.dropOneIn && nextRandom() % link.dropOneIn == 0) {
+            stats.dropped++;
+            return !link.acknowledged;
+        }
+
+        for (uint8_t key : report.keys) {
+            if (key != 0 && !held(key)) {
+                press(report.modifiers, key);
+            }
+        }
+        previous = report;
+        return true;
+    }
+
+    const std::u32string& typed() const { return text; }
+
+    Stats compare(const std::string& expectedUtf8) const {
+        Stats result = stats;
+        std::u32string expected = decode(expectedUtf8);
+        result.characters = expected.size();
+        result.errors = distance(text, expected);
+        result.elapsedUs = uint64_t(intervalsUsed()) * link.intervalUs;
+        return result;
+    }
+
+    static std::string encodeUtf8(uint32_t codepoint) {
+        std::string out;
+        if (codepoint < 0x80) {
+            out += char(codepoint);
+        } else if (codepoint < 0x800) {
+            out += char(0xC0 | (codepoint >> 6));
+            out += char(0x80 | (codepoint & 0x3F));
+        } else {
+            out += char(0xE0 | (codepoint >> 12));
+            out += char(0x80 | ((codepoint >> 6) & 0x3F));
+            out += char(0x80 | (codepoint & 0x3F));
+        }
+        return out;
+    }
+
+private:
+    Link link;
+    uint32_t random;
+    Stats stats;
+    KeyReport previous;
+    std::u32string text;
+    uint16_t pendingDead = 0;
+
+    std::map<uint16_t, uint32_t> keymap;             // stroke -> character
+    std::map<uint16_t, uint32_t> deadKeys;           // stroke -> accent typed alone
+    std::map<std::pair<uint16_t, uint32_t>, uint32_t> composed; // dead stroke, base -> character
+
+    static uint16_t strokeKey(uint8_t modifiers, uint8_t keycode) { return (modifiers << 8) | keycode; }
+
+    void buildKeymap(const uint8_t* asciimap) {
+        for (uint8_t c = 1; c < 0x80; c++) {
+            KeyStroke stroke = KeyReportPacker::strokeFor(c, asciimap);
+            if (stroke.keycode) {
+                keymap.emplace(strokeKey(stroke.modifiers, stroke.keycode), c);
+            }
+        }
+
+        const codepoints::CodepointTable* table = codepoints::tableFor(asciimap);
+        if (!table) {
+            return;
+        }
+        table->forEach([&](const codepoints::CodepointEntry& entry) {
+            uint16_t key = strokeKey(entry.stroke.modifiers, entry.stroke.keycode);
+            if (entry.base == 0) {
+                keymap[key] = entry.codepoint;
+            } else if (entry.base == ' ') {
+                deadKeys[key] = entry.codepoint;
+            } else {
+                composed[{key, uint32_t(entry.base)}] = entry.codepoint;
+            }
+        });
+    }
+
+    void loadReference(const ReferenceKeymap& reference) {
+        for (size_t i = 0; i < reference.keyCount; i++) {
+            const ReferenceKey& entry = reference.keys[i];
+            uint16_t key = strokeKey(entry.modifiers, entry.keycode);
+            if (entry.dead) {
+                deadKeys[key] = entry.codepoint;
+            } else {
+                keymap[key] = entry.codepoint;
+            }
+        }
+        for (size_t i = 0; i < reference.composedCount; i++) {
+            const ReferenceCompose& entry = reference.composed[i];
+            composed[{strokeKey(entry.modifiers, entry.keycode), entry.base}] = entry.codepoint;
+        }
+    }
+
+    void press(uint8_t modifiers, uint8_t keycode) {
+        uint16_t key = strokeKey(modifiers, keycode);
+        if (deadKeys.count(key)) {
+            if (pendingDead) {
+                text += deadKeys[pendingDead];
+            }
+            pendingDead = key;
+            return;
+        }
+
+        auto it = keymap.find(key);
+        uint32_t c = it != keymap.end() ? it->second : 0xFFFD;
+        if (pendingDead) {
+            // Like the OS: composed letter, the accent alone on space, else both
+            auto comp = composed.find({pendingDead, c});
+            if (comp != composed.end()) {
+                c = comp->second;
+            } else if (c == ' ') {
+                c = deadKeys[pendingDead];
+            } else {
+                text += deadKeys[pendingDead];
+            }
+            pendingDead = 0;
+        }
+        text += c;
+    }
+
+    bool held(uint8_t key) const {
+        return std::find(std::begin(previous.keys), std::end(previous.keys), key) != std::end(previous.keys);
+    }
+
+    uint32_t nextRandom() {
+        random = random * 1103515245u + 12345u;
+        return random >> 16;
+    }
+
+    uint32_t intervalsUsed() const {
+        return (stats.reports + link.reportsPerInterval - 1) / link.reportsPerInterval;
+    }
+
+    static std::u32string decode(const std::string& utf8) {
+        std::u32string out;
+        auto data = reinterpret_cast<const uint8_t*>(utf8.data());
+        size_t size = utf8.size();
+        while (size > 0) {
+            uint32_t codepoint = 0;
+            size_t used = codepoints::decodeUtf8(data, size, codepoint);
+            out += codepoint;
+            data += used;
+            size -= used;
+        }
+        return out;
+    }
+
+    static uint32_t distance(const std::u32string& a, const std::u32string& b) {
+        std::vector<uint32_t> row(b.size() + 1);
+        for (size_t j = 0; j <= b.size(); j++) {
+            row[j] = j;
+        }
+        for (size_t i = 1; i <= a.size(); i++) {
+            uint32_t diagonal = row[0];
+            row[0] = i;
+            for (size_t j = 1; j <= b.size(); j++) {
+                uint32_t above = row[j];
+                row[j] = std::min({row[j] + 1, row[j - 1] + 1, diagonal + (a[i - 1] != b[j - 1])});
+                diagonal = above;
+            }
+        }
+        return row[b.size()];
+    }
+};
+
+#endif // HID_HOST_SIMULATOR_H
@@ -0,0 +1,5582 @@
+#ifndef REFERENCE_KEYMAPS_H
+#define REFERENCE_KEYMAPS_H
+
+// Generated by gen_reference_keymaps.py from xkeyboard-config 2.35.1-1, do not edit.
+// What the host types for each stroke, independent of the firmware tables.
+// Windows overrides for the keys xkb types differently are listed in the script.
+
+#include <cstddef>
+#include <cstdint>
+
+struct ReferenceKey {
+    uint8_t modifiers;
+    uint8_t keycode;
+    uint32_t codepoint; // spacing accent for a dead key
+    bool dead;
+};
+
+struct ReferenceCompose {
+    uint8_t modifiers;
+    uint8_t keycode; // the dead key
+    uint32_t base;
+    uint32_t codepoint;
+};
+
+struct ReferenceKeymap {
+    const char* layout; // KeyboardLayoutMapper name
+    const ReferenceKey* keys;
+    size_t keyCount;
+    const ReferenceCompose* composed;
+    size_t composedCount;
+};
+
+// English (US), xkb "us"
+static const ReferenceKey reference_english_us_keys[] = {
+    {0x00, 0x04, 0x0061, false},
+    {0x00, 0x05, 0x0062, false},
+    {0x00, 0x06, 0x0063, false},
+    {0x00, 0x07, 0x0064, false},
+    {0x00, 0x08, 0x0065, false},
+    {0x00, 0x09, 0x0066, false},
+    {0x00, 0x0A, 0x0067, false},
+    {0x00, 0x0B, 0x0068, false},
+    {0x00, 0x0C, 0x0069, false},
+    {0x00, 0x0D, 0x006A, false},
+    {0x00, 0x0E, 0x006B, false},
+    {0x00, 0x0F, 0x006C, false},
+    {0x00, 0x10, 0x006D, false},
+    {0x00, 0x11, 0x006E, false},
+    {0x00, 0x12, 0x006F, false},
+    {0x00, 0x13, 0x0070, false},
+    {0x00, 0x14, 0x0071, false},
+    {0x00, 0x15, 0x0072, false},
+    {0x00, 0x16, 0x0073, false},
+    {0x00, 0x17, 0x0074, false},
+    {0x00, 0x18, 0x0075, false},
+    {0x00, 0x19, 0x0076, false},
+    {0x00, 0x1A, 0x0077, false},
+    {0x00, 0x1B, 0x0078, false},
+    {0x00, 0x1C, 0x0079, false},
+    {0x00, 0x1D, 0x007A, false},
+    {0x00, 0x1E, 0x0031, false},
+    {0x00, 0x1F, 0x0032, false},
+    {0x00, 0x20, 0x0033, false},
+    {0x00, 0x21, 0x0034, false},
+    {0x00, 0x22, 0x0035, false},
+    {0x00, 0x23, 0x0036, false},
+    {0x00, 0x24, 0x0037, false},
+    {0x00, 0x25, 0x0038, false},
+    {0x00, 0x26, 0x0039, false},
+    {0x00, 0x27, 0x0030, false},
+    {0x00, 0x28, 0x000A, false},
+    {0x00, 0x2B, 0x0009, false},
+    {0x00, 0x2C, 0x0020, false},
+    {0x00, 0x2D, 0x002D, false},
+    {0x00, 0x2E, 0x003D, false},
+    {0x00, 0x2F, 0x005B, false},
+    {0x00, 0x30, 0x005D, false},
+    {0x00, 0x31, 0x005C, false},
+    {0x00, 0x32, 0x005C, false},
+    {0x00, 0x33, 0x003B, false},
+    {0x00, 0x34, 0x0027, false},
+    {0x00, 0x35, 0x0060, false},
+    {0x00, 0x36, 0x002C, false},
+    {0x00, 0x37, 0x002E, false},
+    {0x00, 0x38, 0x002F, false},
+    {0x00, 0x54, 0x002F, false},
+    {0x00, 0x64, 0x003C, false},
+    {0x02, 0x04, 0x0041, false},
+    {0x02, 0x05, 0x0042, false},
+    {0x02, 0x06, 0x0043, false},
+    {0x02, 0x07, 0x0044, false},
+    {0x02, 0x08, 0x0045, false},
+    {0x02, 0x09, 0x0046, false},
+    {0x02, 0x0A, 0x0047, false},
+    {0x02, 0x0B, 0x0048, false},
+    {0x02, 0x0C, 0x0049, false},
+    {0x02, 0x0D, 0x004A, false},
+    {0x02, 0x0E, 0x004B, false},
+    {0x02, 0x0F, 0x004C, false},
+    {0x02, 0x10, 0x004D, false},
+    {0x02, 0x11, 0x004E, false},
+    {0x02, 0x12, 0x004F, false},
+    {0x02, 0x13, 0x0050, false},
+    {0x02, 0x14, 0x0051, false},
+    {0x02, 0x15, 0x0052, false},
+    {0x02, 0x16, 0x0053, false},
+    {0x02, 0x17, 0x0054, false},
+    {0x02, 0x18, 0x0055, false},
+    {0x02, 0x19, 0x0056, false},
+    {0x02, 0x1A, 0x0057, false},
+    {0x02, 0x1B, 0x0058, false},
+    {0x02, 0x1C, 0x0059, false},
+    {0x02, 0x1D, 0x005A, false},
+    {0x02, 0x1E, 0x0021, false},
+    {0x02, 0x1F, 0x0040, false},
+    {0x02, 0x20, 0x0023, false},
+    {0x02, 0x21, 0x0024, false},
+    {0x02, 0x22, 0x0025, false},
+    {0x02, 0x23, 0x005E, false},
+    {0x02, 0x24, 0x0026, false},
+    {0x02, 0x25, 0x002A, false},
+    {0x02, 0x26, 0x0028, false},
+    {0x02, 0x27, 0x0029, false},
+    {0x02, 0x28, 0x000A, false},
+    {0x02, 0x2C, 0x0020, false},
+    {0x02, 0x2D, 0x005F, false},
+    {0x02, 0x2E, 0x002B, false},
+    {0x02, 0x2F, 0x007B, false},
+    {0x02, 0x30, 0x007D, false},
+    {0x02, 0x31, 0x007C, false},
+    {0x02, 0x32, 0x007C, false},
+    {0x02, 0x33, 0x003A, false},
+    {0x02, 0x34, 0x0022, false},
+    {0x02, 0x35, 0x007E, false},
+    {0x02, 0x36, 0x003C, false},
+    {0x02, 0x37, 0x003E, false},
+    {0x02, 0x38, 0x003F, false},
+    {0x02, 0x54, 0x002F, false},
+    {0x02, 0x64, 0x003E, false},
+    {0x40, 0x04, 0x0061, false},
+    {0x40, 0x05, 0x0062, false},
+    {0x40, 0x06, 0x0063, false},
+    {0x40, 0x07, 0x0064, false},
+    {0x40, 0x08, 0x0065, false},
+    {0x40, 0x09, 0x0066, false},
+    {0x40, 0x0A, 0x0067, false},
+    {0x40, 0x0B, 0x0068, false},
+    {0x40, 0x0C, 0x0069, false},
+    {0x40, 0x0D, 0x006A, false},
+    {0x40, 0x0E, 0x006B, false},
+    {0x40, 0x0F, 0x006C, false},
+    {0x40, 0x10, 0x006D, false},
+    {0x40, 0x11, 0x006E, false},
+    {0x40, 0x12, 0x006F, false},
+    {0x40, 0x13, 0x0070, false},
+    {0x40, 0x14, 0x0071, false},
+    {0x40, 0x15, 0x0072, false},
+    {0x40, 0x16, 0x0073, false},
+    {0x40, 0x17, 0x0074, false},
+    {0x40, 0x18, 0x0075, false},
+    {0x40, 0x19, 0x0076, false},
+    {0x40, 0x1A, 0x0077, false},
+    {0x40, 0x1B, 0x0078, false},
+    {0x40, 0x1C, 0x0079, false},
+    {0x40, 0x1D, 0x007A, false},
+    {0x40, 0x1E, 0x0031, false},
+    {0x40, 0x1F, 0x0032, false},
+    {0x40, 0x20, 0x0033, false},
+    {0x40, 0x21, 0x0034, false},
+    {0x40, 0x22, 0x0035, false},
+    {0x40, 0x23, 0x0036, false},
+    {0x40, 0x24, 0x0037, false},
+    {0x40, 0x25, 0x0038, false},
+    {0x40, 0x26, 0x0039, false},
+    {0x40, 0x27, 0x0030, false},
+    {0x40, 0x28, 0x000A, false},
+    {0x40, 0x2B, 0x0009, false},
+    {0x40, 0x2C, 0x0020, false},
+    {0x40, 0x2D, 0x002D, false},
+    {0x40, 0x2E, 0x003D, false},
+    {0x40, 0x2F, 0x005B, false},
+    {0x40, 0x30, 0x005D, false},
+    {0x40, 0x31, 0x005C, false},
+    {0x40, 0x32, 0x005C, false},
+    {0x40, 0x33, 0x003B, false},
+    {0x40, 0x34, 0x0027, false},
+    {0x40, 0x35, 0x0060, false},
+    {0x40, 0x36, 0x002C, false},
+    {0x40, 0x37, 0x002E, false},
+    {0x40, 0x38, 0x002F, false},
+    {0x40, 0x54, 0x002F, false},
+    {0x40, 0x64, 0x003C, false},
+    {0x42, 0x04, 0x0041, false},
+    {0x42, 0x05, 0x0042, false},
+    {0x42, 0x06, 0x0043, false},
+    {0x42, 0x07, 0x0044, false},
+    {0x42, 0x08, 0x0045, false},
+    {0x42, 0x09, 0x0046, false},
+    {0x42, 0x0A, 0x0047, false},
+    {0x42, 0x0B, 0x0048, false},
+    {0x42, 0x0C, 0x0049, false},
+    {0x42, 0x0D, 0x004A, false},
+    {0x42, 0x0E, 0x004B, false},
+    {0x42, 0x0F, 0x004C, false},
+    {0x42, 0x10, 0x004D, false},
+    {0x42, 0x11, 0x004E, false},
+    {0x42, 0x12, 0x004F, false},
+    {0x42, 0x13, 0x0050, false},
+    {0x42, 0x14, 0x0051, false},
+    {0x42, 0x15, 0x0052, false},
+    {0x42, 0x16, 0x0053, false},
+    {0x42, 0x17, 0x0054, false},
+    {0x42, 0x18, 0x0055, false},
+    {0x42, 0x19, 0x0056, false},
+    {0x42, 0x1A, 0x0057, false},
+    {0x42, 0x1B, 0x0058, false},
+    {0x42, 0x1C, 0x0059, false},
+    {0x42, 0x1D, 0x005A, false},
+    {0x42, 0x1E, 0x0021, false},
+    {0x42, 0x1F, 0x0040, false},
+    {0x42, 0x20, 0x0023, false},
+    {0x42, 0x21, 0x0024, false},
+    {0x42, 0x22, 0x0025, false},
+    {0x42, 0x23, 0x005E, false},
+    {0x42, 0x24, 0x0026, false},
+    {0x42, 0x25, 0x002A, false},
+    {0x42, 0x26, 0x0028, false},
+    {0x42, 0x27, 0x0029, false},
+    {0x42, 0x28, 0x000A, false},
+    {0x42, 0x2C, 0x0020, false},
+    {0x42, 0x2D, 0x005F, false},
+    {0x42, 0x2E, 0x002B, false},
+    {0x42, 0x2F, 0x007B, false},
+    {0x42, 0x30, 0x007D, false},
+    {0x42, 0x31, 0x007C, false},
+    {0x42, 0x32, 0x007C, false},
+    {0x42, 0x33, 0x003A, false},
+    {0x42, 0x34, 0x0022, false},
+    {0x42, 0x35, 0x007E, false},
+    {0x42, 0x36, 0x003C, false},
+    {0x42, 0x37, 0x003E, false},
+    {0x42, 0x38, 0x003F, false},
+    {0x42, 0x54, 0x002F, false},
+    {0x42, 0x64, 0x003E, false},
+};
+
+// English (UK), xkb "gb"
+static const ReferenceKey reference_english_uk_keys[] = {
+    {0x00, 0x04, 0x0061, false},
+    {0x00, 0x05, 0x0062, false},
+    {0x00, 0x06, 0x0063, false},
+    {0x00, 0x07, 0x0064, false},
+    {0x00, 0x08, 0x0065, false},
+    {0x00, 0x09, 0x0066, false},
+    {0x00, 0x0A, 0x0067, false},
+    {0x00, 0x0B, 0x0068, false},
+    {0x00, 0x0C, 0x0069, false},
+    {0x00, 0x0D, 0x006A, false},
+    {0x00, 0x0E, 0x006B, false},
+    {0x00, 0x0F, 0x006C, false},
+    {0x00, 0x10, 0x006D, false},
+    {0x00, 0x11, 0x006E, false},
+    {0x00, 0x12, 0x006F, false},
+    {0x00, 0x13, 0x0070, false},
+    {0x00, 0x14, 0x0071, false},
+    {0x00, 0x15, 0x0072, false},
+    {0x00, 0x16, 0x0073, false},
+    {0x00, 0x17, 0x0074, false},
+    {0x00, 0x18, 0x0075, false},
+    {0x00, 0x19, 0x0076, false},
+    {0x00, 0x1A, 0x0077, false},
+    {0x00, 0x1B, 0x0078, false},
+    {0x00, 0x1C, 0x0079, false},
+    {0x00, 0x1D, 0x007A, false},
+    {0x00, 0x1E, 0x0031, false},
+    {0x00, 0x1F, 0x0032, false},
+    {0x00, 0x20, 0x0033, false},
+    {0x00, 0x21, 0x0034, false},
+    {0x00, 0x22, 0x0035, false},
+    {0x00, 0x23, 0x0036, false},
+    {0x00, 0x24, 0x0037, false},
+    {0x00, 0x25, 0x0038, false},
+    {0x00, 0x26, 0x0039, false},
+    {0x00, 0x27, 0x0030, false},
+    {0x00, 0x28, 0x000A, false},
+    {0x00, 0x2B, 0x0009, false},
+    {0x00, 0x2C, 0x0020, false},
+    {0x00, 0x2D, 0x002D, false},
+    {0x00, 0x2E, 0x003D, false},
+    {0x00, 0x2F, 0x005B, false},
+    {0x00, 0x30, 0x005D, false},
+    {0x00, 0x31, 0x0023, false},
+    {0x00, 0x32, 0x0023, false},
+    {0x00, 0x33, 0x003B, false},
+    {0x00, 0x34, 0x0027, false},
+    {0x00, 0x35, 0x0060, false},
+    {0x00, 0x36, 0x002C, false},
+    {0x00, 0x37, 0x002E, false},
+    {0x00, 0x38, 0x002F, false},
+    {0x00, 0x54, 0x002F, false},
+    {0x00, 0x64, 0x005C, false},
+    {0x02, 0x04, 0x0041, false},
+    {0x02, 0x05, 0x0042, false},
+    {0x02, 0x06, 0x0043, false},
+    {0x02, 0x07, 0x0044, false},
+    {0x02, 0x08, 0x0045, false},
+    {0x02, 0x09, 0x0046, false},
+    {0x02, 0x0A, 0x0047, false},
+    {0x02, 0x0B, 0x0048, false},
+    {0x02, 0x0C, 0x0049, false},
+    {0x02, 0x0D, 0x004A, false},
+    {0x02, 0x0E, 0x004B, false},
+    {0x02, 0x0F, 0x004C, false},
+    {0x02, 0x10, 0x004D, false},
+    {0x02, 0x11, 0x004E, false},
+    {0x02, 0x12, 0x004F, false},
+    {0x02, 0x13, 0x0050, false},
+    {0x02, 0x14, 0x0051, false},
+    {0x02, 0x15, 0x0052, false},
+    {0x02, 0x16, 0x0053, false},
+    {0x02, 0x17, 0x0054, false},
+    {0x02, 0x18, 0x0055, false},
+    {0x02, 0x19, 0x0056, false},
+    {0x02, 0x1A, 0x0057, false},
+    {0x02, 0x1B, 0x0058, false},
+    {0x02, 0x1C, 0x0059, false},
+    {0x02, 0x1D, 0x005A, false},
+    {0x02, 0x1E, 0x0021, false},
+    {0x02, 0x1F, 0x0022, false},
+    {0x02, 0x20, 0x00A3, false},
+    {0x02, 0x21, 0x0024, false},
+    {0x02, 0x22, 0x0025, false},
+    {0x02, 0x23, 0x005E, false},
+    {0x02, 0x24, 0x0026, false},
+    {0x02, 0x25, 0x002A, false},
+    {0x02, 0x26, 0x0028, false},
+    {0x02, 0x27, 0x0029, false},
+    {0x02, 0x28, 0x000A, false},
+    {0x02, 0x2C, 0x0020, false},
+    {0x02, 0x2D, 0x005F, false},
+    {0x02, 0x2E, 0x002B, false},
+    {0x02, 0x2F, 0x007B, false},
+    {0x02, 0x30, 0x007D, false},
+    {0x02, 0x31, 0x007E, false},
+    {0x02, 0x32, 0x007E, false},
+    {0x02, 0x33, 0x003A, false},
+    {0x02, 0x34, 0x0040, false},
+    {0x02, 0x35, 0x00AC, false},
+    {0x02, 0x36, 0x003C, false},
+    {0x02, 0x37, 0x003E, false},
+    {0x02, 0x38, 0x003F, false},
+    {0x02, 0x54, 0x002F, false},
+    {0x02, 0x64, 0x007C, false},
+    {0x40, 0x04, 0x00E1, false},
+    {0x40, 0x05, 0x201C, false},
+    {0x40, 0x06, 0x00A2, false},
+    {0x40, 0x07, 0x00F0, false},
+    {0x40, 0x08, 0x00E9, false},
+    {0x40, 0x09, 0x0111, false},
+    {0x40, 0x0A, 0x014B, false},
+    {0x40, 0x0B, 0x0127, false},
+    {0x40, 0x0C, 0x00ED, false},
+    {0x40, 0x0E, 0x0138, false},
+    {0x40, 0x0F, 0x0142, false},
+    {0x40, 0x10, 0x00B5, false},
+    {0x40, 0x11, 0x201D, false},
+    {0x40, 0x12, 0x00F3, false},
+    {0x40, 0x13, 0x00FE, false},
+    {0x40, 0x14, 0x0040, false},
+    {0x40, 0x15, 0x00B6, false},
+    {0x40, 0x16, 0x00DF, false},
+    {0x40, 0x17, 0x0167, false},
+    {0x40, 0x18, 0x00FA, false},
+    {0x40, 0x19, 0x201E, false},
+    {0x40, 0x1A, 0x017F, false},
+    {0x40, 0x1B, 0x00BB, false},
+    {0x40, 0x1C, 0x2190, false},
+    {0x40, 0x1D, 0x00AB, false},
+    {0x40, 0x1E, 0x00B9, false},
+    {0x40, 0x1F, 0x00B2, false},
+    {0x40, 0x20, 0x00B3, false},
+    {0x40, 0x21, 0x20AC, false},
+    {0x40, 0x22, 0x00BD, false},
+    {0x40, 0x23, 0x00BE, false},
+    {0x40, 0x24, 0x007B, false},
+    {0x40, 0x25, 0x005B, false},
+    {0x40, 0x26, 0x005D, false},
+    {0x40, 0x27, 0x007D, false},
+    {0x40, 0x28, 0x000A, false},
+    {0x40, 0x2B, 0x0009, false},
+    {0x40, 0x2C, 0x0020, false},
+    {0x40, 0x2D, 0x005C, false},
+    {0x40, 0x2E, 0x00B8, true},
+    {0x40, 0x2F, 0x00A8, true},
+    {0x40, 0x30, 0x007E, true},
+    {0x40, 0x31, 0x0060, true},
+    {0x40, 0x32, 0x0060, true},
+    {0x40, 0x33, 0x00B4, true},
+    {0x40, 0x34, 0x005E, true},
+    {0x40, 0x35, 0x00A6, false},
+    {0x40, 0x36, 0x2022, false},
+    {0x40, 0x37, 0x00B7, false},
+    {0x40, 0x54, 0x002F, false},
+    {0x40, 0x64, 0x007C, false},
+    {0x42, 0x04, 0x00C1, false},
+    {0x42, 0x05, 0x2018, false},
+    {0x42, 0x06, 0x00A9, false},
+    {0x42, 0x07, 0x00D0, false},
+    {0x42, 0x08, 0x00C9, false},
+    {0x42, 0x09, 0x00AA, false},
+    {0x42, 0x0A, 0x014A, false},
+    {0x42, 0x0B, 0x0126, false},
+    {0x42, 0x0C, 0x00CD, false},
+    {0x42, 0x0E, 0x0026, false},
+    {0x42, 0x0F, 0x0141, false},
+    {0x42, 0x10, 0x00BA, false},
+    {0x42, 0x11, 0x2019, false},
+    {0x42, 0x12, 0x00D3, false},
+    {0x42, 0x13, 0x00DE, false},
+    {0x42, 0x14, 0x03A9, false},
+    {0x42, 0x15, 0x00AE, false},
+    {0x42, 0x16, 0x1E9E, false},
+    {0x42, 0x17, 0x0166, false},
+    {0x42, 0x18, 0x00DA, false},
+    {0x42, 0x19, 0x201A, false},
+    {0x42, 0x1A, 0x00A7, false},
+    {0x42, 0x1B, 0x003E, false},
+    {0x42, 0x1C, 0x00A5, false},
+    {0x42, 0x1D, 0x003C, false},
+    {0x42, 0x1E, 0x00A1, false},
+    {0x42, 0x1F, 0x215B, false},
+    {0x42, 0x20, 0x00A3, false},
+    {0x42, 0x21, 0x00BC, false},
+    {0x42, 0x22, 0x215C, false},
+    {0x42, 0x23, 0x215D, false},
+    {0x42, 0x24, 0x215E, false},
+    {0x42, 0x25, 0x2122, false},
+    {0x42, 0x26, 0x00B1, false},
+    {0x42, 0x27, 0x00B0, false},
+    {0x42, 0x28, 0x000A, false},
+    {0x42, 0x2C, 0x0020, false},
+    {0x42, 0x2D, 0x00BF, false},
+    {0x42, 0x2E, 0x02DB, true},
+    {0x42, 0x2F, 0x02DA, true},
+    {0x42, 0x30, 0x00AF, true},
+    {0x42, 0x31, 0x02D8, true},
+    {0x42, 0x32, 0x02D8, true},
+    {0x42, 0x33, 0x02DD, true},
+    {0x42, 0x34, 0x02C7, true},
+    {0x42, 0x35, 0x007C, false},
+    {0x42, 0x36, 0x00D7, false},
+    {0x42, 0x37, 0x00F7, false},
+    {0x42, 0x38, 0x02D9, true},
+    {0x42, 0x54, 0x002F, false},
+    {0x42, 0x64, 0x00A6, false},
+};
+static const ReferenceCompose reference_english_uk_composed[] = {
+    {0x40, 0x2E, 0x0043, 0x00C7},
+    {0x40, 0x2E, 0x0044, 0x1E10},
+    {0x40, 0x2E, 0x0045, 0x0228},
+    {0x40, 0x2E, 0x0047, 0x0122},
+    {0x40, 0x2E, 0x0048, 0x1E28},
+    {0x40, 0x2E, 0x004B, 0x0136},
+    {0x40, 0x2E, 0x004C, 0x013B},
+    {0x40, 0x2E, 0x004E, 0x0145},
+    {0x40, 0x2E, 0x0052, 0x0156},
+    {0x40, 0x2E, 0x0053, 0x015E},
+    {0x40, 0x2E, 0x0054, 0x0162},
+    {0x40, 0x2E, 0x0063, 0x00E7},
+    {0x40, 0x2E, 0x0064, 0x1E11},
+    {0x40, 0x2E, 0x0065, 0x0229},
+    {0x40, 0x2E, 0x0067, 0x0123},
+    {0x40, 0x2E, 0x0068, 0x1E29},
+    {0x40, 0x2E, 0x006B, 0x0137},
+    {0x40, 0x2E, 0x006C, 0x013C},
+    {0x40, 0x2E, 0x006E, 0x0146},
+    {0x40, 0x2E, 0x0072, 0x0157},
+    {0x40, 0x2E, 0x0073, 0x015F},
+    {0x40, 0x2E, 0x0074, 0x0163},
+    {0x40, 0x2F, 0x0041, 0x00C4},
+    {0x40, 0x2F, 0x0045, 0x00CB},
+    {0x40, 0x2F, 0x0048, 0x1E26},
+    {0x40, 0x2F, 0x0049, 0x00CF},
+    {0x40, 0x2F, 0x004F, 0x00D6},
+    {0x40, 0x2F, 0x0055, 0x00DC},
+    {0x40, 0x2F, 0x0057, 0x1E84},
+    {0x40, 0x2F, 0x0058, 0x1E8C},
+    {0x40, 0x2F, 0x0059, 0x0178},
+    {0x40, 0x2F, 0x0061, 0x00E4},
+    {0x40, 0x2F, 0x0065, 0x00EB},
+    {0x40, 0x2F, 0x0068, 0x1E27},
+    {0x40, 0x2F, 0x0069, 0x00EF},
+    {0x40, 0x2F, 0x006F, 0x00F6},
+    {0x40, 0x2F, 0x0074, 0x1E97},
+    {0x40, 0x2F, 0x0075, 0x00FC},
+    {0x40, 0x2F, 0x0077, 0x1E85},
+    {0x40, 0x2F, 0x0078, 0x1E8D},
+    {0x40, 0x2F, 0x0079, 0x00FF},
+    {0x40, 0x30, 0x0041, 0x00C3},
+    {0x40, 0x30, 0x0045, 0x1EBC},
+    {0x40, 0x30, 0x0049, 0x0128},
+    {0x40, 0x30, 0x004E, 0x00D1},
+    {0x40, 0x30, 0x004F, 0x00D5},
+    {0x40, 0x30, 0x0055, 0x0168},
+    {0x40, 0x30, 0x0056, 0x1E7C},
+    {0x40, 0x30, 0x0059, 0x1EF8},
+    {0x40, 0x30, 0x0061, 0x00E3},
+    {0x40, 0x30, 0x0065, 0x1EBD},
+    {0x40, 0x30, 0x0069, 0x0129},
+    {0x40, 0x30, 0x006E, 0x00F1},
+    {0x40, 0x30, 0x006F, 0x00F5},
+    {0x40, 0x30, 0x0075, 0x0169},
+    {0x40, 0x30, 0x0076, 0x1E7D},
+    {0x40, 0x30, 0x0079, 0x1EF9},
+    {0x40, 0x31, 0x0041, 0x00C0},
+    {0x40, 0x31, 0x0045, 0x00C8},
+    {0x40, 0x31, 0x0049, 0x00CC},
+    {0x40, 0x31, 0x004E, 0x01F8},
+    {0x40, 0x31, 0x004F, 0x00D2},
+    {0x40, 0x31, 0x0055, 0x00D9},
+    {0x40, 0x31, 0x0057, 0x1E80},
+    {0x40, 0x31, 0x0059, 0x1EF2},
+    {0x40, 0x31, 0x0061, 0x00E0},
+    {0x40, 0x31, 0x0065, 0x00E8},
+    {0x40, 0x31, 0x0069, 0x00EC},
+    {0x40, 0x31, 0x006E, 0x01F9},
+    {0x40, 0x31, 0x006F, 0x00F2},
+    {0x40, 0x31, 0x0075, 0x00F9},
+    {0x40, 0x31, 0x0077, 0x1E81},
+    {0x40, 0x31, 0x0079, 0x1EF3},
+    {0x40, 0x31, 0x03A9, 0x1FFA},
+    {0x40, 0x32, 0x0041, 0x00C0},
+    {0x40, 0x32, 0x0045, 0x00C8},
+    {0x40, 0x32, 0x0049, 0x00CC},
+    {0x40, 0x32, 0x004E, 0x01F8},
+    {0x40, 0x32, 0x004F, 0x00D2},
+    {0x40, 0x32, 0x0055, 0x00D9},
+    {0x40, 0x32, 0x0057, 0x1E80},
+    {0x40, 0x32, 0x0059, 0x1EF2},
+    {0x40, 0x32, 0x0061, 0x00E0},
+    {0x40, 0x32, 0x0065, 0x00E8},
+    {0x40, 0x32, 0x0069, 0x00EC},
+    {0x40, 0x32, 0x006E, 0x01F9},
+    {0x40, 0x32, 0x006F, 0x00F2},
+    {0x40, 0x32, 0x0075, 0x00F9},
+    {0x40, 0x32, 0x0077, 0x1E81},
+    {0x40, 0x32, 0x0079, 0x1EF3},
+    {0x40, 0x32, 0x03A9, 0x1FFA},
+    {0x40, 0x33, 0x0041, 0x00C1},
+    {0x40, 0x33, 0x0043, 0x0106},
+    {0x40, 0x33, 0x0045, 0x00C9},
+    {0x40, 0x33, 0x0047, 0x01F4},
+    {0x40, 0x33, 0x0049, 0x00CD},
+    {0x40, 0x33, 0x004B, 0x1E30},
+    {0x40, 0x33, 0x004C, 0x0139},
+    {0x40, 0x33, 0x004D, 0x1E3E},
+    {0x40, 0x33, 0x004E, 0x0143},
+    {0x40, 0x33, 0x004F, 0x00D3},
+    {0x40, 0x33, 0x0050, 0x1E54},
+    {0x40, 0x33, 0x0052, 0x0154},
+    {0x40, 0x33, 0x0053, 0x015A},
+    {0x40, 0x33, 0x0055, 0x00DA},
+    {0x40, 0x33, 0x0057, 0x1E82},
+    {0x40, 0x33, 0x0059, 0x00DD},
+    {0x40, 0x33, 0x005A, 0x0179},
+    {0x40, 0x33, 0x0061, 0x00E1},
+    {0x40, 0x33, 0x0063, 0x0107},
+    {0x40, 0x33, 0x0065, 0x00E9},
+    {0x40, 0x33, 0x0067, 0x01F5},
+    {0x40, 0x33, 0x0069, 0x00ED},
+    {0x40, 0x33, 0x006B, 0x1E31},
+    {0x40, 0x33, 0x006C, 0x013A},
+    {0x40, 0x33, 0x006D, 0x1E3F},
+    {0x40, 0x33, 0x006E, 0x0144},
+    {0x40, 0x33, 0x006F, 0x00F3},
+    {0x40, 0x33, 0x0070, 0x1E55},
+    {0x40, 0x33, 0x0072, 0x0155},
+    {0x40, 0x33, 0x0073, 0x015B},
+    {0x40, 0x33, 0x0075, 0x00FA},
+    {0x40, 0x33, 0x0077, 0x1E83},
+    {0x40, 0x33, 0x0079, 0x00FD},
+    {0x40, 0x33, 0x007A, 0x017A},
+    {0x40, 0x33, 0x03A9, 0x038F},
+    {0x40, 0x34, 0x0041, 0x00C2},
+    {0x40, 0x34, 0x0043, 0x0108},
+    {0x40, 0x34, 0x0045, 0x00CA},
+    {0x40, 0x34, 0x0047, 0x011C},
+    {0x40, 0x34, 0x0048, 0x0124},
+    {0x40, 0x34, 0x0049, 0x00CE},
+    {0x40, 0x34, 0x004A, 0x0134},
+    {0x40, 0x34, 0x004F, 0x00D4},
+    {0x40, 0x34, 0x0053, 0x015C},
+    {0x40, 0x34, 0x0055, 0x00DB},
+    {0x40, 0x34, 0x0057, 0x0174},
+    {0x40, 0x34, 0x0059, 0x0176},
+    {0x40, 0x34, 0x005A, 0x1E90},
+    {0x40, 0x34, 0x0061, 0x00E2},
+    {0x40, 0x34, 0x0063, 0x0109},
+    {0x40, 0x34, 0x0065, 0x00EA},
+    {0x40, 0x34, 0x0067, 0x011D},
+    {0x40, 0x34, 0x0068, 0x0125},
+    {0x40, 0x34, 0x0069, 0x00EE},
+    {0x40, 0x34, 0x006A, 0x0135},
+    {0x40, 0x34, 0x006F, 0x00F4},
+    {0x40, 0x34, 0x0073, 0x015D},
+    {0x40, 0x34, 0x0075, 0x00FB},
+    {0x40, 0x34, 0x0077, 0x0175},
+    {0x40, 0x34, 0x0079, 0x0177},
+    {0x40, 0x34, 0x007A, 0x1E91},
+    {0x42, 0x2E, 0x0041, 0x0104},
+    {0x42, 0x2E, 0x0045, 0x0118},
+    {0x42, 0x2E, 0x0049, 0x012E},
+    {0x42, 0x2E, 0x004F, 0x01EA},
+    {0x42, 0x2E, 0x0055, 0x0172},
+    {0x42, 0x2E, 0x0061, 0x0105},
+    {0x42, 0x2E, 0x0065, 0x0119},
+    {0x42, 0x2E, 0x0069, 0x012F},
+    {0x42, 0x2E, 0x006F, 0x01EB},
+    {0x42, 0x2E, 0x0075, 0x0173},
+    {0x42, 0x2F, 0x0041, 0x00C5},
+    {0x42, 0x2F, 0x0055, 0x016E},
+    {0x42, 0x2F, 0x0061, 0x00E5},
+    {0x42, 0x2F, 0x0075, 0x016F},
+    {0x42, 0x2F, 0x0077, 0x1E98},
+    {0x42, 0x2F, 0x0079, 0x1E99},
+    {0x42, 0x30, 0x0041, 0x0100},
+    {0x42, 0x30, 0x0045, 0x0112},
+    {0x42, 0x30, 0x0047, 0x1E20},
+    {0x42, 0x30, 0x0049, 0x012A},
+    {0x42, 0x30, 0x004F, 0x014C},
+    {0x42, 0x30, 0x0055, 0x016A},
+    {0x42, 0x30, 0x0059, 0x0232},
+    {0x42, 0x30, 0x0061, 0x0101},
+    {0x42, 0x30, 0x0065, 0x0113},
+    {0x42, 0x30, 0x0067, 0x1E21},
+    {0x42, 0x30, 0x0069, 0x012B},
+    {0x42, 0x30, 0x006F, 0x014D},
+    {0x42, 0x30, 0x0075, 0x016B},
+    {0x42, 0x30, 0x0079, 0x0233},
+    {0x42, 0x31, 0x0041, 0x0102},
+    {0x42, 0x31, 0x0045, 0x0114},
+    {0x42, 0x31, 0x0047, 0x011E},
+    {0x42, 0x31, 0x0049, 0x012C},
+    {0x42, 0x31, 0x004F, 0x014E},
+    {0x42, 0x31, 0x0055, 0x016C},
+    {0x42, 0x31, 0x0061, 0x0103},
+    {0x42, 0x31, 0x0065, 0x0115},
+    {0x42, 0x31, 0x0067, 0x011F},
+    {0x42, 0x31, 0x0069, 0x012D},
+    {0x42, 0x31, 0x006F, 0x014F},
+    {0x42, 0x31, 0x0075, 0x016D},
+    {0x42, 0x32, 0x0041, 0x0102},
+    {0x42, 0x32, 0x0045, 0x0114},
+    {0x42, 0x32, 0x0047, 0x011E},
+    {0x42, 0x32, 0x0049, 0x012C},
+    {0x42, 0x32, 0x004F, 0x014E},
+    {0x42, 0x32, 0x0055, 0x016C},
+    {0x42, 0x32, 0x0061, 0x0103},
+    {0x42, 0x32, 0x0065, 0x0115},
+    {0x42, 0x32, 0x0067, 0x011F},
+    {0x42, 0x32, 0x0069, 0x012D},
+    {0x42, 0x32, 0x006F, 0x014F},
+    {0x42, 0x32, 0x0075, 0x016D},
+    {0x42, 0x33, 0x004F, 0x0150},
+    {0x42, 0x33, 0x0055, 0x0170},
+    {0x42, 0x33, 0x006F, 0x0151},
+    {0x42, 0x33, 0x0075, 0x0171},
+    {0x42, 0x34, 0x0041, 0x01CD},
+    {0x42, 0x34, 0x0043, 0x010C},
+    {0x42, 0x34, 0x0044, 0x010E},
+    {0x42, 0x34, 0x0045, 0x011A},
+    {0x42, 0x34, 0x0047, 0x01E6},
+    {0x42, 0x34, 0x0048, 0x021E},
+    {0x42, 0x34, 0x0049, 0x01CF},
+    {0x42, 0x34, 0x004B, 0x01E8},
+    {0x42, 0x34, 0x004C, 0x013D},
+    {0x42, 0x34, 0x004E, 0x0147},
+    {0x42, 0x34, 0x004F, 0x01D1},
+    {0x42, 0x34, 0x0052, 0x0158},
+    {0x42, 0x34, 0x0053, 0x0160},
+    {0x42, 0x34, 0x0054, 0x0164},
+    {0x42, 0x34, 0x0055, 0x01D3},
+    {0x42, 0x34, 0x005A, 0x017D},
+    {0x42, 0x34, 0x0061, 0x01CE},
+    {0x42, 0x34, 0x0063, 0x010D},
+    {0x42, 0x34, 0x0064, 0x010F},
+    {0x42, 0x34, 0x0065, 0x011B},
+    {0x42, 0x34, 0x0067, 0x01E7},
+    {0x42, 0x34, 0x0068, 0x021F},
+    {0x42, 0x34, 0x0069, 0x01D0},
+    {0x42, 0x34, 0x006A, 0x01F0},
+    {0x42, 0x34, 0x006B, 0x01E9},
+    {0x42, 0x34, 0x006C, 0x013E},
+    {0x42, 0x34, 0x006E, 0x0148},
+    {0x42, 0x34, 0x006F, 0x01D2},
+    {0x42, 0x34, 0x0072, 0x0159},
+    {0x42, 0x34, 0x0073, 0x0161},
+    {0x42, 0x34, 0x0074, 0x0165},
+    {0x42, 0x34, 0x0075, 0x01D4},
+    {0x42, 0x34, 0x007A, 0x017E},
+    {0x42, 0x38, 0x0041, 0x0226},
+    {0x42, 0x38, 0x0042, 0x1E02},
+    {0x42, 0x38, 0x0043, 0x010A},
+    {0x42, 0x38, 0x0044, 0x1E0A},
+    {0x42, 0x38, 0x0045, 0x0116},
+    {0x42, 0x38, 0x0046, 0x1E1E},
+    {0x42, 0x38, 0x0047, 0x0120},
+    {0x42, 0x38, 0x0048, 0x1E22},
+    {0x42, 0x38, 0x0049, 0x0130},
+    {0x42, 0x38, 0x004D, 0x1E40},
+    {0x42, 0x38, 0x004E, 0x1E44},
+    {0x42, 0x38, 0x004F, 0x022E},
+    {0x42, 0x38, 0x0050, 0x1E56},
+    {0x42, 0x38, 0x0052, 0x1E58},
+    {0x42, 0x38, 0x0053, 0x1E60},
+    {0x42, 0x38, 0x0054, 0x1E6A},
+    {0x42, 0x38, 0x0057, 0x1E86},
+    {0x42, 0x38, 0x0058, 0x1E8A},
+    {0x42, 0x38, 0x0059, 0x1E8E},
+    {0x42, 0x38, 0x005A, 0x017B},
+    {0x42, 0x38, 0x0061, 0x0227},
+    {0x42, 0x38, 0x0062, 0x1E03},
+    {0x42, 0x38, 0x0063, 0x010B},
+    {0x42, 0x38, 0x0064, 0x1E0B},
+    {0x42, 0x38, 0x0065, 0x0117},
+    {0x42, 0x38, 0x0066, 0x1E1F},
+    {0x42, 0x38, 0x0067, 0x0121},
+    {0x42, 0x38, 0x0068, 0x1E23},
+    {0x42, 0x38, 0x006D, 0x1E41},
+    {0x42, 0x38, 0x006E, 0x1E45},
+    {0x42, 0x38, 0x006F, 0x022F},
+    {0x42, 0x38, 0x0070, 0x1E57},
+    {0x42, 0x38, 0x0072, 0x1E59},
+    {0x42, 0x38, 0x0073, 0x1E61},
+    {0x42, 0x38, 0x0074, 0x1E6B},
+    {0x42, 0x38, 0x0077, 0x1E87},
+    {0x42, 0x38, 0x0078, 0x1E8B},
+    {0x42, 0x38, 0x0079, 0x1E8F},
+    {0x42, 0x38, 0x007A, 0x017C},
+    {0x42, 0x38, 0x017F, 0x1E9B},
+};
+
+// French (FR), xkb "fr"
+static const ReferenceKey reference_french_fr_keys[] = {
+    {0x00, 0x04, 0x0071, false},
+    {0x00, 0x05, 0x0062, false},
+    {0x00, 0x06, 0x0063, false},
+    {0x00, 0x07, 0x0064, false},
+    {0x00, 0x08, 0x0065, false},
+    {0x00, 0x09, 0x0066, false},
+    {0x00, 0x0A, 0x0067, false},
+    {0x00, 0x0B, 0x0068, false},
+    {0x00, 0x0C, 0x0069, false},
+    {0x00, 0x0D, 0x006A, false},
+    {0x00, 0x0E, 0x006B, false},
+    {0x00, 0x0F, 0x006C, false},
+    {0x00, 0x10, 0x002C, false},
+    {0x00, 0x11, 0x006E, false},
+    {0x00, 0x12, 0x006F, false},
+    {0x00, 0x13, 0x0070, false},
+    {0x00, 0x14, 0x0061, false},
+    {0x00, 0x15, 0x0072, false},
+    {0x00, 0x16, 0x0073, false},
+    {0x00, 0x17, 0x0074, false},
+    {0x00, 0x18, 0x0075, false},
+    {0x00, 0x19, 0x0076, false},
+    {0x00, 0x1A, 0x007A, false},
+    {0x00, 0x1B, 0x0078, false},
+    {0x00, 0x1C, 0x0079, false},
+    {0x00, 0x1D, 0x0077, false},
+    {0x00, 0x1E, 0x0026, false},
+    {0x00, 0x1F, 0x00E9, false},
+    {0x00, 0x20, 0x0022, false},
+    {0x00, 0x21, 0x0027, false},
+    {0x00, 0x22, 0x0028, false},
+    {0x00, 0x23, 0x002D, false},
+    {0x00, 0x24, 0x00E8, false},
+    {0x00, 0x25, 0x005F, false},
+    {0x00, 0x26, 0x00E7, false},
+    {0x00, 0x27, 0x00E0, false},
+    {0x00, 0x28, 0x000A, false},
+    {0x00, 0x2B, 0x0009, false},
+    {0x00, 0x2C, 0x0020, false},
+    {0x00, 0x2D, 0x0029, false},
+    {0x00, 0x2E, 0x003D, false},
+    {0x00, 0x2F, 0x005E, true},
+    {0x00, 0x30, 0x0024, false},
+    {0x00, 0x31, 0x002A, false},
+    {0x00, 0x32, 0x002A, false},
+    {0x00, 0x33, 0x006D, false},
+    {0x00, 0x34, 0x00F9, false},
+    {0x00, 0x35, 0x00B2, false},
+    {0x00, 0x36, 0x003B, false},
+    {0x00, 0x37, 0x003A, false},
+    {0x00, 0x38, 0x0021, false},
+    {0x00, 0x54, 0x002F, false},
+    {0x00, 0x64, 0x003C, false},
+    {0x02, 0x04, 0x0051, false},
+    {0x02, 0x05, 0x0042, false},
+    {0x02, 0x06, 0x0043, false},
+    {0x02, 0x07, 0x0044, false},
+    {0x02, 0x08, 0x0045, false},
+    {0x02, 0x09, 0x0046, false},
+    {0x02, 0x0A, 0x0047, false},
+    {0x02, 0x0B, 0x0048, false},
+    {0x02, 0x0C, 0x0049, false},
+    {0x02, 0x0D, 0x004A, false},
+    {0x02, 0x0E, 0x004B, false},
+    {0x02, 0x0F, 0x004C, false},
+    {0x02, 0x10, 0x003F, false},
+    {0x02, 0x11, 0x004E, false},
+    {0x02, 0x12, 0x004F, false},
+    {0x02, 0x13, 0x0050, false},
+    {0x02, 0x14, 0x0041, false},
+    {0x02, 0x15, 0x0052, false},
+    {0x02, 0x16, 0x0053, false},
+    {0x02, 0x17, 0x0054, false},
+    {0x02, 0x18, 0x0055, false},
+    {0x02, 0x19, 0x0056, false},
+    {0x02, 0x1A, 0x005A, false},
+    {0x02, 0x1B, 0x0058, false},
+    {0x02, 0x1C, 0x0059, false},
+    {0x02, 0x1D, 0x0057, false},
+    {0x02, 0x1E, 0x0031, false},
+    {0x02, 0x1F, 0x0032, false},
+    {0x02, 0x20, 0x0033, false},
+    {0x02, 0x21, 0x0034, false},
+    {0x02, 0x22, 0x0035, false},
+    {0x02, 0x23, 0x0036, false},
+    {0x02, 0x24, 0x0037, false},
+    {0x02, 0x25, 0x0038, false},
+    {0x02, 0x26, 0x0039, false},
+    {0x02, 0x27, 0x0030, false},
+    {0x02, 0x28, 0x000A, false},
+    {0x02, 0x2C, 0x0020, false},
+    {0x02, 0x2D, 0x00B0, false},
+    {0x02, 0x2E, 0x002B, false},
+    {0x02, 0x2F, 0x00A8, true},
+    {0x02, 0x30, 0x00A3, false},
+    {0x02, 0x31, 0x00B5, false},
+    {0x02, 0x32, 0x00B5, false},
+    {0x02, 0x33, 0x004D, false},
+    {0x02, 0x34, 0x0025, false},
+    {0x02, 0x35, 0x007E, false},
+    {0x02, 0x36, 0x002E, false},
+    {0x02, 0x37, 0x002F, false},
+    {0x02, 0x38, 0x00A7, false},
+    {0x02, 0x54, 0x002F, false},
+    {0x02, 0x64, 0x003E, false},
+    {0x40, 0x04, 0x0040, false},
+    {0x40, 0x05, 0x201C, false},
+    {0x40, 0x06, 0x00A2, false},
+    {0x40, 0x07, 0x00F0, false},
+    {0x40, 0x08, 0x20AC, false},
+    {0x40, 0x09, 0x0111, false},
+    {0x40, 0x0A, 0x014B, false},
+    {0x40, 0x0B, 0x0127, false},
+    {0x40, 0x0C, 0x2192, false},
+    {0x40, 0x0E, 0x0138, false},
+    {0x40, 0x0F, 0x0142, false},
+    {0x40, 0x10, 0x00B4, true},
+    {0x40, 0x11, 0x201D, false},
+    {0x40, 0x12, 0x00F8, false},
+    {0x40, 0x13, 0x00FE, false},
+    {0x40, 0x14, 0x00E6, false},
+    {0x40, 0x15, 0x00B6, false},
+    {0x40, 0x16, 0x00DF, false},
+    {0x40, 0x17, 0x0167, false},
+    {0x40, 0x18, 0x2193, false},
+    {0x40, 0x19, 0x201E, false},
+    {0x40, 0x1A, 0x00AB, false},
+    {0x40, 0x1B, 0x00BB, false},
+    {0x40, 0x1C, 0x2190, false},
+    {0x40, 0x1D, 0x0142, false},
+    {0x40, 0x1E, 0x00B9, false},
+    {0x40, 0x1F, 0x007E, true},
+    {0x40, 0x20, 0x0023, false},
+    {0x40, 0x21, 0x007B, false},
+    {0x40, 0x22, 0x005B, false},
+    {0x40, 0x23, 0x007C, false},
+    {0x40, 0x24, 0x0060, true},
+    {0x40, 0x25, 0x005C, false},
+    {0x40, 0x26, 0x005E, false},
+    {0x40, 0x27, 0x0040, false},
+    {0x40, 0x28, 0x000A, false},
+    {0x40, 0x2B, 0x0009, false},
+    {0x40, 0x2C, 0x0020, false},
+    {0x40, 0x2D, 0x005D, false},
+    {0x40, 0x2E, 0x007D, false},
+    {0x40, 0x2F, 0x00A8, true},
+    {0x40, 0x30, 0x00A4, false},
+    {0x40, 0x31, 0x0060, true},
+    {0x40, 0x32, 0x0060, true},
+    {0x40, 0x33, 0x00B5, false},
+    {0x40, 0x34, 0x005E, true},
+    {0x40, 0x35, 0x00AC, false},
+    {0x40, 0x36, 0x2022, false},
+    {0x40, 0x37, 0x00B7, false},
+    {0x40, 0x54, 0x002F, false},
+    {0x40, 0x64, 0x007C, false},
+    {0x42, 0x04, 0x03A9, false},
+    {0x42, 0x05, 0x2018, false},
+    {0x42, 0x06, 0x00A9, false},
+    {0x42, 0x07, 0x00D0, false},
+    {0x42, 0x08, 0x00A2, false},
+    {0x42, 0x09, 0x00AA, false},
+    {0x42, 0x0A, 0x014A, false},
+    {0x42, 0x0B, 0x0126, false},
+    {0x42, 0x0C, 0x0131, false},
+    {0x42, 0x0E, 0x0026, false},
+    {0x42, 0x0F, 0x0141, false},
+    {0x42, 0x10, 0x02DD, true},
+    {0x42, 0x11, 0x2019, false},
+    {0x42, 0x12, 0x00D8, false},
+    {0x42, 0x13, 0x00DE, false},
+    {0x42, 0x14, 0x00C6, false},
+    {0x42, 0x15, 0x00AE, false},
+    {0x42, 0x16, 0x1E9E, false},
+    {0x42, 0x17, 0x0166, false},
+    {0x42, 0x18, 0x2191, false},
+    {0x42, 0x19, 0x201A, false},
+    {0x42, 0x1A, 0x003C, false},
+    {0x42, 0x1B, 0x003E, false},
+    {0x42, 0x1C, 0x00A5, false},
+    {0x42, 0x1D, 0x0141, false},
+    {0x42, 0x1E, 0x00A1, false},
+    {0x42, 0x1F, 0x215B, false},
+    {0x42, 0x20, 0x00A3, false},
+    {0x42, 0x21, 0x0024, false},
+    {0x42, 0x22, 0x215C, false},
+    {0x42, 0x23, 0x215D, false},
+    {0x42, 0x24, 0x215E, false},
+    {0x42, 0x25, 0x2122, false},
+    {0x42, 0x26, 0x00B1, false},
+    {0x42, 0x27, 0x00B0, false},
+    {0x42, 0x28, 0x000A, false},
+    {0x42, 0x2C, 0x0020, false},
+    {0x42, 0x2D, 0x00BF, false},
+    {0x42, 0x2E, 0x02DB, true},
+    {0x42, 0x2F, 0x02DA, true},
+    {0x42, 0x30, 0x00AF, true},
+    {0x42, 0x31, 0x02D8, true},
+    {0x42, 0x32, 0x02D8, true},
+    {0x42, 0x33, 0x00BA, false},
+    {0x42, 0x34, 0x02C7, true},
+    {0x42, 0x35, 0x00AC, false},
+    {0x42, 0x36, 0x00D7, false},
+    {0x42, 0x37, 0x00F7, false},
+    {0x42, 0x38, 0x02D9, true},
+    {0x42, 0x54, 0x002F, false},
+    {0x42, 0x64, 0x00A6, false},
+};
+static const ReferenceCompose reference_french_fr_composed[] = {
+    {0x00, 0x2F, 0x0041, 0x00C2},
+    {0x00, 0x2F, 0x0043, 0x0108},
+    {0x00, 0x2F, 0x0045, 0x00CA},
+    {0x00, 0x2F, 0x0047, 0x011C},
+    {0x00, 0x2F, 0x0048, 0x0124},
+    {0x00, 0x2F, 0x0049, 0x00CE},
+    {0x00, 0x2F, 0x004A, 0x0134},
+    {0x00, 0x2F, 0x004F, 0x00D4},
+    {0x00, 0x2F, 0x0053, 0x015C},
+    {0x00, 0x2F, 0x0055, 0x00DB},
+    {0x00, 0x2F, 0x0057, 0x0174},
+    {0x00, 0x2F, 0x0059, 0x0176},
+    {0x00, 0x2F, 0x005A, 0x1E90},
+    {0x00, 0x2F, 0x0061, 0x00E2},
+    {0x00, 0x2F, 0x0063, 0x0109},
+    {0x00, 0x2F, 0x0065, 0x00EA},
+    {0x00, 0x2F, 0x0067, 0x011D},
+    {0x00, 0x2F, 0x0068, 0x0125},
+    {0x00, 0x2F, 0x0069, 0x00EE},
+    {0x00, 0x2F, 0x006A, 0x0135},
+    {0x00, 0x2F, 0x006F, 0x00F4},
+    {0x00, 0x2F, 0x0073, 0x015D},
+    {0x00, 0x2F, 0x0075, 0x00FB},
+    {0x00, 0x2F, 0x0077, 0x0175},
+    {0x00, 0x2F, 0x0079, 0x0177},
+    {0x00, 0x2F, 0x007A, 0x1E91},
+    {0x02, 0x2F, 0x0041, 0x00C4},
+    {0x02, 0x2F, 0x0045, 0x00CB},
+    {0x02, 0x2F, 0x0048, 0x1E26},
+    {0x02, 0x2F, 0x0049, 0x00CF},
+    {0x02, 0x2F, 0x004F, 0x00D6},
+    {0x02, 0x2F, 0x0055, 0x00DC},
+    {0x02, 0x2F, 0x0057, 0x1E84},
+    {0x02, 0x2F, 0x0058, 0x1E8C},
+    {0x02, 0x2F, 0x0059, 0x0178},
+    {0x02, 0x2F, 0x0061, 0x00E4},
+    {0x02, 0x2F, 0x0065, 0x00EB},
+    {0x02, 0x2F, 0x0068, 0x1E27},
+    {0x02, 0x2F, 0x0069, 0x00EF},
+    {0x02, 0x2F, 0x006F, 0x00F6},
+    {0x02, 0x2F, 0x0074, 0x1E97},
+    {0x02, 0x2F, 0x0075, 0x00FC},
+    {0x02, 0x2F, 0x0077, 0x1E85},
+    {0x02, 0x2F, 0x0078, 0x1E8D},
+    {0x02, 0x2F, 0x0079, 0x00FF},
+    {0x40, 0x10, 0x0041, 0x00C1},
+    {0x40, 0x10, 0x0043, 0x0106},
+    {0x40, 0x10, 0x0045, 0x00C9},
+    {0x40, 0x10, 0x0047, 0x01F4},
+    {0x40, 0x10, 0x0049, 0x00CD},
+    {0x40, 0x10, 0x004B, 0x1E30},
+    {0x40, 0x10, 0x004C, 0x0139},
+    {0x40, 0x10, 0x004D, 0x1E3E},
+    {0x40, 0x10, 0x004E, 0x0143},
+    {0x40, 0x10, 0x004F, 0x00D3},
+    {0x40, 0x10, 0x0050, 0x1E54},
+    {0x40, 0x10, 0x0052, 0x0154},
+    {0x40, 0x10, 0x0053, 0x015A},
+    {0x40, 0x10, 0x0055, 0x00DA},
+    {0x40, 0x10, 0x0057, 0x1E82},
+    {0x40, 0x10, 0x0059, 0x00DD},
+    {0x40, 0x10, 0x005A, 0x0179},
+    {0x40, 0x10, 0x0061, 0x00E1},
+    {0x40, 0x10, 0x0063, 0x0107},
+    {0x40, 0x10, 0x0065, 0x00E9},
+    {0x40, 0x10, 0x0067, 0x01F5},
+    {0x40, 0x10, 0x0069, 0x00ED},
+    {0x40, 0x10, 0x006B, 0x1E31},
+    {0x40, 0x10, 0x006C, 0x013A},
+    {0x40, 0x10, 0x006D, 0x1E3F},
+    {0x40, 0x10, 0x006E, 0x0144},
+    {0x40, 0x10, 0x006F, 0x00F3},
+    {0x40, 0x10, 0x0070, 0x1E55},
+    {0x40, 0x10, 0x0072, 0x0155},
+    {0x40, 0x10, 0x0073, 0x015B},
+    {0x40, 0x10, 0x0075, 0x00FA},
+    {0x40, 0x10, 0x0077, 0x1E83},
+    {0x40, 0x10, 0x0079, 0x00FD},
+    {0x40, 0x10, 0x007A, 0x017A},
+    {0x40, 0x10, 0x00C6, 0x01FC},
+    {0x40, 0x10, 0x00D8, 0x01FE},
+    {0x40, 0x10, 0x00E6, 0x01FD},
+    {0x40, 0x10, 0x00E7, 0x1E09},
+    {0x40, 0x10, 0x00F8, 0x01FF},
+    {0x40, 0x10, 0x03A9, 0x038F},
+    {0x40, 0x1F, 0x0041, 0x00C3},
+    {0x40, 0x1F, 0x0045, 0x1EBC},
+    {0x40, 0x1F, 0x0049, 0x0128},
+    {0x40, 0x1F, 0x004E, 0x00D1},
+    {0x40, 0x1F, 0x004F, 0x00D5},
+    {0x40, 0x1F, 0x0055, 0x0168},
+    {0x40, 0x1F, 0x0056, 0x1E7C},
+    {0x40, 0x1F, 0x0059, 0x1EF8},
+    {0x40, 0x1F, 0x0061, 0x00E3},
+    {0x40, 0x1F, 0x0065, 0x1EBD},
+    {0x40, 0x1F, 0x0069, 0x0129},
+    {0x40, 0x1F, 0x006E, 0x00F1},
+    {0x40, 0x1F, 0x006F, 0x00F5},
+    {0x40, 0x1F, 0x0075, 0x0169},
+    {0x40, 0x1F, 0x0076, 0x1E7D},
+    {0x40, 0x1F, 0x0079, 0x1EF9},
+    {0x40, 0x24, 0x0041, 0x00C0},
+    {0x40, 0x24, 0x0045, 0x00C8},
+    {0x40, 0x24, 0x0049, 0x00CC},
+    {0x40, 0x24, 0x004E, 0x01F8},
+    {0x40, 0x24, 0x004F, 0x00D2},
+    {0x40, 0x24, 0x0055, 0x00D9},
+    {0x40, 0x24, 0x0057, 0x1E80},
+    {0x40, 0x24, 0x0059, 0x1EF2},
+    {0x40, 0x24, 0x0061, 0x00E0},
+    {0x40, 0x24, 0x0065, 0x00E8},
+    {0x40, 0x24, 0x0069, 0x00EC},
+    {0x40, 0x24, 0x006E, 0x01F9},
+    {0x40, 0x24, 0x006F, 0x00F2},
+    {0x40, 0x24, 0x0075, 0x00F9},
+    {0x40, 0x24, 0x0077, 0x1E81},
+    {0x40, 0x24, 0x0079, 0x1EF3},
+    {0x40, 0x24, 0x03A9, 0x1FFA},
+    {0x40, 0x2F, 0x0041, 0x00C4},
+    {0x40, 0x2F, 0x0045, 0x00CB},
+    {0x40, 0x2F, 0x0048, 0x1E26},
+    {0x40, 0x2F, 0x0049, 0x00CF},
+    {0x40, 0x2F, 0x004F, 0x00D6},
+    {0x40, 0x2F, 0x0055, 0x00DC},
+    {0x40, 0x2F, 0x0057, 0x1E84},
+    {0x40, 0x2F, 0x0058, 0x1E8C},
+    {0x40, 0x2F, 0x0059, 0x0178},
+    {0x40, 0x2F, 0x0061, 0x00E4},
+    {0x40, 0x2F, 0x0065, 0x00EB},
+    {0x40, 0x2F, 0x0068, 0x1E27},
+    {0x40, 0x2F, 0x0069, 0x00EF},
+    {0x40, 0x2F, 0x006F, 0x00F6},
+    {0x40, 0x2F, 0x0074, 0x1E97},
+    {0x40, 0x2F, 0x0075, 0x00FC},
+    {0x40, 0x2F, 0x0077, 0x1E85},
+    {0x40, 0x2F, 0x0078, 0x1E8D},
+    {0x40, 0x2F, 0x0079, 0x00FF},
+    {0x40, 0x31, 0x0041, 0x00C0},
+    {0x40, 0x31, 0x0045, 0x00C8},
+    {0x40, 0x31, 0x0049, 0x00CC},
+    {0x40, 0x31, 0x004E, 0x01F8},
+    {0x40, 0x31, 0x004F, 0x00D2},
+    {0x40, 0x31, 0x0055, 0x00D9},
+    {0x40, 0x31, 0x0057, 0x1E80},
+    {0x40, 0x31, 0x0059, 0x1EF2},
+    {0x40, 0x31, 0x0061, 0x00E0},
+    {0x40, 0x31, 0x0065, 0x00E8},
+    {0x40, 0x31, 0x0069, 0x00EC},
+    {0x40, 0x31, 0x006E, 0x01F9},
+    {0x40, 0x31, 0x006F, 0x00F2},
+    {0x40, 0x31, 0x0075, 0x00F9},
+    {0x40, 0x31, 0x0077, 0x1E81},
+    {0x40, 0x31, 0x0079, 0x1EF3},
+    {0x40, 0x31, 0x03A9, 0x1FFA},
+    {0x40, 0x32, 0x0041, 0x00C0},
+    {0x40, 0x32, 0x0045, 0x00C8},
+    {0x40, 0x32, 0x0049, 0x00CC},
+    {0x40, 0x32, 0x004E, 0x01F8},
+    {0x40, 0x32, 0x004F, 0x00D2},
+    {0x40, 0x32, 0x0055, 0x00D9},
+    {0x40, 0x32, 0x0057, 0x1E80},
+    {0x40, 0x32, 0x0059, 0x1EF2},
+    {0x40, 0x32, 0x0061, 0x00E0},
+    {0x40, 0x32, 0x0065, 0x00E8},
+    {0x40, 0x32, 0x0069, 0x00EC},
+    {0x40, 0x32, 0x006E, 0x01F9},
+    {0x40, 0x32, 0x006F, 0x00F2},
+    {0x40, 0x32, 0x0075, 0x00F9},
+    {0x40, 0x32, 0x0077, 0x1E81},
+    {0x40, 0x32, 0x0079, 0x1EF3},
+    {0x40, 0x32, 0x03A9, 0x1FFA},
+    {0x40, 0x34, 0x0041, 0x00C2},
+    {0x40, 0x34, 0x0043, 0x0108},
+    {0x40, 0x34, 0x0045, 0x00CA},
+    {0x40, 0x34, 0x0047, 0x011C},
+    {0x40, 0x34, 0x0048, 0x0124},
+    {0x40, 0x34, 0x0049, 0x00CE},
+    {0x40, 0x34, 0x004A, 0x0134},
+    {0x40, 0x34, 0x004F, 0x00D4},
+    {0x40, 0x34, 0x0053, 0x015C},
+    {0x40, 0x34, 0x0055, 0x00DB},
+    {0x40, 0x34, 0x0057, 0x0174},
+    {0x40, 0x34, 0x0059, 0x0176},
+    {0x40, 0x34, 0x005A, 0x1E90},
+    {0x40, 0x34, 0x0061, 0x00E2},
+    {0x40, 0x34, 0x0063, 0x0109},
+    {0x40, 0x34, 0x0065, 0x00EA},
+    {0x40, 0x34, 0x0067, 0x011D},
+    {0x40, 0x34, 0x0068, 0x0125},
+    {0x40, 0x34, 0x0069, 0x00EE},
+    {0x40, 0x34, 0x006A, 0x0135},
+    {0x40, 0x34, 0x006F, 0x00F4},
+    {0x40, 0x34, 0x0073, 0x015D},
+    {0x40, 0x34, 0x0075, 0x00FB},
+    {0x40, 0x34, 0x0077, 0x0175},
+    {0x40, 0x34, 0x0079, 0x0177},
+    {0x40, 0x34, 0x007A, 0x1E91},
+    {0x42, 0x10, 0x004F, 0x0150},
+    {0x42, 0x10, 0x0055, 0x0170},
+    {0x42, 0x10, 0x006F, 0x0151},
+    {0x42, 0x10, 0x0075, 0x0171},
+    {0x42, 0x2E, 0x0041, 0x0104},
+    {0x42, 0x2E, 0x0045, 0x0118},
+    {0x42, 0x2E, 0x0049, 0x012E},
+    {0x42, 0x2E, 0x004F, 0x01EA},
+    {0x42, 0x2E, 0x0055, 0x0172},
+    {0x42, 0x2E, 0x0061, 0x0105},
+    {0x42, 0x2E, 0x0065, 0x0119},
+    {0x42, 0x2E, 0x0069, 0x012F},
+    {0x42, 0x2E, 0x006F, 0x01EB},
+    {0x42, 0x2E, 0x0075, 0x0173},
+    {0x42, 0x2F, 0x0041, 0x00C5},
+    {0x42, 0x2F, 0x0055, 0x016E},
+    {0x42, 0x2F, 0x0061, 0x00E5},
+    {0x42, 0x2F, 0x0075, 0x016F},
+    {0x42, 0x2F, 0x0077, 0x1E98},
+    {0x42, 0x2F, 0x0079, 0x1E99},
+    {0x42, 0x30, 0x0041, 0x0100},
+    {0x42, 0x30, 0x0045, 0x0112},
+    {0x42, 0x30, 0x0047, 0x1E20},
+    {0x42, 0x30, 0x0049, 0x012A},
+    {0x42, 0x30, 0x004F, 0x014C},
+    {0x42, 0x30, 0x0055, 0x016A},
+    {0x42, 0x30, 0x0059, 0x0232},
+    {0x42, 0x30, 0x0061, 0x0101},
+    {0x42, 0x30, 0x0065, 0x0113},
+    {0x42, 0x30, 0x0067, 0x1E21},
+    {0x42, 0x30, 0x0069, 0x012B},
+    {0x42, 0x30, 0x006F, 0x014D},
+    {0x42, 0x30, 0x0075, 0x016B},
+    {0x42, 0x30, 0x0079, 0x0233},
+    {0x42, 0x30, 0x00C6, 0x01E2},
+    {0x42, 0x30, 0x00E6, 0x01E3},
+    {0x42, 0x31, 0x0041, 0x0102},
+    {0x42, 0x31, 0x0045, 0x0114},
+    {0x42, 0x31, 0x0047, 0x011E},
+    {0x42, 0x31, 0x0049, 0x012C},
+    {0x42, 0x31, 0x004F, 0x014E},
+    {0x42, 0x31, 0x0055, 0x016C},
+    {0x42, 0x31, 0x0061, 0x0103},
+    {0x42, 0x31, 0x0065, 0x0115},
+    {0x42, 0x31, 0x0067, 0x011F},
+    {0x42, 0x31, 0x0069, 0x012D},
+    {0x42, 0x31, 0x006F, 0x014F},
+    {0x42, 0x31, 0x0075, 0x016D},
+    {0x42, 0x32, 0x0041, 0x0102},
+    {0x42, 0x32, 0x0045, 0x0114},
+    {0x42, 0x32, 0x0047, 0x011E},
+    {0x42, 0x32, 0x0049, 0x012C},
+    {0x42, 0x32, 0x004F, 0x014E},
+    {0x42, 0x32, 0x0055, 0x016C},
+    {0x42, 0x32, 0x0061, 0x0103},
+    {0x42, 0x32, 0x0065, 0x0115},
+    {0x42, 0x32, 0x0067, 0x011F},
+    {0x42, 0x32, 0x0069, 0x012D},
+    {0x42, 0x32, 0x006F, 0x014F},
+    {0x42, 0x32, 0x0075, 0x016D},
+    {0x42, 0x34, 0x0041, 0x01CD},
+    {0x42, 0x34, 0x0043, 0x010C},
+    {0x42, 0x34, 0x0044, 0x010E},
+    {0x42, 0x34, 0x0045, 0x011A},
+    {0x42, 0x34, 0x0047, 0x01E6},
+    {0x42, 0x34, 0x0048, 0x021E},
+    {0x42, 0x34, 0x0049, 0x01CF},
+    {0x42, 0x34, 0x004B, 0x01E8},
+    {0x42, 0x34, 0x004C, 0x013D},
+    {0x42, 0x34, 0x004E, 0x0147},
+    {0x42, 0x34, 0x004F, 0x01D1},
+    {0x42, 0x34, 0x0052, 0x0158},
+    {0x42, 0x34, 0x0053, 0x0160},
+    {0x42, 0x34, 0x0054, 0x0164},
+    {0x42, 0x34, 0x0055, 0x01D3},
+    {0x42, 0x34, 0x005A, 0x017D},
+    {0x42, 0x34, 0x0061, 0x01CE},
+    {0x42, 0x34, 0x0063, 0x010D},
+    {0x42, 0x34, 0x0064, 0x010F},
+    {0x42, 0x34, 0x0065, 0x011B},
+    {0x42, 0x34, 0x0067, 0x01E7},
+    {0x42, 0x34, 0x0068, 0x021F},
+    {0x42, 0x34, 0x0069, 0x01D0},
+    {0x42, 0x34, 0x006A, 0x01F0},
+    {0x42, 0x34, 0x006B, 0x01E9},
+    {0x42, 0x34, 0x006C, 0x013E},
+    {0x42, 0x34, 0x006E, 0x0148},
+    {0x42, 0x34, 0x006F, 0x01D2},
+    {0x42, 0x34, 0x0072, 0x0159},
+    {0x42, 0x34, 0x0073, 0x0161},
+    {0x42, 0x34, 0x0074, 0x0165},
+    {0x42, 0x34, 0x0075, 0x01D4},
+    {0x42, 0x34, 0x007A, 0x017E},
+    {0x42, 0x38, 0x0041, 0x0226},
+    {0x42, 0x38, 0x0042, 0x1E02},
+    {0x42, 0x38, 0x0043, 0x010A},
+    {0x42, 0x38, 0x0044, 0x1E0A},
+    {0x42, 0x38, 0x0045, 0x0116},
+    {0x42, 0x38, 0x0046, 0x1E1E},
+    {0x42, 0x38, 0x0047, 0x0120},
+    {0x42, 0x38, 0x0048, 0x1E22},
+    {0x42, 0x38, 0x0049, 0x0130},
+    {0x42, 0x38, 0x004D, 0x1E40},
+    {0x42, 0x38, 0x004E, 0x1E44},
+    {0x42, 0x38, 0x004F, 0x022E},
+    {0x42, 0x38, 0x0050, 0x1E56},
+    {0x42, 0x38, 0x0052, 0x1E58},
+    {0x42, 0x38, 0x0053, 0x1E60},
+    {0x42, 0x38, 0x0054, 0x1E6A},
+    {0x42, 0x38, 0x0057, 0x1E86},
+    {0x42, 0x38, 0x0058, 0x1E8A},
+    {0x42, 0x38, 0x0059, 0x1E8E},
+    {0x42, 0x38, 0x005A, 0x017B},
+    {0x42, 0x38, 0x0061, 0x0227},
+    {0x42, 0x38, 0x0062, 0x1E03},
+    {0x42, 0x38, 0x0063, 0x010B},
+    {0x42, 0x38, 0x0064, 0x1E0B},
+    {0x42, 0x38, 0x0065, 0x0117},
+    {0x42, 0x38, 0x0066, 0x1E1F},
+    {0x42, 0x38, 0x0067, 0x0121},
+    {0x42, 0x38, 0x0068, 0x1E23},
+    {0x42, 0x38, 0x006D, 0x1E41},
+    {0x42, 0x38, 0x006E, 0x1E45},
+    {0x42, 0x38, 0x006F, 0x022F},
+    {0x42, 0x38, 0x0070, 0x1E57},
+    {0x42, 0x38, 0x0072, 0x1E59},
+    {0x42, 0x38, 0x0073, 0x1E61},
+    {0x42, 0x38, 0x0074, 0x1E6B},
+    {0x42, 0x38, 0x0077, 0x1E87},
+    {0x42, 0x38, 0x0078, 0x1E8B},
+    {0x42, 0x38, 0x0079, 0x1E8F},
+    {0x42, 0x38, 0x007A, 0x017C},
+};
+
+// German (DE), xkb "de"
+static const ReferenceKey reference_german_de_keys[] = {
+    {0x00, 0x04, 0x0061, false},
+    {0x00, 0x05, 0x0062, false},
+    {0x00, 0x06, 0x0063, false},
+    {0x00, 0x07, 0x0064, false},
+    {0x00, 0x08, 0x0065, false},
+    {0x00, 0x09, 0x0066, false},
+    {0x00, 0x0A, 0x0067, false},
+    {0x00, 0x0B, 0x0068, false},
+    {0x00, 0x0C, 0x0069, false},
+    {0x00, 0x0D, 0x006A, false},
+    {0x00, 0x0E, 0x006B, false},
+    {0x00, 0x0F, 0x006C, false},
+    {0x00, 0x10, 0x006D, false},
+    {0x00, 0x11, 0x006E, false},
+    {0x00, 0x12, 0x006F, false},
+    {0x00, 0x13, 0x0070, false},
+    {0x00, 0x14, 0x0071, false},
+    {0x00, 0x15, 0x0072, false},
+    {0x00, 0x16, 0x0073, false},
+    {0x00, 0x17, 0x0074, false},
+    {0x00, 0x18, 0x0075, false},
+    {0x00, 0x19, 0x0076, false},
+    {0x00, 0x1A, 0x0077, false},
+    {0x00, 0x1B, 0x0078, false},
+    {0x00, 0x1C, 0x007A, false},
+    {0x00, 0x1D, 0x0079, false},
+    {0x00, 0x1E, 0x0031, false},
+    {0x00, 0x1F, 0x0032, false},
+    {0x00, 0x20, 0x0033, false},
+    {0x00, 0x21, 0x0034, false},
+    {0x00, 0x22, 0x0035, false},
+    {0x00, 0x23, 0x0036, false},
+    {0x00, 0x24, 0x0037, false},
+    {0x00, 0x25, 0x0038, false},
+    {0x00, 0x26, 0x0039, false},
+    {0x00, 0x27, 0x0030, false},
+    {0x00, 0x28, 0x000A, false},
+    {0x00, 0x2B, 0x0009, false},
+    {0x00, 0x2C, 0x0020, false},
+    {0x00, 0x2D, 0x00DF, false},
+    {0x00, 0x2E, 0x00B4, true},
+    {0x00, 0x2F, 0x00FC, false},
+    {0x00, 0x30, 0x002B, false},
+    {0x00, 0x31, 0x0023, false},
+    {0x00, 0x32, 0x0023, false},
+    {0x00, 0x33, 0x00F6, false},
+    {0x00, 0x34, 0x00E4, false},
+    {0x00, 0x35, 0x005E, true},
+    {0x00, 0x36, 0x002C, false},
+    {0x00, 0x37, 0x002E, false},
+    {0x00, 0x38, 0x002D, false},
+    {0x00, 0x54, 0x002F, false},
+    {0x00, 0x64, 0x003C, false},
+    {0x02, 0x04, 0x0041, false},
+    {0x02, 0x05, 0x0042, false},
+    {0x02, 0x06, 0x0043, false},
+    {0x02, 0x07, 0x0044, false},
+    {0x02, 0x08, 0x0045, false},
+    {0x02, 0x09, 0x0046, false},
+    {0x02, 0x0A, 0x0047, false},
+    {0x02, 0x0B, 0x0048, false},
+    {0x02, 0x0C, 0x0049, false},
+    {0x02, 0x0D, 0x004A, false},
+    {0x02, 0x0E, 0x004B, false},
+    {0x02, 0x0F, 0x004C, false},
+    {0x02, 0x10, 0x004D, false},
+    {0x02, 0x11, 0x004E, false},
+    {0x02, 0x12, 0x004F, false},
+    {0x02, 0x13, 0x0050, false},
+    {0x02, 0x14, 0x0051, false},
+    {0x02, 0x15, 0x0052, false},
+    {0x02, 0x16, 0x0053, false},
+    {0x02, 0x17, 0x0054, false},
+    {0x02, 0x18, 0x0055, false},
+    {0x02, 0x19, 0x0056, false},
+    {0x02, 0x1A, 0x0057, false},
+    {0x02, 0x1B, 0x0058, false},
+    {0x02, 0x1C, 0x005A, false},
+    {0x02, 0x1D, 0x0059, false},
+    {0x02, 0x1E, 0x0021, false},
+    {0x02, 0x1F, 0x0022, false},
+    {0x02, 0x20, 0x00A7, false},
+    {0x02, 0x21, 0x0024, false},
+    {0x02, 0x22, 0x0025, false},
+    {0x02, 0x23, 0x0026, false},
+    {0x02, 0x24, 0x002F, false},
+    {0x02, 0x25, 0x0028, false},
+    {0x02, 0x26, 0x0029, false},
+    {0x02, 0x27, 0x003D, false},
+    {0x02, 0x28, 0x000A, false},
+    {0x02, 0x2C, 0x0020, false},
+    {0x02, 0x2D, 0x003F, false},
+    {0x02, 0x2E, 0x0060, true},
+    {0x02, 0x2F, 0x00DC, false},
+    {0x02, 0x30, 0x002A, false},
+    {0x02, 0x31, 0x0027, false},
+    {0x02, 0x32, 0x0027, false},
+    {0x02, 0x33, 0x00D6, false},
+    {0x02, 0x34, 0x00C4, false},
+    {0x02, 0x35, 0x00B0, false},
+    {0x02, 0x36, 0x003B, false},
+    {0x02, 0x37, 0x003A, false},
+    {0x02, 0x38, 0x005F, false},
+    {0x02, 0x54, 0x002F, false},
+    {0x02, 0x64, 0x003E, false},
+    {0x40, 0x04, 0x00E6, false},
+    {0x40, 0x05, 0x201C, false},
+    {0x40, 0x06, 0x00A2, false},
+    {0x40, 0x07, 0x00F0, false},
+    {0x40, 0x08, 0x20AC, false},
+    {0x40, 0x09, 0x0111, false},
+    {0x40, 0x0A, 0x014B, false},
+    {0x40, 0x0B, 0x0127, false},
+    {0x40, 0x0C, 0x2192, false},
+    {0x40, 0x0E, 0x0138, false},
+    {0x40, 0x0F, 0x0142, false},
+    {0x40, 0x10, 0x00B5, false},
+    {0x40, 0x11, 0x201D, false},
+    {0x40, 0x12, 0x00F8, false},
+    {0x40, 0x13, 0x00FE, false},
+    {0x40, 0x14, 0x0040, false},
+    {0x40, 0x15, 0x00B6, false},
+    {0x40, 0x16, 0x017F, false},
+    {0x40, 0x17, 0x0167, false},
+    {0x40, 0x18, 0x2193, false},
+    {0x40, 0x19, 0x201E, false},
+    {0x40, 0x1A, 0x017F, false},
+    {0x40, 0x1B, 0x00AB, false},
+    {0x40, 0x1C, 0x2190, false},
+    {0x40, 0x1D, 0x00BB, false},
+    {0x40, 0x1E, 0x00B9, false},
+    {0x40, 0x1F, 0x00B2, false},
+    {0x40, 0x20, 0x00B3, false},
+    {0x40, 0x21, 0x00BC, false},
+    {0x40, 0x22, 0x00BD, false},
+    {0x40, 0x23, 0x00AC, false},
+    {0x40, 0x24, 0x007B, false},
+    {0x40, 0x25, 0x005B, false},
+    {0x40, 0x26, 0x005D, false},
+    {0x40, 0x27, 0x007D, false},
+    {0x40, 0x28, 0x000A, false},
+    {0x40, 0x2B, 0x0009, false},
+    {0x40, 0x2C, 0x0020, false},
+    {0x40, 0x2D, 0x005C, false},
+    {0x40, 0x2E, 0x00B8, true},
+    {0x40, 0x2F, 0x00A8, true},
+    {0x40, 0x30, 0x007E, false},
+    {0x40, 0x31, 0x2019, false},
+    {0x40, 0x32, 0x2019, false},
+    {0x40, 0x33, 0x02DD, true},
+    {0x40, 0x34, 0x005E, true},
+    {0x40, 0x35, 0x2032, false},
+    {0x40, 0x36, 0x00B7, false},
+    {0x40, 0x37, 0x2026, false},
+    {0x40, 0x38, 0x2013, false},
+    {0x40, 0x54, 0x002F, false},
+    {0x40, 0x64, 0x007C, false},
+    {0x42, 0x04, 0x00C6, false},
+    {0x42, 0x05, 0x2018, false},
+    {0x42, 0x06, 0x00A9, false},
+    {0x42, 0x07, 0x00D0, false},
+    {0x42, 0x08, 0x20AC, false},
+    {0x42, 0x09, 0x00AA, false},
+    {0x42, 0x0A, 0x014A, false},
+    {0x42, 0x0B, 0x0126, false},
+    {0x42, 0x0C, 0x0131, false},
+    {0x42, 0x0D, 0x02D9, true},
+    {0x42, 0x0E, 0x0026, false},
+    {0x42, 0x0F, 0x0141, false},
+    {0x42, 0x10, 0x00BA, false},
+    {0x42, 0x11, 0x2019, false},
+    {0x42, 0x12, 0x00D8, false},
+    {0x42, 0x13, 0x00DE, false},
+    {0x42, 0x14, 0x03A9, false},
+    {0x42, 0x15, 0x00AE, false},
+    {0x42, 0x16, 0x1E9E, false},
+    {0x42, 0x17, 0x0166, false},
+    {0x42, 0x18, 0x2191, false},
+    {0x42, 0x19, 0x201A, false},
+    {0x42, 0x1A, 0x00A7, false},
+    {0x42, 0x1B, 0x2039, false},
+    {0x42, 0x1C, 0x00A5, false},
+    {0x42, 0x1D, 0x203A, false},
+    {0x42, 0x1E, 0x00A1, false},
+    {0x42, 0x1F, 0x215B, false},
+    {0x42, 0x20, 0x00A3, false},
+    {0x42, 0x21, 0x00A4, false},
+    {0x42, 0x22, 0x215C, false},
+    {0x42, 0x23, 0x215D, false},
+    {0x42, 0x24, 0x215E, false},
+    {0x42, 0x25, 0x2122, false},
+    {0x42, 0x26, 0x00B1, false},
+    {0x42, 0x27, 0x00B0, false},
+    {0x42, 0x28, 0x000A, false},
+    {0x42, 0x2C, 0x0020, false},
+    {0x42, 0x2D, 0x00BF, false},
+    {0x42, 0x2E, 0x02DB, true},
+    {0x42, 0x2F, 0x02DA, true},
+    {0x42, 0x30, 0x00AF, false},
+    {0x42, 0x31, 0x02D8, true},
+    {0x42, 0x32, 0x02D8, true},
+    {0x42, 0x34, 0x02C7, true},
+    {0x42, 0x35, 0x2033, false},
+    {0x42, 0x36, 0x00D7, false},
+    {0x42, 0x37, 0x00F7, false},
+    {0x42, 0x38, 0x2014, false},
+    {0x42, 0x54, 0x002F, false},
+};
+static const ReferenceCompose reference_german_de_composed[] = {
+    {0x00, 0x2E, 0x0041, 0x00C1},
+    {0x00, 0x2E, 0x0043, 0x0106},
+    {0x00, 0x2E, 0x0045, 0x00C9},
+    {0x00, 0x2E, 0x0047, 0x01F4},
+    {0x00, 0x2E, 0x0049, 0x00CD},
+    {0x00, 0x2E, 0x004B, 0x1E30},
+    {0x00, 0x2E, 0x004C, 0x0139},
+    {0x00, 0x2E, 0x004D, 0x1E3E},
+    {0x00, 0x2E, 0x004E, 0x0143},
+    {0x00, 0x2E, 0x004F, 0x00D3},
+    {0x00, 0x2E, 0x0050, 0x1E54},
+    {0x00, 0x2E, 0x0052, 0x0154},
+    {0x00, 0x2E, 0x0053, 0x015A},
+    {0x00, 0x2E, 0x0055, 0x00DA},
+    {0x00, 0x2E, 0x0057, 0x1E82},
+    {0x00, 0x2E, 0x0059, 0x00DD},
+    {0x00, 0x2E, 0x005A, 0x0179},
+    {0x00, 0x2E, 0x0061, 0x00E1},
+    {0x00, 0x2E, 0x0063, 0x0107},
+    {0x00, 0x2E, 0x0065, 0x00E9},
+    {0x00, 0x2E, 0x0067, 0x01F5},
+    {0x00, 0x2E, 0x0069, 0x00ED},
+    {0x00, 0x2E, 0x006B, 0x1E31},
+    {0x00, 0x2E, 0x006C, 0x013A},
+    {0x00, 0x2E, 0x006D, 0x1E3F},
+    {0x00, 0x2E, 0x006E, 0x0144},
+    {0x00, 0x2E, 0x006F, 0x00F3},
+    {0x00, 0x2E, 0x0070, 0x1E55},
+    {0x00, 0x2E, 0x0072, 0x0155},
+    {0x00, 0x2E, 0x0073, 0x015B},
+    {0x00, 0x2E, 0x0075, 0x00FA},
+    {0x00, 0x2E, 0x0077, 0x1E83},
+    {0x00, 0x2E, 0x0079, 0x00FD},
+    {0x00, 0x2E, 0x007A, 0x017A},
+    {0x00, 0x2E, 0x00C6, 0x01FC},
+    {0x00, 0x2E, 0x00D8, 0x01FE},
+    {0x00, 0x2E, 0x00DC, 0x01D7},
+    {0x00, 0x2E, 0x00E6, 0x01FD},
+    {0x00, 0x2E, 0x00F8, 0x01FF},
+    {0x00, 0x2E, 0x00FC, 0x01D8},
+    {0x00, 0x2E, 0x03A9, 0x038F},
+    {0x00, 0x35, 0x0041, 0x00C2},
+    {0x00, 0x35, 0x0043, 0x0108},
+    {0x00, 0x35, 0x0045, 0x00CA},
+    {0x00, 0x35, 0x0047, 0x011C},
+    {0x00, 0x35, 0x0048, 0x0124},
+    {0x00, 0x35, 0x0049, 0x00CE},
+    {0x00, 0x35, 0x004A, 0x0134},
+    {0x00, 0x35, 0x004F, 0x00D4},
+    {0x00, 0x35, 0x0053, 0x015C},
+    {0x00, 0x35, 0x0055, 0x00DB},
+    {0x00, 0x35, 0x0057, 0x0174},
+    {0x00, 0x35, 0x0059, 0x0176},
+    {0x00, 0x35, 0x005A, 0x1E90},
+    {0x00, 0x35, 0x0061, 0x00E2},
+    {0x00, 0x35, 0x0063, 0x0109},
+    {0x00, 0x35, 0x0065, 0x00EA},
+    {0x00, 0x35, 0x0067, 0x011D},
+    {0x00, 0x35, 0x0068, 0x0125},
+    {0x00, 0x35, 0x0069, 0x00EE},
+    {0x00, 0x35, 0x006A, 0x0135},
+    {0x00, 0x35, 0x006F, 0x00F4},
+    {0x00, 0x35, 0x0073, 0x015D},
+    {0x00, 0x35, 0x0075, 0x00FB},
+    {0x00, 0x35, 0x0077, 0x0175},
+    {0x00, 0x35, 0x0079, 0x0177},
+    {0x00, 0x35, 0x007A, 0x1E91},
+    {0x02, 0x2E, 0x0041, 0x00C0},
+    {0x02, 0x2E, 0x0045, 0x00C8},
+    {0x02, 0x2E, 0x0049, 0x00CC},
+    {0x02, 0x2E, 0x004E, 0x01F8},
+    {0x02, 0x2E, 0x004F, 0x00D2},
+    {0x02, 0x2E, 0x0055, 0x00D9},
+    {0x02, 0x2E, 0x0057, 0x1E80},
+    {0x02, 0x2E, 0x0059, 0x1EF2},
+    {0x02, 0x2E, 0x0061, 0x00E0},
+    {0x02, 0x2E, 0x0065, 0x00E8},
+    {0x02, 0x2E, 0x0069, 0x00EC},
+    {0x02, 0x2E, 0x006E, 0x01F9},
+    {0x02, 0x2E, 0x006F, 0x00F2},
+    {0x02, 0x2E, 0x0075, 0x00F9},
+    {0x02, 0x2E, 0x0077, 0x1E81},
+    {0x02, 0x2E, 0x0079, 0x1EF3},
+    {0x02, 0x2E, 0x00DC, 0x01DB},
+    {0x02, 0x2E, 0x00FC, 0x01DC},
+    {0x02, 0x2E, 0x03A9, 0x1FFA},
+    {0x40, 0x2E, 0x0043, 0x00C7},
+    {0x40, 0x2E, 0x0044, 0x1E10},
+    {0x40, 0x2E, 0x0045, 0x0228},
+    {0x40, 0x2E, 0x0047, 0x0122},
+    {0x40, 0x2E, 0x0048, 0x1E28},
+    {0x40, 0x2E, 0x004B, 0x0136},
+    {0x40, 0x2E, 0x004C, 0x013B},
+    {0x40, 0x2E, 0x004E, 0x0145},
+    {0x40, 0x2E, 0x0052, 0x0156},
+    {0x40, 0x2E, 0x0053, 0x015E},
+    {0x40, 0x2E, 0x0054, 0x0162},
+    {0x40, 0x2E, 0x0063, 0x00E7},
+    {0x40, 0x2E, 0x0064, 0x1E11},
+    {0x40, 0x2E, 0x0065, 0x0229},
+    {0x40, 0x2E, 0x0067, 0x0123},
+    {0x40, 0x2E, 0x0068, 0x1E29},
+    {0x40, 0x2E, 0x006B, 0x0137},
+    {0x40, 0x2E, 0x006C, 0x013C},
+    {0x40, 0x2E, 0x006E, 0x0146},
+    {0x40, 0x2E, 0x0072, 0x0157},
+    {0x40, 0x2E, 0x0073, 0x015F},
+    {0x40, 0x2E, 0x0074, 0x0163},
+    {0x40, 0x2F, 0x0041, 0x00C4},
+    {0x40, 0x2F, 0x0045, 0x00CB},
+    {0x40, 0x2F, 0x0048, 0x1E26},
+    {0x40, 0x2F, 0x0049, 0x00CF},
+    {0x40, 0x2F, 0x004F, 0x00D6},
+    {0x40, 0x2F, 0x0055, 0x00DC},
+    {0x40, 0x2F, 0x0057, 0x1E84},
+    {0x40, 0x2F, 0x0058, 0x1E8C},
+    {0x40, 0x2F, 0x0059, 0x0178},
+    {0x40, 0x2F, 0x0061, 0x00E4},
+    {0x40, 0x2F, 0x0065, 0x00EB},
+    {0x40, 0x2F, 0x0068, 0x1E27},
+    {0x40, 0x2F, 0x0069, 0x00EF},
+    {0x40, 0x2F, 0x006F, 0x00F6},
+    {0x40, 0x2F, 0x0074, 0x1E97},
+    {0x40, 0x2F, 0x0075, 0x00FC},
+    {0x40, 0x2F, 0x0077, 0x1E85},
+    {0x40, 0x2F, 0x0078, 0x1E8D},
+    {0x40, 0x2F, 0x0079, 0x00FF},
+    {0x40, 0x33, 0x004F, 0x0150},
+    {0x40, 0x33, 0x0055, 0x0170},
+    {0x40, 0x33, 0x006F, 0x0151},
+    {0x40, 0x33, 0x0075, 0x0171},
+    {0x40, 0x34, 0x0041, 0x00C2},
+    {0x40, 0x34, 0x0043, 0x0108},
+    {0x40, 0x34, 0x0045, 0x00CA},
+    {0x40, 0x34, 0x0047, 0x011C},
+    {0x40, 0x34, 0x0048, 0x0124},
+    {0x40, 0x34, 0x0049, 0x00CE},
+    {0x40, 0x34, 0x004A, 0x0134},
+    {0x40, 0x34, 0x004F, 0x00D4},
+    {0x40, 0x34, 0x0053, 0x015C},
+    {0x40, 0x34, 0x0055, 0x00DB},
+    {0x40, 0x34, 0x0057, 0x0174},
+    {0x40, 0x34, 0x0059, 0x0176},
+    {0x40, 0x34, 0x005A, 0x1E90},
+    {0x40, 0x34, 0x0061, 0x00E2},
+    {0x40, 0x34, 0x0063, 0x0109},
+    {0x40, 0x34, 0x0065, 0x00EA},
+    {0x40, 0x34, 0x0067, 0x011D},
+    {0x40, 0x34, 0x0068, 0x0125},
+    {0x40, 0x34, 0x0069, 0x00EE},
+    {0x40, 0x34, 0x006A, 0x0135},
+    {0x40, 0x34, 0x006F, 0x00F4},
+    {0x40, 0x34, 0x0073, 0x015D},
+    {0x40, 0x34, 0x0075, 0x00FB},
+    {0x40, 0x34, 0x0077, 0x0175},
+    {0x40, 0x34, 0x0079, 0x0177},
+    {0x40, 0x34, 0x007A, 0x1E91},
+    {0x42, 0x0D, 0x0041, 0x0226},
+    {0x42, 0x0D, 0x0042, 0x1E02},
+    {0x42, 0x0D, 0x0043, 0x010A},
+    {0x42, 0x0D, 0x0044, 0x1E0A},
+    {0x42, 0x0D, 0x0045, 0x0116},
+    {0x42, 0x0D, 0x0046, 0x1E1E},
+    {0x42, 0x0D, 0x0047, 0x0120},
+    {0x42, 0x0D, 0x0048, 0x1E22},
+    {0x42, 0x0D, 0x0049, 0x0130},
+    {0x42, 0x0D, 0x004D, 0x1E40},
+    {0x42, 0x0D, 0x004E, 0x1E44},
+    {0x42, 0x0D, 0x004F, 0x022E},
+    {0x42, 0x0D, 0x0050, 0x1E56},
+    {0x42, 0x0D, 0x0052, 0x1E58},
+    {0x42, 0x0D, 0x0053, 0x1E60},
+    {0x42, 0x0D, 0x0054, 0x1E6A},
+    {0x42, 0x0D, 0x0057, 0x1E86},
+    {0x42, 0x0D, 0x0058, 0x1E8A},
+    {0x42, 0x0D, 0x0059, 0x1E8E},
+    {0x42, 0x0D, 0x005A, 0x017B},
+    {0x42, 0x0D, 0x0061, 0x0227},
+    {0x42, 0x0D, 0x0062, 0x1E03},
+    {0x42, 0x0D, 0x0063, 0x010B},
+    {0x42, 0x0D, 0x0064, 0x1E0B},
+    {0x42, 0x0D, 0x0065, 0x0117},
+    {0x42, 0x0D, 0x0066, 0x1E1F},
+    {0x42, 0x0D, 0x0067, 0x0121},
+    {0x42, 0x0D, 0x0068, 0x1E23},
+    {0x42, 0x0D, 0x006D, 0x1E41},
+    {0x42, 0x0D, 0x006E, 0x1E45},
+    {0x42, 0x0D, 0x006F, 0x022F},
+    {0x42, 0x0D, 0x0070, 0x1E57},
+    {0x42, 0x0D, 0x0072, 0x1E59},
+    {0x42, 0x0D, 0x0073, 0x1E61},
+    {0x42, 0x0D, 0x0074, 0x1E6B},
+    {0x42, 0x0D, 0x0077, 0x1E87},
+    {0x42, 0x0D, 0x0078, 0x1E8B},
+    {0x42, 0x0D, 0x0079, 0x1E8F},
+    {0x42, 0x0D, 0x007A, 0x017C},
+    {0x42, 0x0D, 0x017F, 0x1E9B},
+    {0x42, 0x2E, 0x0041, 0x0104},
+    {0x42, 0x2E, 0x0045, 0x0118},
+    {0x42, 0x2E, 0x0049, 0x012E},
+    {0x42, 0x2E, 0x004F, 0x01EA},
+    {0x42, 0x2E, 0x0055, 0x0172},
+    {0x42, 0x2E, 0x0061, 0x0105},
+    {0x42, 0x2E, 0x0065, 0x0119},
+    {0x42, 0x2E, 0x0069, 0x012F},
+    {0x42, 0x2E, 0x006F, 0x01EB},
+    {0x42, 0x2E, 0x0075, 0x0173},
+    {0x42, 0x2F, 0x0041, 0x00C5},
+    {0x42, 0x2F, 0x0055, 0x016E},
+    {0x42, 0x2F, 0x0061, 0x00E5},
+    {0x42, 0x2F, 0x0075, 0x016F},
+    {0x42, 0x2F, 0x0077, 0x1E98},
+    {0x42, 0x2F, 0x0079, 0x1E99},
+    {0x42, 0x31, 0x0041, 0x0102},
+    {0x42, 0x31, 0x0045, 0x0114},
+    {0x42, 0x31, 0x0047, 0x011E},
+    {0x42, 0x31, 0x0049, 0x012C},
+    {0x42, 0x31, 0x004F, 0x014E},
+    {0x42, 0x31, 0x0055, 0x016C},
+    {0x42, 0x31, 0x0061, 0x0103},
+    {0x42, 0x31, 0x0065, 0x0115},
+    {0x42, 0x31, 0x0067, 0x011F},
+    {0x42, 0x31, 0x0069, 0x012D},
+    {0x42, 0x31, 0x006F, 0x014F},
+    {0x42, 0x31, 0x0075, 0x016D},
+    {0x42, 0x32, 0x0041, 0x0102},
+    {0x42, 0x32, 0x0045, 0x0114},
+    {0x42, 0x32, 0x0047, 0x011E},
+    {0x42, 0x32, 0x0049, 0x012C},
+    {0x42, 0x32, 0x004F, 0x014E},
+    {0x42, 0x32, 0x0055, 0x016C},
+    {0x42, 0x32, 0x0061, 0x0103},
+    {0x42, 0x32, 0x0065, 0x0115},
+    {0x42, 0x32, 0x0067, 0x011F},
+    {0x42, 0x32, 0x0069, 0x012D},
+    {0x42, 0x32, 0x006F, 0x014F},
+    {0x42, 0x32, 0x0075, 0x016D},
+    {0x42, 0x34, 0x0041, 0x01CD},
+    {0x42, 0x34, 0x0043, 0x010C},
+    {0x42, 0x34, 0x0044, 0x010E},
+    {0x42, 0x34, 0x0045, 0x011A},
+    {0x42, 0x34, 0x0047, 0x01E6},
+    {0x42, 0x34, 0x0048, 0x021E},
+    {0x42, 0x34, 0x0049, 0x01CF},
+    {0x42, 0x34, 0x004B, 0x01E8},
+    {0x42, 0x34, 0x004C, 0x013D},
+    {0x42, 0x34, 0x004E, 0x0147},
+    {0x42, 0x34, 0x004F, 0x01D1},
+    {0x42, 0x34, 0x0052, 0x0158},
+    {0x42, 0x34, 0x0053, 0x0160},
+    {0x42, 0x34, 0x0054, 0x0164},
+    {0x42, 0x34, 0x0055, 0x01D3},
+    {0x42, 0x34, 0x005A, 0x017D},
+    {0x42, 0x34, 0x0061, 0x01CE},
+    {0x42, 0x34, 0x0063, 0x010D},
+    {0x42, 0x34, 0x0064, 0x010F},
+    {0x42, 0x34, 0x0065, 0x011B},
+    {0x42, 0x34, 0x0067, 0x01E7},
+    {0x42, 0x34, 0x0068, 0x021F},
+    {0x42, 0x34, 0x0069, 0x01D0},
+    {0x42, 0x34, 0x006A, 0x01F0},
+    {0x42, 0x34, 0x006B, 0x01E9},
+    {0x42, 0x34, 0x006C, 0x013E},
+    {0x42, 0x34, 0x006E, 0x0148},
+    {0x42, 0x34, 0x006F, 0x01D2},
+    {0x42, 0x34, 0x0072, 0x0159},
+    {0x42, 0x34, 0x0073, 0x0161},
+    {0x42, 0x34, 0x0074, 0x0165},
+    {0x42, 0x34, 0x0075, 0x01D4},
+    {0x42, 0x34, 0x007A, 0x017E},
+    {0x42, 0x34, 0x00DC, 0x01D9},
+    {0x42, 0x34, 0x00FC, 0x01DA},
+};
+
+// Italian (IT), xkb "it"
+static const ReferenceKey reference_italian_it_keys[] = {
+    {0x00, 0x04, 0x0061, false},
+    {0x00, 0x05, 0x0062, false},
+    {0x00, 0x06, 0x0063, false},
+    {0x00, 0x07, 0x0064, false},
+    {0x00, 0x08, 0x0065, false},
+    {0x00, 0x09, 0x0066, false},
+    {0x00, 0x0A, 0x0067, false},
+    {0x00, 0x0B, 0x0068, false},
+    {0x00, 0x0C, 0x0069, false},
+    {0x00, 0x0D, 0x006A, false},
+    {0x00, 0x0E, 0x006B, false},
+    {0x00, 0x0F, 0x006C, false},
+    {0x00, 0x10, 0x006D, false},
+    {0x00, 0x11, 0x006E, false},
+    {0x00, 0x12, 0x006F, false},
+    {0x00, 0x13, 0x0070, false},
+    {0x00, 0x14, 0x0071, false},
+    {0x00, 0x15, 0x0072, false},
+    {0x00, 0x16, 0x0073, false},
+    {0x00, 0x17, 0x0074, false},
+    {0x00, 0x18, 0x0075, false},
+    {0x00, 0x19, 0x0076, false},
+    {0x00, 0x1A, 0x0077, false},
+    {0x00, 0x1B, 0x0078, false},
+    {0x00, 0x1C, 0x0079, false},
+    {0x00, 0x1D, 0x007A, false},
+    {0x00, 0x1E, 0x0031, false},
+    {0x00, 0x1F, 0x0032, false},
+    {0x00, 0x20, 0x0033, false},
+    {0x00, 0x21, 0x0034, false},
+    {0x00, 0x22, 0x0035, false},
+    {0x00, 0x23, 0x0036, false},
+    {0x00, 0x24, 0x0037, false},
+    {0x00, 0x25, 0x0038, false},
+    {0x00, 0x26, 0x0039, false},
+    {0x00, 0x27, 0x0030, false},
+    {0x00, 0x28, 0x000A, false},
+    {0x00, 0x2B, 0x0009, false},
+    {0x00, 0x2C, 0x0020, false},
+    {0x00, 0x2D, 0x0027, false},
+    {0x00, 0x2E, 0x00EC, false},
+    {0x00, 0x2F, 0x00E8, false},
+    {0x00, 0x30, 0x002B, false},
+    {0x00, 0x31, 0x00F9, false},
+    {0x00, 0x32, 0x00F9, false},
+    {0x00, 0x33, 0x00F2, false},
+    {0x00, 0x34, 0x00E0, false},
+    {0x00, 0x35, 0x005C, false},
+    {0x00, 0x36, 0x002C, false},
+    {0x00, 0x37, 0x002E, false},
+    {0x00, 0x38, 0x002D, false},
+    {0x00, 0x54, 0x002F, false},
+    {0x00, 0x64, 0x003C, false},
+    {0x02, 0x04, 0x0041, false},
+    {0x02, 0x05, 0x0042, false},
+    {0x02, 0x06, 0x0043, false},
+    {0x02, 0x07, 0x0044, false},
+    {0x02, 0x08, 0x0045, false},
+    {0x02, 0x09, 0x0046, false},
+    {0x02, 0x0A, 0x0047, false},
+    {0x02, 0x0B, 0x0048, false},
+    {0x02, 0x0C, 0x0049, false},
+    {0x02, 0x0D, 0x004A, false},
+    {0x02, 0x0E, 0x004B, false},
+    {0x02, 0x0F, 0x004C, false},
+    {0x02, 0x10, 0x004D, false},
+    {0x02, 0x11, 0x004E, false},
+    {0x02, 0x12, 0x004F, false},
+    {0x02, 0x13, 0x0050, false},
+    {0x02, 0x14, 0x0051, false},
+    {0x02, 0x15, 0x0052, false},
+    {0x02, 0x16, 0x0053, false},
+    {0x02, 0x17, 0x0054, false},
+    {0x02, 0x18, 0x0055, false},
+    {0x02, 0x19, 0x0056, false},
+    {0x02, 0x1A, 0x0057, false},
+    {0x02, 0x1B, 0x0058, false},
+    {0x02, 0x1C, 0x0059, false},
+    {0x02, 0x1D, 0x005A, false},
+    {0x02, 0x1E, 0x0021, false},
+    {0x02, 0x1F, 0x0022, false},
+    {0x02, 0x20, 0x00A3, false},
+    {0x02, 0x21, 0x0024, false},
+    {0x02, 0x22, 0x0025, false},
+    {0x02, 0x23, 0x0026, false},
+    {0x02, 0x24, 0x002F, false},
+    {0x02, 0x25, 0x0028, false},
+    {0x02, 0x26, 0x0029, false},
+    {0x02, 0x27, 0x003D, false},
+    {0x02, 0x28, 0x000A, false},
+    {0x02, 0x2C, 0x0020, false},
+    {0x02, 0x2D, 0x003F, false},
+    {0x02, 0x2E, 0x005E, false},
+    {0x02, 0x2F, 0x00E9, false},
+    {0x02, 0x30, 0x002A, false},
+    {0x02, 0x31, 0x00A7, false},
+    {0x02, 0x32, 0x00A7, false},
+    {0x02, 0x33, 0x00E7, false},
+    {0x02, 0x34, 0x00B0, false},
+    {0x02, 0x35, 0x007C, false},
+    {0x02, 0x36, 0x003B, false},
+    {0x02, 0x37, 0x003A, false},
+    {0x02, 0x38, 0x005F, false},
+    {0x02, 0x54, 0x002F, false},
+    {0x02, 0x64, 0x003E, false},
+    {0x40, 0x04, 0x00E6, false},
+    {0x40, 0x05, 0x201D, false},
+    {0x40, 0x06, 0x00A2, false},
+    {0x40, 0x07, 0x00F0, false},
+    {0x40, 0x08, 0x20AC, false},
+    {0x40, 0x09, 0x0111, false},
+    {0x40, 0x0A, 0x014B, false},
+    {0x40, 0x0B, 0x0127, false},
+    {0x40, 0x0C, 0x2192, false},
+    {0x40, 0x0E, 0x0138, false},
+    {0x40, 0x0F, 0x0142, false},
+    {0x40, 0x10, 0x00B5, false},
+    {0x40, 0x11, 0x00F1, false},
+    {0x40, 0x12, 0x00F8, false},
+    {0x40, 0x13, 0x00FE, false},
+    {0x40, 0x14, 0x0040, false},
+    {0x40, 0x15, 0x00B6, false},
+    {0x40, 0x16, 0x00DF, false},
+    {0x40, 0x17, 0x0167, false},
+    {0x40, 0x18, 0x2193, false},
+    {0x40, 0x19, 0x201C, false},
+    {0x40, 0x1A, 0x017F, false},
+    {0x40, 0x1B, 0x00BB, false},
+    {0x40, 0x1C, 0x2190, false},
+    {0x40, 0x1D, 0x00AB, false},
+    {0x40, 0x1E, 0x00B9, false},
+    {0x40, 0x1F, 0x00B2, false},
+    {0x40, 0x20, 0x00B3, false},
+    {0x40, 0x21, 0x00BC, false},
+    {0x40, 0x22, 0x00BD, false},
+    {0x40, 0x23, 0x00AC, false},
+    {0x40, 0x24, 0x007B, false},
+    {0x40, 0x25, 0x005B, false},
+    {0x40, 0x26, 0x005D, false},
+    {0x40, 0x27, 0x007D, false},
+    {0x40, 0x28, 0x000A, false},
+    {0x40, 0x2B, 0x0009, false},
+    {0x40, 0x2C, 0x0020, false},
+    {0x40, 0x2D, 0x0060, false},
+    {0x40, 0x2E, 0x007E, false},
+    {0x40, 0x2F, 0x005B, false},
+    {0x40, 0x30, 0x005D, false},
+    {0x40, 0x31, 0x0060, true},
+    {0x40, 0x32, 0x0060, true},
+    {0x40, 0x33, 0x0040, false},
+    {0x40, 0x34, 0x0023, false},
+    {0x40, 0x35, 0x00AC, false},
+    {0x40, 0x36, 0x00B4, true},
+    {0x40, 0x37, 0x00B7, false},
+    {0x40, 0x38, 0x00AF, true},
+    {0x40, 0x54, 0x002F, false},
+    {0x40, 0x64, 0x00AB, false},
+    {0x42, 0x04, 0x00C6, false},
+    {0x42, 0x05, 0x2019, false},
+    {0x42, 0x06, 0x00A9, false},
+    {0x42, 0x07, 0x00D0, false},
+    {0x42, 0x08, 0x00A2, false},
+    {0x42, 0x09, 0x00AA, false},
+    {0x42, 0x0A, 0x014A, false},
+    {0x42, 0x0B, 0x0126, false},
+    {0x42, 0x0C, 0x0131, false},
+    {0x42, 0x0E, 0x0026, false},
+    {0x42, 0x0F, 0x0141, false},
+    {0x42, 0x10, 0x00BA, false},
+    {0x42, 0x11, 0x00D1, false},
+    {0x42, 0x12, 0x00D8, false},
+    {0x42, 0x13, 0x00DE, false},
+    {0x42, 0x14, 0x03A9, false},
+    {0x42, 0x15, 0x00AE, false},
+    {0x42, 0x16, 0x1E9E, false},
+    {0x42, 0x17, 0x0166, false},
+    {0x42, 0x18, 0x2191, false},
+    {0x42, 0x19, 0x2018, false},
+    {0x42, 0x1A, 0x00A7, false},
+    {0x42, 0x1B, 0x003E, false},
+    {0x42, 0x1C, 0x00A5, false},
+    {0x42, 0x1D, 0x003C, false},
+    {0x42, 0x1E, 0x00A1, false},
+    {0x42, 0x1F, 0x02DD, true},
+    {0x42, 0x20, 0x007E, true},
+    {0x42, 0x21, 0x215B, false},
+    {0x42, 0x22, 0x215C, false},
+    {0x42, 0x23, 0x215D, false},
+    {0x42, 0x24, 0x215E, false},
+    {0x42, 0x25, 0x2122, false},
+    {0x42, 0x26, 0x00B1, false},
+    {0x42, 0x27, 0x02DB, true},
+    {0x42, 0x28, 0x000A, false},
+    {0x42, 0x2C, 0x0020, false},
+    {0x42, 0x2D, 0x00BF, false},
+    {0x42, 0x2E, 0x005E, true},
+    {0x42, 0x2F, 0x007B, false},
+    {0x42, 0x30, 0x007D, false},
+    {0x42, 0x31, 0x02D8, true},
+    {0x42, 0x32, 0x02D8, true},
+    {0x42, 0x33, 0x00B8, true},
+    {0x42, 0x34, 0x02DA, true},
+    {0x42, 0x35, 0x00A6, false},
+    {0x42, 0x36, 0x00D7, false},
+    {0x42, 0x37, 0x00A8, true},
+    {0x42, 0x38, 0x00F7, false},
+    {0x42, 0x54, 0x002F, false},
+    {0x42, 0x64, 0x00BB, false},
+};
+static const ReferenceCompose reference_italian_it_composed[] = {
+    {0x40, 0x31, 0x0041, 0x00C0},
+    {0x40, 0x31, 0x0045, 0x00C8},
+    {0x40, 0x31, 0x0049, 0x00CC},
+    {0x40, 0x31, 0x004E, 0x01F8},
+    {0x40, 0x31, 0x004F, 0x00D2},
+    {0x40, 0x31, 0x0055, 0x00D9},
+    {0x40, 0x31, 0x0057, 0x1E80},
+    {0x40, 0x31, 0x0059, 0x1EF2},
+    {0x40, 0x31, 0x0061, 0x00E0},
+    {0x40, 0x31, 0x0065, 0x00E8},
+    {0x40, 0x31, 0x0069, 0x00EC},
+    {0x40, 0x31, 0x006E, 0x01F9},
+    {0x40, 0x31, 0x006F, 0x00F2},
+    {0x40, 0x31, 0x0075, 0x00F9},
+    {0x40, 0x31, 0x0077, 0x1E81},
+    {0x40, 0x31, 0x0079, 0x1EF3},
+    {0x40, 0x31, 0x03A9, 0x1FFA},
+    {0x40, 0x32, 0x0041, 0x00C0},
+    {0x40, 0x32, 0x0045, 0x00C8},
+    {0x40, 0x32, 0x0049, 0x00CC},
+    {0x40, 0x32, 0x004E, 0x01F8},
+    {0x40, 0x32, 0x004F, 0x00D2},
+    {0x40, 0x32, 0x0055, 0x00D9},
+    {0x40, 0x32, 0x0057, 0x1E80},
+    {0x40, 0x32, 0x0059, 0x1EF2},
+    {0x40, 0x32, 0x0061, 0x00E0},
+    {0x40, 0x32, 0x0065, 0x00E8},
+    {0x40, 0x32, 0x0069, 0x00EC},
+    {0x40, 0x32, 0x006E, 0x01F9},
+    {0x40, 0x32, 0x006F, 0x00F2},
+    {0x40, 0x32, 0x0075, 0x00F9},
+    {0x40, 0x32, 0x0077, 0x1E81},
+    {0x40, 0x32, 0x0079, 0x1EF3},
+    {0x40, 0x32, 0x03A9, 0x1FFA},
+    {0x40, 0x36, 0x0041, 0x00C1},
+    {0x40, 0x36, 0x0043, 0x0106},
+    {0x40, 0x36, 0x0045, 0x00C9},
+    {0x40, 0x36, 0x0047, 0x01F4},
+    {0x40, 0x36, 0x0049, 0x00CD},
+    {0x40, 0x36, 0x004B, 0x1E30},
+    {0x40, 0x36, 0x004C, 0x0139},
+    {0x40, 0x36, 0x004D, 0x1E3E},
+    {0x40, 0x36, 0x004E, 0x0143},
+    {0x40, 0x36, 0x004F, 0x00D3},
+    {0x40, 0x36, 0x0050, 0x1E54},
+    {0x40, 0x36, 0x0052, 0x0154},
+    {0x40, 0x36, 0x0053, 0x015A},
+    {0x40, 0x36, 0x0055, 0x00DA},
+    {0x40, 0x36, 0x0057, 0x1E82},
+    {0x40, 0x36, 0x0059, 0x00DD},
+    {0x40, 0x36, 0x005A, 0x0179},
+    {0x40, 0x36, 0x0061, 0x00E1},
+    {0x40, 0x36, 0x0063, 0x0107},
+    {0x40, 0x36, 0x0065, 0x00E9},
+    {0x40, 0x36, 0x0067, 0x01F5},
+    {0x40, 0x36, 0x0069, 0x00ED},
+    {0x40, 0x36, 0x006B, 0x1E31},
+    {0x40, 0x36, 0x006C, 0x013A},
+    {0x40, 0x36, 0x006D, 0x1E3F},
+    {0x40, 0x36, 0x006E, 0x0144},
+    {0x40, 0x36, 0x006F, 0x00F3},
+    {0x40, 0x36, 0x0070, 0x1E55},
+    {0x40, 0x36, 0x0072, 0x0155},
+    {0x40, 0x36, 0x0073, 0x015B},
+    {0x40, 0x36, 0x0075, 0x00FA},
+    {0x40, 0x36, 0x0077, 0x1E83},
+    {0x40, 0x36, 0x0079, 0x00FD},
+    {0x40, 0x36, 0x007A, 0x017A},
+    {0x40, 0x36, 0x00C6, 0x01FC},
+    {0x40, 0x36, 0x00D8, 0x01FE},
+    {0x40, 0x36, 0x00E6, 0x01FD},
+    {0x40, 0x36, 0x00E7, 0x1E09},
+    {0x40, 0x36, 0x00F8, 0x01FF},
+    {0x40, 0x36, 0x03A9, 0x038F},
+    {0x40, 0x38, 0x0041, 0x0100},
+    {0x40, 0x38, 0x0045, 0x0112},
+    {0x40, 0x38, 0x0047, 0x1E20},
+    {0x40, 0x38, 0x0049, 0x012A},
+    {0x40, 0x38, 0x004F, 0x014C},
+    {0x40, 0x38, 0x0055, 0x016A},
+    {0x40, 0x38, 0x0059, 0x0232},
+    {0x40, 0x38, 0x0061, 0x0101},
+    {0x40, 0x38, 0x0065, 0x0113},
+    {0x40, 0x38, 0x0067, 0x1E21},
+    {0x40, 0x38, 0x0069, 0x012B},
+    {0x40, 0x38, 0x006F, 0x014D},
+    {0x40, 0x38, 0x0075, 0x016B},
+    {0x40, 0x38, 0x0079, 0x0233},
+    {0x40, 0x38, 0x00C6, 0x01E2},
+    {0x40, 0x38, 0x00E6, 0x01E3},
+    {0x42, 0x1F, 0x004F, 0x0150},
+    {0x42, 0x1F, 0x0055, 0x0170},
+    {0x42, 0x1F, 0x006F, 0x0151},
+    {0x42, 0x1F, 0x0075, 0x0171},
+    {0x42, 0x20, 0x0041, 0x00C3},
+    {0x42, 0x20, 0x0045, 0x1EBC},
+    {0x42, 0x20, 0x0049, 0x0128},
+    {0x42, 0x20, 0x004E, 0x00D1},
+    {0x42, 0x20, 0x004F, 0x00D5},
+    {0x42, 0x20, 0x0055, 0x0168},
+    {0x42, 0x20, 0x0056, 0x1E7C},
+    {0x42, 0x20, 0x0059, 0x1EF8},
+    {0x42, 0x20, 0x0061, 0x00E3},
+    {0x42, 0x20, 0x0065, 0x1EBD},
+    {0x42, 0x20, 0x0069, 0x0129},
+    {0x42, 0x20, 0x006E, 0x00F1},
+    {0x42, 0x20, 0x006F, 0x00F5},
+    {0x42, 0x20, 0x0075, 0x0169},
+    {0x42, 0x20, 0x0076, 0x1E7D},
+    {0x42, 0x20, 0x0079, 0x1EF9},
+    {0x42, 0x27, 0x0041, 0x0104},
+    {0x42, 0x27, 0x0045, 0x0118},
+    {0x42, 0x27, 0x0049, 0x012E},
+    {0x42, 0x27, 0x004F, 0x01EA},
+    {0x42, 0x27, 0x0055, 0x0172},
+    {0x42, 0x27, 0x0061, 0x0105},
+    {0x42, 0x27, 0x0065, 0x0119},
+    {0x42, 0x27, 0x0069, 0x012F},
+    {0x42, 0x27, 0x006F, 0x01EB},
+    {0x42, 0x27, 0x0075, 0x0173},
+    {0x42, 0x2E, 0x0041, 0x00C2},
+    {0x42, 0x2E, 0x0043, 0x0108},
+    {0x42, 0x2E, 0x0045, 0x00CA},
+    {0x42, 0x2E, 0x0047, 0x011C},
+    {0x42, 0x2E, 0x0048, 0x0124},
+    {0x42, 0x2E, 0x0049, 0x00CE},
+    {0x42, 0x2E, 0x004A, 0x0134},
+    {0x42, 0x2E, 0x004F, 0x00D4},
+    {0x42, 0x2E, 0x0053, 0x015C},
+    {0x42, 0x2E, 0x0055, 0x00DB},
+    {0x42, 0x2E, 0x0057, 0x0174},
+    {0x42, 0x2E, 0x0059, 0x0176},
+    {0x42, 0x2E, 0x005A, 0x1E90},
+    {0x42, 0x2E, 0x0061, 0x00E2},
+    {0x42, 0x2E, 0x0063, 0x0109},
+    {0x42, 0x2E, 0x0065, 0x00EA},
+    {0x42, 0x2E, 0x0067, 0x011D},
+    {0x42, 0x2E, 0x0068, 0x0125},
+    {0x42, 0x2E, 0x0069, 0x00EE},
+    {0x42, 0x2E, 0x006A, 0x0135},
+    {0x42, 0x2E, 0x006F, 0x00F4},
+    {0x42, 0x2E, 0x0073, 0x015D},
+    {0x42, 0x2E, 0x0075, 0x00FB},
+    {0x42, 0x2E, 0x0077, 0x0175},
+    {0x42, 0x2E, 0x0079, 0x0177},
+    {0x42, 0x2E, 0x007A, 0x1E91},
+    {0x42, 0x31, 0x0041, 0x0102},
+    {0x42, 0x31, 0x0045, 0x0114},
+    {0x42, 0x31, 0x0047, 0x011E},
+    {0x42, 0x31, 0x0049, 0x012C},
+    {0x42, 0x31, 0x004F, 0x014E},
+    {0x42, 0x31, 0x0055, 0x016C},
+    {0x42, 0x31, 0x0061, 0x0103},
+    {0x42, 0x31, 0x0065, 0x0115},
+    {0x42, 0x31, 0x0067, 0x011F},
+    {0x42, 0x31, 0x0069, 0x012D},
+    {0x42, 0x31, 0x006F, 0x014F},
+    {0x42, 0x31, 0x0075, 0x016D},
+    {0x42, 0x32, 0x0041, 0x0102},
+    {0x42, 0x32, 0x0045, 0x0114},
+    {0x42, 0x32, 0x0047, 0x011E},
+    {0x42, 0x32, 0x0049, 0x012C},
+    {0x42, 0x32, 0x004F, 0x014E},
+    {0x42, 0x32, 0x0055, 0x016C},
+    {0x42, 0x32, 0x0061, 0x0103},
+    {0x42, 0x32, 0x0065, 0x0115},
+    {0x42, 0x32, 0x0067, 0x011F},
+    {0x42, 0x32, 0x0069, 0x012D},
+    {0x42, 0x32, 0x006F, 0x014F},
+    {0x42, 0x32, 0x0075, 0x016D},
+    {0x42, 0x33, 0x0043, 0x00C7},
+    {0x42, 0x33, 0x0044, 0x1E10},
+    {0x42, 0x33, 0x0045, 0x0228},
+    {0x42, 0x33, 0x0047, 0x0122},
+    {0x42, 0x33, 0x0048, 0x1E28},
+    {0x42, 0x33, 0x004B, 0x0136},
+    {0x42, 0x33, 0x004C, 0x013B},
+    {0x42, 0x33, 0x004E, 0x0145},
+    {0x42, 0x33, 0x0052, 0x0156},
+    {0x42, 0x33, 0x0053, 0x015E},
+    {0x42, 0x33, 0x0054, 0x0162},
+    {0x42, 0x33, 0x0063, 0x00E7},
+    {0x42, 0x33, 0x0064, 0x1E11},
+    {0x42, 0x33, 0x0065, 0x0229},
+    {0x42, 0x33, 0x0067, 0x0123},
+    {0x42, 0x33, 0x0068, 0x1E29},
+    {0x42, 0x33, 0x006B, 0x0137},
+    {0x42, 0x33, 0x006C, 0x013C},
+    {0x42, 0x33, 0x006E, 0x0146},
+    {0x42, 0x33, 0x0072, 0x0157},
+    {0x42, 0x33, 0x0073, 0x015F},
+    {0x42, 0x33, 0x0074, 0x0163},
+    {0x42, 0x34, 0x0041, 0x00C5},
+    {0x42, 0x34, 0x0055, 0x016E},
+    {0x42, 0x34, 0x0061, 0x00E5},
+    {0x42, 0x34, 0x0075, 0x016F},
+    {0x42, 0x34, 0x0077, 0x1E98},
+    {0x42, 0x34, 0x0079, 0x1E99},
+    {0x42, 0x37, 0x0041, 0x00C4},
+    {0x42, 0x37, 0x0045, 0x00CB},
+    {0x42, 0x37, 0x0048, 0x1E26},
+    {0x42, 0x37, 0x0049, 0x00CF},
+    {0x42, 0x37, 0x004F, 0x00D6},
+    {0x42, 0x37, 0x0055, 0x00DC},
+    {0x42, 0x37, 0x0057, 0x1E84},
+    {0x42, 0x37, 0x0058, 0x1E8C},
+    {0x42, 0x37, 0x0059, 0x0178},
+    {0x42, 0x37, 0x0061, 0x00E4},
+    {0x42, 0x37, 0x0065, 0x00EB},
+    {0x42, 0x37, 0x0068, 0x1E27},
+    {0x42, 0x37, 0x0069, 0x00EF},
+    {0x42, 0x37, 0x006F, 0x00F6},
+    {0x42, 0x37, 0x0074, 0x1E97},
+    {0x42, 0x37, 0x0075, 0x00FC},
+    {0x42, 0x37, 0x0077, 0x1E85},
+    {0x42, 0x37, 0x0078, 0x1E8D},
+    {0x42, 0x37, 0x0079, 0x00FF},
+};
+
+// Spanish (ES), xkb "es"
+static const ReferenceKey reference_spanish_es_keys[] = {
+    {0x00, 0x04, 0x0061, false},
+    {0x00, 0x05, 0x0062, false},
+    {0x00, 0x06, 0x0063, false},
+    {0x00, 0x07, 0x0064, false},
+    {0x00, 0x08, 0x0065, false},
+    {0x00, 0x09, 0x0066, false},
+    {0x00, 0x0A, 0x0067, false},
+    {0x00, 0x0B, 0x0068, false},
+    {0x00, 0x0C, 0x0069, false},
+    {0x00, 0x0D, 0x006A, false},
+    {0x00, 0x0E, 0x006B, false},
+    {0x00, 0x0F, 0x006C, false},
+    {0x00, 0x10, 0x006D, false},
+    {0x00, 0x11, 0x006E, false},
+    {0x00, 0x12, 0x006F, false},
+    {0x00, 0x13, 0x0070, false},
+    {0x00, 0x14, 0x0071, false},
+    {0x00, 0x15, 0x0072, false},
+    {0x00, 0x16, 0x0073, false},
+    {0x00, 0x17, 0x0074, false},
+    {0x00, 0x18, 0x0075, false},
+    {0x00, 0x19, 0x0076, false},
+    {0x00, 0x1A, 0x0077, false},
+    {0x00, 0x1B, 0x0078, false},
+    {0x00, 0x1C, 0x0079, false},
+    {0x00, 0x1D, 0x007A, false},
+    {0x00, 0x1E, 0x0031, false},
+    {0x00, 0x1F, 0x0032, false},
+    {0x00, 0x20, 0x0033, false},
+    {0x00, 0x21, 0x0034, false},
+    {0x00, 0x22, 0x0035, false},
+    {0x00, 0x23, 0x0036, false},
+    {0x00, 0x24, 0x0037, false},
+    {0x00, 0x25, 0x0038, false},
+    {0x00, 0x26, 0x0039, false},
+    {0x00, 0x27, 0x0030, false},
+    {0x00, 0x28, 0x000A, false},
+    {0x00, 0x2B, 0x0009, false},
+    {0x00, 0x2C, 0x0020, false},
+    {0x00, 0x2D, 0x0027, false},
+    {0x00, 0x2E, 0x00A1, false},
+    {0x00, 0x2F, 0x0060, true},
+    {0x00, 0x30, 0x002B, false},
+    {0x00, 0x31, 0x00E7, false},
+    {0x00, 0x32, 0x00E7, false},
+    {0x00, 0x33, 0x00F1, false},
+    {0x00, 0x34, 0x00B4, true},
+    {0x00, 0x35, 0x00BA, false},
+    {0x00, 0x36, 0x002C, false},
+    {0x00, 0x37, 0x002E, false},
+    {0x00, 0x38, 0x002D, false},
+    {0x00, 0x54, 0x002F, false},
+    {0x00, 0x64, 0x003C, false},
+    {0x02, 0x04, 0x0041, false},
+    {0x02, 0x05, 0x0042, false},
+    {0x02, 0x06, 0x0043, false},
+    {0x02, 0x07, 0x0044, false},
+    {0x02, 0x08, 0x0045, false},
+    {0x02, 0x09, 0x0046, false},
+    {0x02, 0x0A, 0x0047, false},
+    {0x02, 0x0B, 0x0048, false},
+    {0x02, 0x0C, 0x0049, false},
+    {0x02, 0x0D, 0x004A, false},
+    {0x02, 0x0E, 0x004B, false},
+    {0x02, 0x0F, 0x004C, false},
+    {0x02, 0x10, 0x004D, false},
+    {0x02, 0x11, 0x004E, false},
+    {0x02, 0x12, 0x004F, false},
+    {0x02, 0x13, 0x0050, false},
+    {0x02, 0x14, 0x0051, false},
+    {0x02, 0x15, 0x0052, false},
+    {0x02, 0x16, 0x0053, false},
+    {0x02, 0x17, 0x0054, false},
+    {0x02, 0x18, 0x0055, false},
+    {0x02, 0x19, 0x0056, false},
+    {0x02, 0x1A, 0x0057, false},
+    {0x02, 0x1B, 0x0058, false},
+    {0x02, 0x1C, 0x0059, false},
+    {0x02, 0x1D, 0x005A, false},
+    {0x02, 0x1E, 0x0021, false},
+    {0x02, 0x1F, 0x0022, false},
+    {0x02, 0x20, 0x00B7, false},
+    {0x02, 0x21, 0x0024, false},
+    {0x02, 0x22, 0x0025, false},
+    {0x02, 0x23, 0x0026, false},
+    {0x02, 0x24, 0x002F, false},
+    {0x02, 0x25, 0x0028, false},
+    {0x02, 0x26, 0x0029, false},
+    {0x02, 0x27, 0x003D, false},
+    {0x02, 0x28, 0x000A, false},
+    {0x02, 0x2C, 0x0020, false},
+    {0x02, 0x2D, 0x003F, false},
+    {0x02, 0x2E, 0x00BF, false},
+    {0x02, 0x2F, 0x005E, true},
+    {0x02, 0x30, 0x002A, false},
+    {0x02, 0x31, 0x00C7, false},
+    {0x02, 0x32, 0x00C7, false},
+    {0x02, 0x33, 0x00D1, false},
+    {0x02, 0x34, 0x00A8, true},
+    {0x02, 0x35, 0x00AA, false},
+    {0x02, 0x36, 0x003B, false},
+    {0x02, 0x37, 0x003A, false},
+    {0x02, 0x38, 0x005F, false},
+    {0x02, 0x54, 0x002F, false},
+    {0x02, 0x64, 0x003E, false},
+    {0x40, 0x04, 0x00E6, false},
+    {0x40, 0x05, 0x201C, false},
+    {0x40, 0x06, 0x00A2, false},
+    {0x40, 0x07, 0x00F0, false},
+    {0x40, 0x08, 0x20AC, false},
+    {0x40, 0x09, 0x0111, false},
+    {0x40, 0x0A, 0x014B, false},
+    {0x40, 0x0B, 0x0127, false},
+    {0x40, 0x0C, 0x2192, false},
+    {0x40, 0x0E, 0x0138, false},
+    {0x40, 0x0F, 0x0142, false},
+    {0x40, 0x10, 0x00B5, false},
+    {0x40, 0x11, 0x201D, false},
+    {0x40, 0x12, 0x00F8, false},
+    {0x40, 0x13, 0x00FE, false},
+    {0x40, 0x14, 0x0040, false},
+    {0x40, 0x15, 0x00B6, false},
+    {0x40, 0x16, 0x00DF, false},
+    {0x40, 0x17, 0x0167, false},
+    {0x40, 0x18, 0x2193, false},
+    {0x40, 0x19, 0x201E, false},
+    {0x40, 0x1A, 0x017F, false},
+    {0x40, 0x1B, 0x00BB, false},
+    {0x40, 0x1C, 0x2190, false},
+    {0x40, 0x1D, 0x00AB, false},
+    {0x40, 0x1E, 0x007C, false},
+    {0x40, 0x1F, 0x0040, false},
+    {0x40, 0x20, 0x0023, false},
+    {0x40, 0x21, 0x007E, true},
+    {0x40, 0x22, 0x00BD, false},
+    {0x40, 0x23, 0x00AC, false},
+    {0x40, 0x24, 0x007B, false},
+    {0x40, 0x25, 0x005B, false},
+    {0x40, 0x26, 0x005D, false},
+    {0x40, 0x27, 0x007D, false},
+    {0x40, 0x28, 0x000A, false},
+    {0x40, 0x2B, 0x0009, false},
+    {0x40, 0x2C, 0x0020, false},
+    {0x40, 0x2D, 0x005C, false},
+    {0x40, 0x2E, 0x00B8, true},
+    {0x40, 0x2F, 0x005B, false},
+    {0x40, 0x30, 0x005D, false},
+    {0x40, 0x31, 0x007D, false},
+    {0x40, 0x32, 0x007D, false},
+    {0x40, 0x33, 0x007E, true},
+    {0x40, 0x34, 0x007B, false},
+    {0x40, 0x35, 0x005C, false},
+    {0x40, 0x36, 0x2022, false},
+    {0x40, 0x37, 0x00B7, false},
+    {0x40, 0x54, 0x002F, false},
+    {0x40, 0x64, 0x007C, false},
+    {0x42, 0x04, 0x00C6, false},
+    {0x42, 0x05, 0x2018, false},
+    {0x42, 0x06, 0x00A9, false},
+    {0x42, 0x07, 0x00D0, false},
+    {0x42, 0x08, 0x00A2, false},
+    {0x42, 0x09, 0x00AA, false},
+    {0x42, 0x0A, 0x014A, false},
+    {0x42, 0x0B, 0x0126, false},
+    {0x42, 0x0C, 0x0131, false},
+    {0x42, 0x0E, 0x0026, false},
+    {0x42, 0x0F, 0x0141, false},
+    {0x42, 0x10, 0x00BA, false},
+    {0x42, 0x11, 0x2019, false},
+    {0x42, 0x12, 0x00D8, false},
+    {0x42, 0x13, 0x00DE, false},
+    {0x42, 0x14, 0x03A9, false},
+    {0x42, 0x15, 0x00AE, false},
+    {0x42, 0x16, 0x1E9E, false},
+    {0x42, 0x17, 0x0166, false},
+    {0x42, 0x18, 0x2191, false},
+    {0x42, 0x19, 0x201A, false},
+    {0x42, 0x1A, 0x00A7, false},
+    {0x42, 0x1B, 0x003E, false},
+    {0x42, 0x1C, 0x00A5, false},
+    {0x42, 0x1D, 0x003C, false},
+    {0x42, 0x1E, 0x00A1, false},
+    {0x42, 0x1F, 0x215B, false},
+    {0x42, 0x20, 0x00A3, false},
+    {0x42, 0x21, 0x0024, false},
+    {0x42, 0x22, 0x215C, false},
+    {0x42, 0x23, 0x215D, false},
+    {0x42, 0x24, 0x215E, false},
+    {0x42, 0x25, 0x2122, false},
+    {0x42, 0x26, 0x00B1, false},
+    {0x42, 0x27, 0x00B0, false},
+    {0x42, 0x28, 0x000A, false},
+    {0x42, 0x2C, 0x0020, false},
+    {0x42, 0x2D, 0x00BF, false},
+    {0x42, 0x2E, 0x02DB, true},
+    {0x42, 0x2F, 0x02DA, true},
+    {0x42, 0x30, 0x00AF, true},
+    {0x42, 0x31, 0x02D8, true},
+    {0x42, 0x32, 0x02D8, true},
+    {0x42, 0x33, 0x02DD, true},
+    {0x42, 0x34, 0x02C7, true},
+    {0x42, 0x35, 0x005C, false},
+    {0x42, 0x36, 0x00D7, false},
+    {0x42, 0x37, 0x00F7, false},
+    {0x42, 0x38, 0x02D9, true},
+    {0x42, 0x54, 0x002F, false},
+    {0x42, 0x64, 0x00A6, false},
+};
+static const ReferenceCompose reference_spanish_es_composed[] = {
+    {0x00, 0x2F, 0x0041, 0x00C0},
+    {0x00, 0x2F, 0x0045, 0x00C8},
+    {0x00, 0x2F, 0x0049, 0x00CC},
+    {0x00, 0x2F, 0x004E, 0x01F8},
+    {0x00, 0x2F, 0x004F, 0x00D2},
+    {0x00, 0x2F, 0x0055, 0x00D9},
+    {0x00, 0x2F, 0x0057, 0x1E80},
+    {0x00, 0x2F, 0x0059, 0x1EF2},
+    {0x00, 0x2F, 0x0061, 0x00E0},
+    {0x00, 0x2F, 0x0065, 0x00E8},
+    {0x00, 0x2F, 0x0069, 0x00EC},
+    {0x00, 0x2F, 0x006E, 0x01F9},
+    {0x00, 0x2F, 0x006F, 0x00F2},
+    {0x00, 0x2F, 0x0075, 0x00F9},
+    {0x00, 0x2F, 0x0077, 0x1E81},
+    {0x00, 0x2F, 0x0079, 0x1EF3},
+    {0x00, 0x2F, 0x03A9, 0x1FFA},
+    {0x00, 0x34, 0x0041, 0x00C1},
+    {0x00, 0x34, 0x0043, 0x0106},
+    {0x00, 0x34, 0x0045, 0x00C9},
+    {0x00, 0x34, 0x0047, 0x01F4},
+    {0x00, 0x34, 0x0049, 0x00CD},
+    {0x00, 0x34, 0x004B, 0x1E30},
+    {0x00, 0x34, 0x004C, 0x0139},
+    {0x00, 0x34, 0x004D, 0x1E3E},
+    {0x00, 0x34, 0x004E, 0x0143},
+    {0x00, 0x34, 0x004F, 0x00D3},
+    {0x00, 0x34, 0x0050, 0x1E54},
+    {0x00, 0x34, 0x0052, 0x0154},
+    {0x00, 0x34, 0x0053, 0x015A},
+    {0x00, 0x34, 0x0055, 0x00DA},
+    {0x00, 0x34, 0x0057, 0x1E82},
+    {0x00, 0x34, 0x0059, 0x00DD},
+    {0x00, 0x34, 0x005A, 0x0179},
+    {0x00, 0x34, 0x0061, 0x00E1},
+    {0x00, 0x34, 0x0063, 0x0107},
+    {0x00, 0x34, 0x0065, 0x00E9},
+    {0x00, 0x34, 0x0067, 0x01F5},
+    {0x00, 0x34, 0x0069, 0x00ED},
+    {0x00, 0x34, 0x006B, 0x1E31},
+    {0x00, 0x34, 0x006C, 0x013A},
+    {0x00, 0x34, 0x006D, 0x1E3F},
+    {0x00, 0x34, 0x006E, 0x0144},
+    {0x00, 0x34, 0x006F, 0x00F3},
+    {0x00, 0x34, 0x0070, 0x1E55},
+    {0x00, 0x34, 0x0072, 0x0155},
+    {0x00, 0x34, 0x0073, 0x015B},
+    {0x00, 0x34, 0x0075, 0x00FA},
+    {0x00, 0x34, 0x0077, 0x1E83},
+    {0x00, 0x34, 0x0079, 0x00FD},
+    {0x00, 0x34, 0x007A, 0x017A},
+    {0x00, 0x34, 0x00C6, 0x01FC},
+    {0x00, 0x34, 0x00C7, 0x1E08},
+    {0x00, 0x34, 0x00D8, 0x01FE},
+    {0x00, 0x34, 0x00E6, 0x01FD},
+    {0x00, 0x34, 0x00E7, 0x1E09},
+    {0x00, 0x34, 0x00F8, 0x01FF},
+    {0x00, 0x34, 0x03A9, 0x038F},
+    {0x02, 0x2F, 0x0041, 0x00C2},
+    {0x02, 0x2F, 0x0043, 0x0108},
+    {0x02, 0x2F, 0x0045, 0x00CA},
+    {0x02, 0x2F, 0x0047, 0x011C},
+    {0x02, 0x2F, 0x0048, 0x0124},
+    {0x02, 0x2F, 0x0049, 0x00CE},
+    {0x02, 0x2F, 0x004A, 0x0134},
+    {0x02, 0x2F, 0x004F, 0x00D4},
+    {0x02, 0x2F, 0x0053, 0x015C},
+    {0x02, 0x2F, 0x0055, 0x00DB},
+    {0x02, 0x2F, 0x0057, 0x0174},
+    {0x02, 0x2F, 0x0059, 0x0176},
+    {0x02, 0x2F, 0x005A, 0x1E90},
+    {0x02, 0x2F, 0x0061, 0x00E2},
+    {0x02, 0x2F, 0x0063, 0x0109},
+    {0x02, 0x2F, 0x0065, 0x00EA},
+    {0x02, 0x2F, 0x0067, 0x011D},
+    {0x02, 0x2F, 0x0068, 0x0125},
+    {0x02, 0x2F, 0x0069, 0x00EE},
+    {0x02, 0x2F, 0x006A, 0x0135},
+    {0x02, 0x2F, 0x006F, 0x00F4},
+    {0x02, 0x2F, 0x0073, 0x015D},
+    {0x02, 0x2F, 0x0075, 0x00FB},
+    {0x02, 0x2F, 0x0077, 0x0175},
+    {0x02, 0x2F, 0x0079, 0x0177},
+    {0x02, 0x2F, 0x007A, 0x1E91},
+    {0x02, 0x34, 0x0041, 0x00C4},
+    {0x02, 0x34, 0x0045, 0x00CB},
+    {0x02, 0x34, 0x0048, 0x1E26},
+    {0x02, 0x34, 0x0049, 0x00CF},
+    {0x02, 0x34, 0x004F, 0x00D6},
+    {0x02, 0x34, 0x0055, 0x00DC},
+    {0x02, 0x34, 0x0057, 0x1E84},
+    {0x02, 0x34, 0x0058, 0x1E8C},
+    {0x02, 0x34, 0x0059, 0x0178},
+    {0x02, 0x34, 0x0061, 0x00E4},
+    {0x02, 0x34, 0x0065, 0x00EB},
+    {0x02, 0x34, 0x0068, 0x1E27},
+    {0x02, 0x34, 0x0069, 0x00EF},
+    {0x02, 0x34, 0x006F, 0x00F6},
+    {0x02, 0x34, 0x0074, 0x1E97},
+    {0x02, 0x34, 0x0075, 0x00FC},
+    {0x02, 0x34, 0x0077, 0x1E85},
+    {0x02, 0x34, 0x0078, 0x1E8D},
+    {0x02, 0x34, 0x0079, 0x00FF},
+    {0x40, 0x21, 0x0041, 0x00C3},
+    {0x40, 0x21, 0x0045, 0x1EBC},
+    {0x40, 0x21, 0x0049, 0x0128},
+    {0x40, 0x21, 0x004E, 0x00D1},
+    {0x40, 0x21, 0x004F, 0x00D5},
+    {0x40, 0x21, 0x0055, 0x0168},
+    {0x40, 0x21, 0x0056, 0x1E7C},
+    {0x40, 0x21, 0x0059, 0x1EF8},
+    {0x40, 0x21, 0x0061, 0x00E3},
+    {0x40, 0x21, 0x0065, 0x1EBD},
+    {0x40, 0x21, 0x0069, 0x0129},
+    {0x40, 0x21, 0x006E, 0x00F1},
+    {0x40, 0x21, 0x006F, 0x00F5},
+    {0x40, 0x21, 0x0075, 0x0169},
+    {0x40, 0x21, 0x0076, 0x1E7D},
+    {0x40, 0x21, 0x0079, 0x1EF9},
+    {0x40, 0x2E, 0x0043, 0x00C7},
+    {0x40, 0x2E, 0x0044, 0x1E10},
+    {0x40, 0x2E, 0x0045, 0x0228},
+    {0x40, 0x2E, 0x0047, 0x0122},
+    {0x40, 0x2E, 0x0048, 0x1E28},
+    {0x40, 0x2E, 0x004B, 0x0136},
+    {0x40, 0x2E, 0x004C, 0x013B},
+    {0x40, 0x2E, 0x004E, 0x0145},
+    {0x40, 0x2E, 0x0052, 0x0156},
+    {0x40, 0x2E, 0x0053, 0x015E},
+    {0x40, 0x2E, 0x0054, 0x0162},
+    {0x40, 0x2E, 0x0063, 0x00E7},
+    {0x40, 0x2E, 0x0064, 0x1E11},
+    {0x40, 0x2E, 0x0065, 0x0229},
+    {0x40, 0x2E, 0x0067, 0x0123},
+    {0x40, 0x2E, 0x0068, 0x1E29},
+    {0x40, 0x2E, 0x006B, 0x0137},
+    {0x40, 0x2E, 0x006C, 0x013C},
+    {0x40, 0x2E, 0x006E, 0x0146},
+    {0x40, 0x2E, 0x0072, 0x0157},
+    {0x40, 0x2E, 0x0073, 0x015F},
+    {0x40, 0x2E, 0x0074, 0x0163},
+    {0x40, 0x33, 0x0041, 0x00C3},
+    {0x40, 0x33, 0x0045, 0x1EBC},
+    {0x40, 0x33, 0x0049, 0x0128},
+    {0x40, 0x33, 0x004E, 0x00D1},
+    {0x40, 0x33, 0x004F, 0x00D5},
+    {0x40, 0x33, 0x0055, 0x0168},
+    {0x40, 0x33, 0x0056, 0x1E7C},
+    {0x40, 0x33, 0x0059, 0x1EF8},
+    {0x40, 0x33, 0x0061, 0x00E3},
+    {0x40, 0x33, 0x0065, 0x1EBD},
+    {0x40, 0x33, 0x0069, 0x0129},
+    {0x40, 0x33, 0x006E, 0x00F1},
+    {0x40, 0x33, 0x006F, 0x00F5},
+    {0x40, 0x33, 0x0075, 0x0169},
+    {0x40, 0x33, 0x0076, 0x1E7D},
+    {0x40, 0x33, 0x0079, 0x1EF9},
+    {0x42, 0x2E, 0x0041, 0x0104},
+    {0x42, 0x2E, 0x0045, 0x0118},
+    {0x42, 0x2E, 0x0049, 0x012E},
+    {0x42, 0x2E, 0x004F, 0x01EA},
+    {0x42, 0x2E, 0x0055, 0x0172},
+    {0x42, 0x2E, 0x0061, 0x0105},
+    {0x42, 0x2E, 0x0065, 0x0119},
+    {0x42, 0x2E, 0x0069, 0x012F},
+    {0x42, 0x2E, 0x006F, 0x01EB},
+    {0x42, 0x2E, 0x0075, 0x0173},
+    {0x42, 0x2F, 0x0041, 0x00C5},
+    {0x42, 0x2F, 0x0055, 0x016E},
+    {0x42, 0x2F, 0x0061, 0x00E5},
+    {0x42, 0x2F, 0x0075, 0x016F},
+    {0x42, 0x2F, 0x0077, 0x1E98},
+    {0x42, 0x2F, 0x0079, 0x1E99},
+    {0x42, 0x30, 0x0041, 0x0100},
+    {0x42, 0x30, 0x0045, 0x0112},
+    {0x42, 0x30, 0x0047, 0x1E20},
+    {0x42, 0x30, 0x0049, 0x012A},
+    {0x42, 0x30, 0x004F, 0x014C},
+    {0x42, 0x30, 0x0055, 0x016A},
+    {0x42, 0x30, 0x0059, 0x0232},
+    {0x42, 0x30, 0x0061, 0x0101},
+    {0x42, 0x30, 0x0065, 0x0113},
+    {0x42, 0x30, 0x0067, 0x1E21},
+    {0x42, 0x30, 0x0069, 0x012B},
+    {0x42, 0x30, 0x006F, 0x014D},
+    {0x42, 0x30, 0x0075, 0x016B},
+    {0x42, 0x30, 0x0079, 0x0233},
+    {0x42, 0x30, 0x00C6, 0x01E2},
+    {0x42, 0x30, 0x00E6, 0x01E3},
+    {0x42, 0x31, 0x0041, 0x0102},
+    {0x42, 0x31, 0x0045, 0x0114},
+    {0x42, 0x31, 0x0047, 0x011E},
+    {0x42, 0x31, 0x0049, 0x012C},
+    {0x42, 0x31, 0x004F, 0x014E},
+    {0x42, 0x31, 0x0055, 0x016C},
+    {0x42, 0x31, 0x0061, 0x0103},
+    {0x42, 0x31, 0x0065, 0x0115},
+    {0x42, 0x31, 0x0067, 0x011F},
+    {0x42, 0x31, 0x0069, 0x012D},
+    {0x42, 0x31, 0x006F, 0x014F},
+    {0x42, 0x31, 0x0075, 0x016D},
+    {0x42, 0x32, 0x0041, 0x0102},
+    {0x42, 0x32, 0x0045, 0x0114},
+    {0x42, 0x32, 0x0047, 0x011E},
+    {0x42, 0x32, 0x0049, 0x012C},
+    {0x42, 0x32, 0x004F, 0x014E},
+    {0x42, 0x32, 0x0055, 0x016C},
+    {0x42, 0x32, 0x0061, 0x0103},
+    {0x42, 0x32, 0x0065, 0x0115},
+    {0x42, 0x32, 0x0067, 0x011F},
+    {0x42, 0x32, 0x0069, 0x012D},
+    {0x42, 0x32, 0x006F, 0x014F},
+    {0x42, 0x32, 0x0075, 0x016D},
+    {0x42, 0x33, 0x004F, 0x0150},
+    {0x42, 0x33, 0x0055, 0x0170},
+    {0x42, 0x33, 0x006F, 0x0151},
+    {0x42, 0x33, 0x0075, 0x0171},
+    {0x42, 0x34, 0x0041, 0x01CD},
+    {0x42, 0x34, 0x0043, 0x010C},
+    {0x42, 0x34, 0x0044, 0x010E},
+    {0x42, 0x34, 0x0045, 0x011A},
+    {0x42, 0x34, 0x0047, 0x01E6},
+    {0x42, 0x34, 0x0048, 0x021E},
+    {0x42, 0x34, 0x0049, 0x01CF},
+    {0x42, 0x34, 0x004B, 0x01E8},
+    {0x42, 0x34, 0x004C, 0x013D},
+    {0x42, 0x34, 0x004E, 0x0147},
+    {0x42, 0x34, 0x004F, 0x01D1},
+    {0x42, 0x34, 0x0052, 0x0158},
+    {0x42, 0x34, 0x0053, 0x0160},
+    {0x42, 0x34, 0x0054, 0x0164},
+    {0x42, 0x34, 0x0055, 0x01D3},
+    {0x42, 0x34, 0x005A, 0x017D},
+    {0x42, 0x34, 0x0061, 0x01CE},
+    {0x42, 0x34, 0x0063, 0x010D},
+    {0x42, 0x34, 0x0064, 0x010F},
+    {0x42, 0x34, 0x0065, 0x011B},
+    {0x42, 0x34, 0x0067, 0x01E7},
+    {0x42, 0x34, 0x0068, 0x021F},
+    {0x42, 0x34, 0x0069, 0x01D0},
+    {0x42, 0x34, 0x006A, 0x01F0},
+    {0x42, 0x34, 0x006B, 0x01E9},
+    {0x42, 0x34, 0x006C, 0x013E},
+    {0x42, 0x34, 0x006E, 0x0148},
+    {0x42, 0x34, 0x006F, 0x01D2},
+    {0x42, 0x34, 0x0072, 0x0159},
+    {0x42, 0x34, 0x0073, 0x0161},
+    {0x42, 0x34, 0x0074, 0x0165},
+    {0x42, 0x34, 0x0075, 0x01D4},
+    {0x42, 0x34, 0x007A, 0x017E},
+    {0x42, 0x38, 0x0041, 0x0226},
+    {0x42, 0x38, 0x0042, 0x1E02},
+    {0x42, 0x38, 0x0043, 0x010A},
+    {0x42, 0x38, 0x0044, 0x1E0A},
+    {0x42, 0x38, 0x0045, 0x0116},
+    {0x42, 0x38, 0x0046, 0x1E1E},
+    {0x42, 0x38, 0x0047, 0x0120},
+    {0x42, 0x38, 0x0048, 0x1E22},
+    {0x42, 0x38, 0x0049, 0x0130},
+    {0x42, 0x38, 0x004D, 0x1E40},
+    {0x42, 0x38, 0x004E, 0x1E44},
+    {0x42, 0x38, 0x004F, 0x022E},
+    {0x42, 0x38, 0x0050, 0x1E56},
+    {0x42, 0x38, 0x0052, 0x1E58},
+    {0x42, 0x38, 0x0053, 0x1E60},
+    {0x42, 0x38, 0x0054, 0x1E6A},
+    {0x42, 0x38, 0x0057, 0x1E86},
+    {0x42, 0x38, 0x0058, 0x1E8A},
+    {0x42, 0x38, 0x0059, 0x1E8E},
+    {0x42, 0x38, 0x005A, 0x017B},
+    {0x42, 0x38, 0x0061, 0x0227},
+    {0x42, 0x38, 0x0062, 0x1E03},
+    {0x42, 0x38, 0x0063, 0x010B},
+    {0x42, 0x38, 0x0064, 0x1E0B},
+    {0x42, 0x38, 0x0065, 0x0117},
+    {0x42, 0x38, 0x0066, 0x1E1F},
+    {0x42, 0x38, 0x0067, 0x0121},
+    {0x42, 0x38, 0x0068, 0x1E23},
+    {0x42, 0x38, 0x006D, 0x1E41},
+    {0x42, 0x38, 0x006E, 0x1E45},
+    {0x42, 0x38, 0x006F, 0x022F},
+    {0x42, 0x38, 0x0070, 0x1E57},
+    {0x42, 0x38, 0x0072, 0x1E59},
+    {0x42, 0x38, 0x0073, 0x1E61},
+    {0x42, 0x38, 0x0074, 0x1E6B},
+    {0x42, 0x38, 0x0077, 0x1E87},
+    {0x42, 0x38, 0x0078, 0x1E8B},
+    {0x42, 0x38, 0x0079, 0x1E8F},
+    {0x42, 0x38, 0x007A, 0x017C},
+    {0x42, 0x38, 0x017F, 0x1E9B},
+};
+
+// Portuguese (PT), xkb "pt"
+static const ReferenceKey reference_portuguese_pt_keys[] = {
+    {0x00, 0x04, 0x0061, false},
+    {0x00, 0x05, 0x0062, false},
+    {0x00, 0x06, 0x0063, false},
+    {0x00, 0x07, 0x0064, false},
+    {0x00, 0x08, 0x0065, false},
+    {0x00, 0x09, 0x0066, false},
+    {0x00, 0x0A, 0x0067, false},
+    {0x00, 0x0B, 0x0068, false},
+    {0x00, 0x0C, 0x0069, false},
+    {0x00, 0x0D, 0x006A, false},
+    {0x00, 0x0E, 0x006B, false},
+    {0x00, 0x0F, 0x006C, false},
+    {0x00, 0x10, 0x006D, false},
+    {0x00, 0x11, 0x006E, false},
+    {0x00, 0x12, 0x006F, false},
+    {0x00, 0x13, 0x0070, false},
+    {0x00, 0x14, 0x0071, false},
+    {0x00, 0x15, 0x0072, false},
+    {0x00, 0x16, 0x0073, false},
+    {0x00, 0x17, 0x0074, false},
+    {0x00, 0x18, 0x0075, false},
+    {0x00, 0x19, 0x0076, false},
+    {0x00, 0x1A, 0x0077, false},
+    {0x00, 0x1B, 0x0078, false},
+    {0x00, 0x1C, 0x0079, false},
+    {0x00, 0x1D, 0x007A, false},
+    {0x00, 0x1E, 0x0031, false},
+    {0x00, 0x1F, 0x0032, false},
+    {0x00, 0x20, 0x0033, false},
+    {0x00, 0x21, 0x0034, false},
+    {0x00, 0x22, 0x0035, false},
+    {0x00, 0x23, 0x0036, false},
+    {0x00, 0x24, 0x0037, false},
+    {0x00, 0x25, 0x0038, false},
+    {0x00, 0x26, 0x0039, false},
+    {0x00, 0x27, 0x0030, false},
+    {0x00, 0x28, 0x000A, false},
+    {0x00, 0x2B, 0x0009, false},
+    {0x00, 0x2C, 0x0020, false},
+    {0x00, 0x2D, 0x0027, false},
+    {0x00, 0x2E, 0x00AB, false},
+    {0x00, 0x2F, 0x002B, false},
+    {0x00, 0x30, 0x00B4, true},
+    {0x00, 0x31, 0x007E, true},
+    {0x00, 0x32, 0x007E, true},
+    {0x00, 0x33, 0x00E7, false},
+    {0x00, 0x34, 0x00BA, false},
+    {0x00, 0x35, 0x005C, false},
+    {0x00, 0x36, 0x002C, false},
+    {0x00, 0x37, 0x002E, false},
+    {0x00, 0x38, 0x002D, false},
+    {0x00, 0x54, 0x002F, false},
+    {0x00, 0x64, 0x003C, false},
+    {0x02, 0x04, 0x0041, false},
+    {0x02, 0x05, 0x0042, false},
+    {0x02, 0x06, 0x0043, false},
+    {0x02, 0x07, 0x0044, false},
+    {0x02, 0x08, 0x0045, false},
+    {0x02, 0x09, 0x0046, false},
+    {0x02, 0x0A, 0x0047, false},
+    {0x02, 0x0B, 0x0048, false},
+    {0x02, 0x0C, 0x0049, false},
+    {0x02, 0x0D, 0x004A, false},
+    {0x02, 0x0E, 0x004B, false},
+    {0x02, 0x0F, 0x004C, false},
+    {0x02, 0x10, 0x004D, false},
+    {0x02, 0x11, 0x004E, false},
+    {0x02, 0x12, 0x004F, false},
+    {0x02, 0x13, 0x0050, false},
+    {0x02, 0x14, 0x0051, false},
+    {0x02, 0x15, 0x0052, false},
+    {0x02, 0x16, 0x0053, false},
+    {0x02, 0x17, 0x0054, false},
+    {0x02, 0x18, 0x0055, false},
+    {0x02, 0x19, 0x0056, false},
+    {0x02, 0x1A, 0x0057, false},
+    {0x02, 0x1B, 0x0058, false},
+    {0x02, 0x1C, 0x0059, false},
+    {0x02, 0x1D, 0x005A, false},
+    {0x02, 0x1E, 0x0021, false},
+    {0x02, 0x1F, 0x0022, false},
+    {0x02, 0x20, 0x0023, false},
+    {0x02, 0x21, 0x0024, false},
+    {0x02, 0x22, 0x0025, false},
+    {0x02, 0x23, 0x0026, false},
+    {0x02, 0x24, 0x002F, false},
+    {0x02, 0x25, 0x0028, false},
+    {0x02, 0x26, 0x0029, false},
+    {0x02, 0x27, 0x003D, false},
+    {0x02, 0x28, 0x000A, false},
+    {0x02, 0x2C, 0x0020, false},
+    {0x02, 0x2D, 0x003F, false},
+    {0x02, 0x2E, 0x00BB, false},
+    {0x02, 0x2F, 0x002A, false},
+    {0x02, 0x30, 0x0060, true},
+    {0x02, 0x31, 0x005E, true},
+    {0x02, 0x32, 0x005E, true},
+    {0x02, 0x33, 0x00C7, false},
+    {0x02, 0x34, 0x00AA, false},
+    {0x02, 0x35, 0x007C, false},
+    {0x02, 0x36, 0x003B, false},
+    {0x02, 0x37, 0x003A, false},
+    {0x02, 0x38, 0x005F, false},
+    {0x02, 0x54, 0x002F, false},
+    {0x02, 0x64, 0x003E, false},
+    {0x40, 0x04, 0x00E6, false},
+    {0x40, 0x05, 0x201C, false},
+    {0x40, 0x06, 0x00A2, false},
+    {0x40, 0x07, 0x00F0, false},
+    {0x40, 0x08, 0x20AC, false},
+    {0x40, 0x09, 0x0111, false},
+    {0x40, 0x0A, 0x014B, false},
+    {0x40, 0x0B, 0x0127, false},
+    {0x40, 0x0C, 0x2192, false},
+    {0x40, 0x0E, 0x0138, false},
+    {0x40, 0x0F, 0x0142, false},
+    {0x40, 0x10, 0x00B5, false},
+    {0x40, 0x11, 0x201D, false},
+    {0x40, 0x12, 0x00F8, false},
+    {0x40, 0x13, 0x00FE, false},
+    {0x40, 0x14, 0x0040, false},
+    {0x40, 0x15, 0x00B6, false},
+    {0x40, 0x16, 0x00DF, false},
+    {0x40, 0x17, 0x0167, false},
+    {0x40, 0x18, 0x2193, false},
+    {0x40, 0x19, 0x201E, false},
+    {0x40, 0x1A, 0x017F, false},
+    {0x40, 0x1B, 0x00BB, false},
+    {0x40, 0x1C, 0x2190, false},
+    {0x40, 0x1D, 0x00AB, false},
+    {0x40, 0x1E, 0x00B9, false},
+    {0x40, 0x1F, 0x0040, false},
+    {0x40, 0x20, 0x00A3, false},
+    {0x40, 0x21, 0x00A7, false},
+    {0x40, 0x22, 0x00BD, false},
+    {0x40, 0x23, 0x00AC, false},
+    {0x40, 0x24, 0x007B, false},
+    {0x40, 0x25, 0x005B, false},
+    {0x40, 0x26, 0x005D, false},
+    {0x40, 0x27, 0x007D, false},
+    {0x40, 0x28, 0x000A, false},
+    {0x40, 0x2B, 0x0009, false},
+    {0x40, 0x2C, 0x0020, false},
+    {0x40, 0x2D, 0x005C, false},
+    {0x40, 0x2E, 0x00B8, true},
+    {0x40, 0x2F, 0x00A8, true},
+    {0x40, 0x30, 0x007E, true},
+    {0x40, 0x31, 0x0060, true},
+    {0x40, 0x32, 0x0060, true},
+    {0x40, 0x33, 0x00B4, true},
+    {0x40, 0x34, 0x005E, true},
+    {0x40, 0x35, 0x00AC, false},
+    {0x40, 0x36, 0x2022, false},
+    {0x40, 0x37, 0x00B7, false},
+    {0x40, 0x54, 0x002F, false},
+    {0x40, 0x64, 0x005C, false},
+    {0x42, 0x04, 0x00C6, false},
+    {0x42, 0x05, 0x2018, false},
+    {0x42, 0x06, 0x00A9, false},
+    {0x42, 0x07, 0x00D0, false},
+    {0x42, 0x08, 0x00A2, false},
+    {0x42, 0x09, 0x00AA, false},
+    {0x42, 0x0A, 0x014A, false},
+    {0x42, 0x0B, 0x0126, false},
+    {0x42, 0x0C, 0x0131, false},
+    {0x42, 0x0E, 0x0026, false},
+    {0x42, 0x0F, 0x0141, false},
+    {0x42, 0x10, 0x00BA, false},
+    {0x42, 0x11, 0x2019, false},
+    {0x42, 0x12, 0x00D8, false},
+    {0x42, 0x13, 0x00DE, false},
+    {0x42, 0x14, 0x03A9, false},
+    {0x42, 0x15, 0x00AE, false},
+    {0x42, 0x16, 0x1E9E, false},
+    {0x42, 0x17, 0x0166, false},
+    {0x42, 0x18, 0x2191, false},
+    {0x42, 0x19, 0x201A, false},
+    {0x42, 0x1A, 0x00A7, false},
+    {0x42, 0x1B, 0x003E, false},
+    {0x42, 0x1C, 0x00A5, false},
+    {0x42, 0x1D, 0x003C, false},
+    {0x42, 0x1E, 0x00A1, false},
+    {0x42, 0x1F, 0x215B, false},
+    {0x42, 0x20, 0x00A3, false},
+    {0x42, 0x21, 0x0024, false},
+    {0x42, 0x22, 0x215C, false},
+    {0x42, 0x23, 0x215D, false},
+    {0x42, 0x24, 0x215E, false},
+    {0x42, 0x25, 0x2122, false},
+    {0x42, 0x26, 0x00B1, false},
+    {0x42, 0x27, 0x00B0, false},
+    {0x42, 0x28, 0x000A, false},
+    {0x42, 0x2C, 0x0020, false},
+    {0x42, 0x2D, 0x00BF, false},
+    {0x42, 0x2E, 0x02DB, true},
+    {0x42, 0x2F, 0x02DA, true},
+    {0x42, 0x30, 0x00AF, true},
+    {0x42, 0x31, 0x02D8, true},
+    {0x42, 0x32, 0x02D8, true},
+    {0x42, 0x33, 0x02DD, true},
+    {0x42, 0x34, 0x02C7, true},
+    {0x42, 0x35, 0x00AC, false},
+    {0x42, 0x36, 0x00D7, false},
+    {0x42, 0x37, 0x00F7, false},
+    {0x42, 0x38, 0x02D9, true},
+    {0x42, 0x54, 0x002F, false},
+    {0x42, 0x64, 0x005C, false},
+};
+static const ReferenceCompose reference_portuguese_pt_composed[] = {
+    {0x00, 0x30, 0x0041, 0x00C1},
+    {0x00, 0x30, 0x0043, 0x0106},
+    {0x00, 0x30, 0x0045, 0x00C9},
+    {0x00, 0x30, 0x0047, 0x01F4},
+    {0x00, 0x30, 0x0049, 0x00CD},
+    {0x00, 0x30, 0x004B, 0x1E30},
+    {0x00, 0x30, 0x004C, 0x0139},
+    {0x00, 0x30, 0x004D, 0x1E3E},
+    {0x00, 0x30, 0x004E, 0x0143},
+    {0x00, 0x30, 0x004F, 0x00D3},
+    {0x00, 0x30, 0x0050, 0x1E54},
+    {0x00, 0x30, 0x0052, 0x0154},
+    {0x00, 0x30, 0x0053, 0x015A},
+    {0x00, 0x30, 0x0055, 0x00DA},
+    {0x00, 0x30, 0x0057, 0x1E82},
+    {0x00, 0x30, 0x0059, 0x00DD},
+    {0x00, 0x30, 0x005A, 0x0179},
+    {0x00, 0x30, 0x0061, 0x00E1},
+    {0x00, 0x30, 0x0063, 0x0107},
+    {0x00, 0x30, 0x0065, 0x00E9},
+    {0x00, 0x30, 0x0067, 0x01F5},
+    {0x00, 0x30, 0x0069, 0x00ED},
+    {0x00, 0x30, 0x006B, 0x1E31},
+    {0x00, 0x30, 0x006C, 0x013A},
+    {0x00, 0x30, 0x006D, 0x1E3F},
+    {0x00, 0x30, 0x006E, 0x0144},
+    {0x00, 0x30, 0x006F, 0x00F3},
+    {0x00, 0x30, 0x0070, 0x1E55},
+    {0x00, 0x30, 0x0072, 0x0155},
+    {0x00, 0x30, 0x0073, 0x015B},
+    {0x00, 0x30, 0x0075, 0x00FA},
+    {0x00, 0x30, 0x0077, 0x1E83},
+    {0x00, 0x30, 0x0079, 0x00FD},
+    {0x00, 0x30, 0x007A, 0x017A},
+    {0x00, 0x30, 0x00C6, 0x01FC},
+    {0x00, 0x30, 0x00C7, 0x1E08},
+    {0x00, 0x30, 0x00D8, 0x01FE},
+    {0x00, 0x30, 0x00E6, 0x01FD},
+    {0x00, 0x30, 0x00E7, 0x1E09},
+    {0x00, 0x30, 0x00F8, 0x01FF},
+    {0x00, 0x30, 0x03A9, 0x038F},
+    {0x00, 0x31, 0x0041, 0x00C3},
+    {0x00, 0x31, 0x0045, 0x1EBC},
+    {0x00, 0x31, 0x0049, 0x0128},
+    {0x00, 0x31, 0x004E, 0x00D1},
+    {0x00, 0x31, 0x004F, 0x00D5},
+    {0x00, 0x31, 0x0055, 0x0168},
+    {0x00, 0x31, 0x0056, 0x1E7C},
+    {0x00, 0x31, 0x0059, 0x1EF8},
+    {0x00, 0x31, 0x0061, 0x00E3},
+    {0x00, 0x31, 0x0065, 0x1EBD},
+    {0x00, 0x31, 0x0069, 0x0129},
+    {0x00, 0x31, 0x006E, 0x00F1},
+    {0x00, 0x31, 0x006F, 0x00F5},
+    {0x00, 0x31, 0x0075, 0x0169},
+    {0x00, 0x31, 0x0076, 0x1E7D},
+    {0x00, 0x31, 0x0079, 0x1EF9},
+    {0x00, 0x32, 0x0041, 0x00C3},
+    {0x00, 0x32, 0x0045, 0x1EBC},
+    {0x00, 0x32, 0x0049, 0x0128},
+    {0x00, 0x32, 0x004E, 0x00D1},
+    {0x00, 0x32, 0x004F, 0x00D5},
+    {0x00, 0x32, 0x0055, 0x0168},
+    {0x00, 0x32, 0x0056, 0x1E7C},
+    {0x00, 0x32, 0x0059, 0x1EF8},
+    {0x00, 0x32, 0x0061, 0x00E3},
+    {0x00, 0x32, 0x0065, 0x1EBD},
+    {0x00, 0x32, 0x0069, 0x0129},
+    {0x00, 0x32, 0x006E, 0x00F1},
+    {0x00, 0x32, 0x006F, 0x00F5},
+    {0x00, 0x32, 0x0075, 0x0169},
+    {0x00, 0x32, 0x0076, 0x1E7D},
+    {0x00, 0x32, 0x0079, 0x1EF9},
+    {0x02, 0x30, 0x0041, 0x00C0},
+    {0x02, 0x30, 0x0045, 0x00C8},
+    {0x02, 0x30, 0x0049, 0x00CC},
+    {0x02, 0x30, 0x004E, 0x01F8},
+    {0x02, 0x30, 0x004F, 0x00D2},
+    {0x02, 0x30, 0x0055, 0x00D9},
+    {0x02, 0x30, 0x0057, 0x1E80},
+    {0x02, 0x30, 0x0059, 0x1EF2},
+    {0x02, 0x30, 0x0061, 0x00E0},
+    {0x02, 0x30, 0x0065, 0x00E8},
+    {0x02, 0x30, 0x0069, 0x00EC},
+    {0x02, 0x30, 0x006E, 0x01F9},
+    {0x02, 0x30, 0x006F, 0x00F2},
+    {0x02, 0x30, 0x0075, 0x00F9},
+    {0x02, 0x30, 0x0077, 0x1E81},
+    {0x02, 0x30, 0x0079, 0x1EF3},
+    {0x02, 0x30, 0x03A9, 0x1FFA},
+    {0x02, 0x31, 0x0041, 0x00C2},
+    {0x02, 0x31, 0x0043, 0x0108},
+    {0x02, 0x31, 0x0045, 0x00CA},
+    {0x02, 0x31, 0x0047, 0x011C},
+    {0x02, 0x31, 0x0048, 0x0124},
+    {0x02, 0x31, 0x0049, 0x00CE},
+    {0x02, 0x31, 0x004A, 0x0134},
+    {0x02, 0x31, 0x004F, 0x00D4},
+    {0x02, 0x31, 0x0053, 0x015C},
+    {0x02, 0x31, 0x0055, 0x00DB},
+    {0x02, 0x31, 0x0057, 0x0174},
+    {0x02, 0x31, 0x0059, 0x0176},
+    {0x02, 0x31, 0x005A, 0x1E90},
+    {0x02, 0x31, 0x0061, 0x00E2},
+    {0x02, 0x31, 0x0063, 0x0109},
+    {0x02, 0x31, 0x0065, 0x00EA},
+    {0x02, 0x31, 0x0067, 0x011D},
+    {0x02, 0x31, 0x0068, 0x0125},
+    {0x02, 0x31, 0x0069, 0x00EE},
+    {0x02, 0x31, 0x006A, 0x0135},
+    {0x02, 0x31, 0x006F, 0x00F4},
+    {0x02, 0x31, 0x0073, 0x015D},
+    {0x02, 0x31, 0x0075, 0x00FB},
+    {0x02, 0x31, 0x0077, 0x0175},
+    {0x02, 0x31, 0x0079, 0x0177},
+    {0x02, 0x31, 0x007A, 0x1E91},
+    {0x02, 0x32, 0x0041, 0x00C2},
+    {0x02, 0x32, 0x0043, 0x0108},
+    {0x02, 0x32, 0x0045, 0x00CA},
+    {0x02, 0x32, 0x0047, 0x011C},
+    {0x02, 0x32, 0x0048, 0x0124},
+    {0x02, 0x32, 0x0049, 0x00CE},
+    {0x02, 0x32, 0x004A, 0x0134},
+    {0x02, 0x32, 0x004F, 0x00D4},
+    {0x02, 0x32, 0x0053, 0x015C},
+    {0x02, 0x32, 0x0055, 0x00DB},
+    {0x02, 0x32, 0x0057, 0x0174},
+    {0x02, 0x32, 0x0059, 0x0176},
+    {0x02, 0x32, 0x005A, 0x1E90},
+    {0x02, 0x32, 0x0061, 0x00E2},
+    {0x02, 0x32, 0x0063, 0x0109},
+    {0x02, 0x32, 0x0065, 0x00EA},
+    {0x02, 0x32, 0x0067, 0x011D},
+    {0x02, 0x32, 0x0068, 0x0125},
+    {0x02, 0x32, 0x0069, 0x00EE},
+    {0x02, 0x32, 0x006A, 0x0135},
+    {0x02, 0x32, 0x006F, 0x00F4},
+    {0x02, 0x32, 0x0073, 0x015D},
+    {0x02, 0x32, 0x0075, 0x00FB},
+    {0x02, 0x32, 0x0077, 0x0175},
+    {0x02, 0x32, 0x0079, 0x0177},
+    {0x02, 0x32, 0x007A, 0x1E91},
+    {0x40, 0x2E, 0x0043, 0x00C7},
+    {0x40, 0x2E, 0x0044, 0x1E10},
+    {0x40, 0x2E, 0x0045, 0x0228},
+    {0x40, 0x2E, 0x0047, 0x0122},
+    {0x40, 0x2E, 0x0048, 0x1E28},
+    {0x40, 0x2E, 0x004B, 0x0136},
+    {0x40, 0x2E, 0x004C, 0x013B},
+    {0x40, 0x2E, 0x004E, 0x0145},
+    {0x40, 0x2E, 0x0052, 0x0156},
+    {0x40, 0x2E, 0x0053, 0x015E},
+    {0x40, 0x2E, 0x0054, 0x0162},
+    {0x40, 0x2E, 0x0063, 0x00E7},
+    {0x40, 0x2E, 0x0064, 0x1E11},
+    {0x40, 0x2E, 0x0065, 0x0229},
+    {0x40, 0x2E, 0x0067, 0x0123},
+    {0x40, 0x2E, 0x0068, 0x1E29},
+    {0x40, 0x2E, 0x006B, 0x0137},
+    {0x40, 0x2E, 0x006C, 0x013C},
+    {0x40, 0x2E, 0x006E, 0x0146},
+    {0x40, 0x2E, 0x0072, 0x0157},
+    {0x40, 0x2E, 0x0073, 0x015F},
+    {0x40, 0x2E, 0x0074, 0x0163},
+    {0x40, 0x2F, 0x0041, 0x00C4},
+    {0x40, 0x2F, 0x0045, 0x00CB},
+    {0x40, 0x2F, 0x0048, 0x1E26},
+    {0x40, 0x2F, 0x0049, 0x00CF},
+    {0x40, 0x2F, 0x004F, 0x00D6},
+    {0x40, 0x2F, 0x0055, 0x00DC},
+    {0x40, 0x2F, 0x0057, 0x1E84},
+    {0x40, 0x2F, 0x0058, 0x1E8C},
+    {0x40, 0x2F, 0x0059, 0x0178},
+    {0x40, 0x2F, 0x0061, 0x00E4},
+    {0x40, 0x2F, 0x0065, 0x00EB},
+    {0x40, 0x2F, 0x0068, 0x1E27},
+    {0x40, 0x2F, 0x0069, 0x00EF},
+    {0x40, 0x2F, 0x006F, 0x00F6},
+    {0x40, 0x2F, 0x0074, 0x1E97},
+    {0x40, 0x2F, 0x0075, 0x00FC},
+    {0x40, 0x2F, 0x0077, 0x1E85},
+    {0x40, 0x2F, 0x0078, 0x1E8D},
+    {0x40, 0x2F, 0x0079, 0x00FF},
+    {0x40, 0x30, 0x0041, 0x00C3},
+    {0x40, 0x30, 0x0045, 0x1EBC},
+    {0x40, 0x30, 0x0049, 0x0128},
+    {0x40, 0x30, 0x004E, 0x00D1},
+    {0x40, 0x30, 0x004F, 0x00D5},
+    {0x40, 0x30, 0x0055, 0x0168},
+    {0x40, 0x30, 0x0056, 0x1E7C},
+    {0x40, 0x30, 0x0059, 0x1EF8},
+    {0x40, 0x30, 0x0061, 0x00E3},
+    {0x40, 0x30, 0x0065, 0x1EBD},
+    {0x40, 0x30, 0x0069, 0x0129},
+    {0x40, 0x30, 0x006E, 0x00F1},
+    {0x40, 0x30, 0x006F, 0x00F5},
+    {0x40, 0x30, 0x0075, 0x0169},
+    {0x40, 0x30, 0x0076, 0x1E7D},
+    {0x40, 0x30, 0x0079, 0x1EF9},
+    {0x40, 0x31, 0x0041, 0x00C0},
+    {0x40, 0x31, 0x0045, 0x00C8},
+    {0x40, 0x31, 0x0049, 0x00CC},
+    {0x40, 0x31, 0x004E, 0x01F8},
+    {0x40, 0x31, 0x004F, 0x00D2},
+    {0x40, 0x31, 0x0055, 0x00D9},
+    {0x40, 0x31, 0x0057, 0x1E80},
+    {0x40, 0x31, 0x0059, 0x1EF2},
+    {0x40, 0x31, 0x0061, 0x00E0},
+    {0x40, 0x31, 0x0065, 0x00E8},
+    {0x40, 0x31, 0x0069, 0x00EC},
+    {0x40, 0x31, 0x006E, 0x01F9},
+    {0x40, 0x31, 0x006F, 0x00F2},
+    {0x40, 0x31, 0x0075, 0x00F9},
+    {0x40, 0x31, 0x0077, 0x1E81},
+    {0x40, 0x31, 0x0079, 0x1EF3},
+    {0x40, 0x31, 0x03A9, 0x1FFA},
+    {0x40, 0x32, 0x0041, 0x00C0},
+    {0x40, 0x32, 0x0045, 0x00C8},
+    {0x40, 0x32, 0x0049, 0x00CC},
+    {0x40, 0x32, 0x004E, 0x01F8},
+    {0x40, 0x32, 0x004F, 0x00D2},
+    {0x40, 0x32, 0x0055, 0x00D9},
+    {0x40, 0x32, 0x0057, 0x1E80},
+    {0x40, 0x32, 0x0059, 0x1EF2},
+    {0x40, 0x32, 0x0061, 0x00E0},
+    {0x40, 0x32, 0x0065, 0x00E8},
+    {0x40, 0x32, 0x0069, 0x00EC},
+    {0x40, 0x32, 0x006E, 0x01F9},
+    {0x40, 0x32, 0x006F, 0x00F2},
+    {0x40, 0x32, 0x0075, 0x00F9},
+    {0x40, 0x32, 0x0077, 0x1E81},
+    {0x40, 0x32, 0x0079, 0x1EF3},
+    {0x40, 0x32, 0x03A9, 0x1FFA},
+    {0x40, 0x33, 0x0041, 0x00C1},
+    {0x40, 0x33, 0x0043, 0x0106},
+    {0x40, 0x33, 0x0045, 0x00C9},
+    {0x40, 0x33, 0x0047, 0x01F4},
+    {0x40, 0x33, 0x0049, 0x00CD},
+    {0x40, 0x33, 0x004B, 0x1E30},
+    {0x40, 0x33, 0x004C, 0x0139},
+    {0x40, 0x33, 0x004D, 0x1E3E},
+    {0x40, 0x33, 0x004E, 0x0143},
+    {0x40, 0x33, 0x004F, 0x00D3},
+    {0x40, 0x33, 0x0050, 0x1E54},
+    {0x40, 0x33, 0x0052, 0x0154},
+    {0x40, 0x33, 0x0053, 0x015A},
+    {0x40, 0x33, 0x0055, 0x00DA},
+    {0x40, 0x33, 0x0057, 0x1E82},
+    {0x40, 0x33, 0x0059, 0x00DD},
+    {0x40, 0x33, 0x005A, 0x0179},
+    {0x40, 0x33, 0x0061, 0x00E1},
+    {0x40, 0x33, 0x0063, 0x0107},
+    {0x40, 0x33, 0x0065, 0x00E9},
+    {0x40, 0x33, 0x0067, 0x01F5},
+    {0x40, 0x33, 0x0069, 0x00ED},
+    {0x40, 0x33, 0x006B, 0x1E31},
+    {0x40, 0x33, 0x006C, 0x013A},
+    {0x40, 0x33, 0x006D, 0x1E3F},
+    {0x40, 0x33, 0x006E, 0x0144},
+    {0x40, 0x33, 0x006F, 0x00F3},
+    {0x40, 0x33, 0x0070, 0x1E55},
+    {0x40, 0x33, 0x0072, 0x0155},
+    {0x40, 0x33, 0x0073, 0x015B},
+    {0x40, 0x33, 0x0075, 0x00FA},
+    {0x40, 0x33, 0x0077, 0x1E83},
+    {0x40, 0x33, 0x0079, 0x00FD},
+    {0x40, 0x33, 0x007A, 0x017A},
+    {0x40, 0x33, 0x00C6, 0x01FC},
+    {0x40, 0x33, 0x00C7, 0x1E08},
+    {0x40, 0x33, 0x00D8, 0x01FE},
+    {0x40, 0x33, 0x00E6, 0x01FD},
+    {0x40, 0x33, 0x00E7, 0x1E09},
+    {0x40, 0x33, 0x00F8, 0x01FF},
+    {0x40, 0x33, 0x03A9, 0x038F},
+    {0x40, 0x34, 0x0041, 0x00C2},
+    {0x40, 0x34, 0x0043, 0x0108},
+    {0x40, 0x34, 0x0045, 0x00CA},
+    {0x40, 0x34, 0x0047, 0x011C},
+    {0x40, 0x34, 0x0048, 0x0124},
+    {0x40, 0x34, 0x0049, 0x00CE},
+    {0x40, 0x34, 0x004A, 0x0134},
+    {0x40, 0x34, 0x004F, 0x00D4},
+    {0x40, 0x34, 0x0053, 0x015C},
+    {0x40, 0x34, 0x0055, 0x00DB},
+    {0x40, 0x34, 0x0057, 0x0174},
+    {0x40, 0x34, 0x0059, 0x0176},
+    {0x40, 0x34, 0x005A, 0x1E90},
+    {0x40, 0x34, 0x0061, 0x00E2},
+    {0x40, 0x34, 0x0063, 0x0109},
+    {0x40, 0x34, 0x0065, 0x00EA},
+    {0x40, 0x34, 0x0067, 0x011D},
+    {0x40, 0x34, 0x0068, 0x0125},
+    {0x40, 0x34, 0x0069, 0x00EE},
+    {0x40, 0x34, 0x006A, 0x0135},
+    {0x40, 0x34, 0x006F, 0x00F4},
+    {0x40, 0x34, 0x0073, 0x015D},
+    {0x40, 0x34, 0x0075, 0x00FB},
+    {0x40, 0x34, 0x0077, 0x0175},
+    {0x40, 0x34, 0x0079, 0x0177},
+    {0x40, 0x34, 0x007A, 0x1E91},
+    {0x42, 0x2E, 0x0041, 0x0104},
+    {0x42, 0x2E, 0x0045, 0x0118},
+    {0x42, 0x2E, 0x0049, 0x012E},
+    {0x42, 0x2E, 0x004F, 0x01EA},
+    {0x42, 0x2E, 0x0055, 0x0172},
+    {0x42, 0x2E, 0x0061, 0x0105},
+    {0x42, 0x2E, 0x0065, 0x0119},
+    {0x42, 0x2E, 0x0069, 0x012F},
+    {0x42, 0x2E, 0x006F, 0x01EB},
+    {0x42, 0x2E, 0x0075, 0x0173},
+    {0x42, 0x2F, 0x0041, 0x00C5},
+    {0x42, 0x2F, 0x0055, 0x016E},
+    {0x42, 0x2F, 0x0061, 0x00E5},
+    {0x42, 0x2F, 0x0075, 0x016F},
+    {0x42, 0x2F, 0x0077, 0x1E98},
+    {0x42, 0x2F, 0x0079, 0x1E99},
+    {0x42, 0x30, 0x0041, 0x0100},
+    {0x42, 0x30, 0x0045, 0x0112},
+    {0x42, 0x30, 0x0047, 0x1E20},
+    {0x42, 0x30, 0x0049, 0x012A},
+    {0x42, 0x30, 0x004F, 0x014C},
+    {0x42, 0x30, 0x0055, 0x016A},
+    {0x42, 0x30, 0x0059, 0x0232},
+    {0x42, 0x30, 0x0061, 0x0101},
+    {0x42, 0x30, 0x0065, 0x0113},
+    {0x42, 0x30, 0x0067, 0x1E21},
+    {0x42, 0x30, 0x0069, 0x012B},
+    {0x42, 0x30, 0x006F, 0x014D},
+    {0x42, 0x30, 0x0075, 0x016B},
+    {0x42, 0x30, 0x0079, 0x0233},
+    {0x42, 0x30, 0x00C6, 0x01E2},
+    {0x42, 0x30, 0x00E6, 0x01E3},
+    {0x42, 0x31, 0x0041, 0x0102},
+    {0x42, 0x31, 0x0045, 0x0114},
+    {0x42, 0x31, 0x0047, 0x011E},
+    {0x42, 0x31, 0x0049, 0x012C},
+    {0x42, 0x31, 0x004F, 0x014E},
+    {0x42, 0x31, 0x0055, 0x016C},
+    {0x42, 0x31, 0x0061, 0x0103},
+    {0x42, 0x31, 0x0065, 0x0115},
+    {0x42, 0x31, 0x0067, 0x011F},
+    {0x42, 0x31, 0x0069, 0x012D},
+    {0x42, 0x31, 0x006F, 0x014F},
+    {0x42, 0x31, 0x0075, 0x016D},
+    {0x42, 0x32, 0x0041, 0x0102},
+    {0x42, 0x32, 0x0045, 0x0114},
+    {0x42, 0x32, 0x0047, 0x011E},
+    {0x42, 0x32, 0x0049, 0x012C},
+    {0x42, 0x32, 0x004F, 0x014E},
+    {0x42, 0x32, 0x0055, 0x016C},
+    {0x42, 0x32, 0x0061, 0x0103},
+    {0x42, 0x32, 0x0065, 0x0115},
+    {0x42, 0x32, 0x0067, 0x011F},
+    {0x42, 0x32, 0x0069, 0x012D},
+    {0x42, 0x32, 0x006F, 0x014F},
+    {0x42, 0x32, 0x0075, 0x016D},
+    {0x42, 0x33, 0x004F, 0x0150},
+    {0x42, 0x33, 0x0055, 0x0170},
+    {0x42, 0x33, 0x006F, 0x0151},
+    {0x42, 0x33, 0x0075, 0x0171},
+    {0x42, 0x34, 0x0041, 0x01CD},
+    {0x42, 0x34, 0x0043, 0x010C},
+    {0x42, 0x34, 0x0044, 0x010E},
+    {0x42, 0x34, 0x0045, 0x011A},
+    {0x42, 0x34, 0x0047, 0x01E6},
+    {0x42, 0x34, 0x0048, 0x021E},
+    {0x42, 0x34, 0x0049, 0x01CF},
+    {0x42, 0x34, 0x004B, 0x01E8},
+    {0x42, 0x34, 0x004C, 0x013D},
+    {0x42, 0x34, 0x004E, 0x0147},
+    {0x42, 0x34, 0x004F, 0x01D1},
+    {0x42, 0x34, 0x0052, 0x0158},
+    {0x42, 0x34, 0x0053, 0x0160},
+    {0x42, 0x34, 0x0054, 0x0164},
+    {0x42, 0x34, 0x0055, 0x01D3},
+    {0x42, 0x34, 0x005A, 0x017D},
+    {0x42, 0x34, 0x0061, 0x01CE},
+    {0x42, 0x34, 0x0063, 0x010D},
+    {0x42, 0x34, 0x0064, 0x010F},
+    {0x42, 0x34, 0x0065, 0x011B},
+    {0x42, 0x34, 0x0067, 0x01E7},
+    {0x42, 0x34, 0x0068, 0x021F},
+    {0x42, 0x34, 0x0069, 0x01D0},
+    {0x42, 0x34, 0x006A, 0x01F0},
+    {0x42, 0x34, 0x006B, 0x01E9},
+    {0x42, 0x34, 0x006C, 0x013E},
+    {0x42, 0x34, 0x006E, 0x0148},
+    {0x42, 0x34, 0x006F, 0x01D2},
+    {0x42, 0x34, 0x0072, 0x0159},
+    {0x42, 0x34, 0x0073, 0x0161},
+    {0x42, 0x34, 0x0074, 0x0165},
+    {0x42, 0x34, 0x0075, 0x01D4},
+    {0x42, 0x34, 0x007A, 0x017E},
+    {0x42, 0x38, 0x0041, 0x0226},
+    {0x42, 0x38, 0x0042, 0x1E02},
+    {0x42, 0x38, 0x0043, 0x010A},
+    {0x42, 0x38, 0x0044, 0x1E0A},
+    {0x42, 0x38, 0x0045, 0x0116},
+    {0x42, 0x38, 0x0046, 0x1E1E},
+    {0x42, 0x38, 0x0047, 0x0120},
+    {0x42, 0x38, 0x0048, 0x1E22},
+    {0x42, 0x38, 0x0049, 0x0130},
+    {0x42, 0x38, 0x004D, 0x1E40},
+    {0x42, 0x38, 0x004E, 0x1E44},
+    {0x42, 0x38, 0x004F, 0x022E},
+    {0x42, 0x38, 0x0050, 0x1E56},
+    {0x42, 0x38, 0x0052, 0x1E58},
+    {0x42, 0x38, 0x0053, 0x1E60},
+    {0x42, 0x38, 0x0054, 0x1E6A},
+    {0x42, 0x38, 0x0057, 0x1E86},
+    {0x42, 0x38, 0x0058, 0x1E8A},
+    {0x42, 0x38, 0x0059, 0x1E8E},
+    {0x42, 0x38, 0x005A, 0x017B},
+    {0x42, 0x38, 0x0061, 0x0227},
+    {0x42, 0x38, 0x0062, 0x1E03},
+    {0x42, 0x38, 0x0063, 0x010B},
+    {0x42, 0x38, 0x0064, 0x1E0B},
+    {0x42, 0x38, 0x0065, 0x0117},
+    {0x42, 0x38, 0x0066, 0x1E1F},
+    {0x42, 0x38, 0x0067, 0x0121},
+    {0x42, 0x38, 0x0068, 0x1E23},
+    {0x42, 0x38, 0x006D, 0x1E41},
+    {0x42, 0x38, 0x006E, 0x1E45},
+    {0x42, 0x38, 0x006F, 0x022F},
+    {0x42, 0x38, 0x0070, 0x1E57},
+    {0x42, 0x38, 0x0072, 0x1E59},
+    {0x42, 0x38, 0x0073, 0x1E61},
+    {0x42, 0x38, 0x0074, 0x1E6B},
+    {0x42, 0x38, 0x0077, 0x1E87},
+    {0x42, 0x38, 0x0078, 0x1E8B},
+    {0x42, 0x38, 0x0079, 0x1E8F},
+    {0x42, 0x38, 0x007A, 0x017C},
+    {0x42, 0x38, 0x017F, 0x1E9B},
+};
+
+// Portuguese (BR), xkb "br"
+static const ReferenceKey reference_portuguese_br_keys[] = {
+    {0x00, 0x04, 0x0061, false},
+    {0x00, 0x05, 0x0062, false},
+    {0x00, 0x06, 0x0063, false},
+    {0x00, 0x07, 0x0064, false},
+    {0x00, 0x08, 0x0065, false},
+    {0x00, 0x09, 0x0066, false},
+    {0x00, 0x0A, 0x0067, false},
+    {0x00, 0x0B, 0x0068, false},
+    {0x00, 0x0C, 0x0069, false},
+    {0x00, 0x0D, 0x006A, false},
+    {0x00, 0x0E, 0x006B, false},
+    {0x00, 0x0F, 0x006C, false},
+    {0x00, 0x10, 0x006D, false},
+    {0x00, 0x11, 0x006E, false},
+    {0x00, 0x12, 0x006F, false},
+    {0x00, 0x13, 0x0070, false},
+    {0x00, 0x14, 0x0071, false},
+    {0x00, 0x15, 0x0072, false},
+    {0x00, 0x16, 0x0073, false},
+    {0x00, 0x17, 0x0074, false},
+    {0x00, 0x18, 0x0075, false},
+    {0x00, 0x19, 0x0076, false},
+    {0x00, 0x1A, 0x0077, false},
+    {0x00, 0x1B, 0x0078, false},
+    {0x00, 0x1C, 0x0079, false},
+    {0x00, 0x1D, 0x007A, false},
+    {0x00, 0x1E, 0x0031, false},
+    {0x00, 0x1F, 0x0032, false},
+    {0x00, 0x20, 0x0033, false},
+    {0x00, 0x21, 0x0034, false},
+    {0x00, 0x22, 0x0035, false},
+    {0x00, 0x23, 0x0036, false},
+    {0x00, 0x24, 0x0037, false},
+    {0x00, 0x25, 0x0038, false},
+    {0x00, 0x26, 0x0039, false},
+    {0x00, 0x27, 0x0030, false},
+    {0x00, 0x28, 0x000A, false},
+    {0x00, 0x2B, 0x0009, false},
+    {0x00, 0x2C, 0x0020, false},
+    {0x00, 0x2D, 0x002D, false},
+    {0x00, 0x2E, 0x003D, false},
+    {0x00, 0x2F, 0x00B4, true},
+    {0x00, 0x30, 0x005B, false},
+    {0x00, 0x31, 0x005D, false},
+    {0x00, 0x32, 0x005D, false},
+    {0x00, 0x33, 0x00E7, false},
+    {0x00, 0x34, 0x007E, true},
+    {0x00, 0x35, 0x0027, false},
+    {0x00, 0x36, 0x002C, false},
+    {0x00, 0x37, 0x002E, false},
+    {0x00, 0x38, 0x003B, false},
+    {0x00, 0x54, 0x002F, false},
+    {0x00, 0x64, 0x005C, false},
+    {0x02, 0x04, 0x0041, false},
+    {0x02, 0x05, 0x0042, false},
+    {0x02, 0x06, 0x0043, false},
+    {0x02, 0x07, 0x0044, false},
+    {0x02, 0x08, 0x0045, false},
+    {0x02, 0x09, 0x0046, false},
+    {0x02, 0x0A, 0x0047, false},
+    {0x02, 0x0B, 0x0048, false},
+    {0x02, 0x0C, 0x0049, false},
+    {0x02, 0x0D, 0x004A, false},
+    {0x02, 0x0E, 0x004B, false},
+    {0x02, 0x0F, 0x004C, false},
+    {0x02, 0x10, 0x004D, false},
+    {0x02, 0x11, 0x004E, false},
+    {0x02, 0x12, 0x004F, false},
+    {0x02, 0x13, 0x0050, false},
+    {0x02, 0x14, 0x0051, false},
+    {0x02, 0x15, 0x0052, false},
+    {0x02, 0x16, 0x0053, false},
+    {0x02, 0x17, 0x0054, false},
+    {0x02, 0x18, 0x0055, false},
+    {0x02, 0x19, 0x0056, false},
+    {0x02, 0x1A, 0x0057, false},
+    {0x02, 0x1B, 0x0058, false},
+    {0x02, 0x1C, 0x0059, false},
+    {0x02, 0x1D, 0x005A, false},
+    {0x02, 0x1E, 0x0021, false},
+    {0x02, 0x1F, 0x0040, false},
+    {0x02, 0x20, 0x0023, false},
+    {0x02, 0x21, 0x0024, false},
+    {0x02, 0x22, 0x0025, false},
+    {0x02, 0x23, 0x00A8, true},
+    {0x02, 0x24, 0x0026, false},
+    {0x02, 0x25, 0x002A, false},
+    {0x02, 0x26, 0x0028, false},
+    {0x02, 0x27, 0x0029, false},
+    {0x02, 0x28, 0x000A, false},
+    {0x02, 0x2C, 0x0020, false},
+    {0x02, 0x2D, 0x005F, false},
+    {0x02, 0x2E, 0x002B, false},
+    {0x02, 0x2F, 0x0060, true},
+    {0x02, 0x30, 0x007B, false},
+    {0x02, 0x31, 0x007D, false},
+    {0x02, 0x32, 0x007D, false},
+    {0x02, 0x33, 0x00C7, false},
+    {0x02, 0x34, 0x005E, true},
+    {0x02, 0x35, 0x0022, false},
+    {0x02, 0x36, 0x003C, false},
+    {0x02, 0x37, 0x003E, false},
+    {0x02, 0x38, 0x003A, false},
+    {0x02, 0x54, 0x002F, false},
+    {0x02, 0x64, 0x007C, false},
+    {0x40, 0x04, 0x00E6, false},
+    {0x40, 0x05, 0x201C, false},
+    {0x40, 0x06, 0x00A9, false},
+    {0x40, 0x07, 0x00F0, false},
+    {0x40, 0x08, 0x00B0, false},
+    {0x40, 0x09, 0x0111, false},
+    {0x40, 0x0A, 0x014B, false},
+    {0x40, 0x0B, 0x0127, false},
+    {0x40, 0x0C, 0x2192, false},
+    {0x40, 0x0E, 0x0138, false},
+    {0x40, 0x0F, 0x0142, false},
+    {0x40, 0x10, 0x00B5, false},
+    {0x40, 0x11, 0x201D, false},
+    {0x40, 0x12, 0x00F8, false},
+    {0x40, 0x13, 0x00FE, false},
+    {0x40, 0x14, 0x002F, false},
+    {0x40, 0x15, 0x00AE, false},
+    {0x40, 0x16, 0x00DF, false},
+    {0x40, 0x17, 0x0167, false},
+    {0x40, 0x18, 0x2193, false},
+    {0x40, 0x19, 0x201E, false},
+    {0x40, 0x1A, 0x003F, false},
+    {0x40, 0x1B, 0x00BB, false},
+    {0x40, 0x1C, 0x2190, false},
+    {0x40, 0x1D, 0x00AB, false},
+    {0x40, 0x1E, 0x00B9, false},
+    {0x40, 0x1F, 0x00B2, false},
+    {0x40, 0x20, 0x00B3, false},
+    {0x40, 0x21, 0x00A3, false},
+    {0x40, 0x22, 0x00A2, false},
+    {0x40, 0x23, 0x00AC, false},
+    {0x40, 0x24, 0x007B, false},
+    {0x40, 0x25, 0x005B, false},
+    {0x40, 0x26, 0x005D, false},
+    {0x40, 0x27, 0x007D, false},
+    {0x40, 0x28, 0x000A, false},
+    {0x40, 0x2B, 0x0009, false},
+    {0x40, 0x2C, 0x0020, false},
+    {0x40, 0x2D, 0x005C, false},
+    {0x40, 0x2E, 0x00A7, false},
+    {0x40, 0x2F, 0x00B4, false},
+    {0x40, 0x30, 0x00AA, false},
+    {0x40, 0x31, 0x00BA, false},
+    {0x40, 0x32, 0x00BA, false},
+    {0x40, 0x33, 0x00B4, true},
+    {0x40, 0x34, 0x007E, false},
+    {0x40, 0x35, 0x00AC, false},
+    {0x40, 0x36, 0x2022, false},
+    {0x40, 0x37, 0x00B7, false},
+    {0x40, 0x54, 0x002F, false},
+    {0x40, 0x64, 0x02C7, true},
+    {0x42, 0x04, 0x00C6, false},
+    {0x42, 0x05, 0x2018, false},
+    {0x42, 0x06, 0x00A9, false},
+    {0x42, 0x07, 0x00D0, false},
+    {0x42, 0x08, 0x00B0, false},
+    {0x42, 0x09, 0x00AA, false},
+    {0x42, 0x0A, 0x014A, false},
+    {0x42, 0x0B, 0x0126, false},
+    {0x42, 0x0C, 0x0131, false},
+    {0x42, 0x0E, 0x0026, false},
+    {0x42, 0x0F, 0x0141, false},
+    {0x42, 0x10, 0x00B5, false},
+    {0x42, 0x11, 0x2019, false},
+    {0x42, 0x12, 0x00D8, false},
+    {0x42, 0x13, 0x00DE, false},
+    {0x42, 0x14, 0x002F, false},
+    {0x42, 0x15, 0x00AE, false},
+    {0x42, 0x16, 0x1E9E, false},
+    {0x42, 0x17, 0x0166, false},
+    {0x42, 0x18, 0x2191, false},
+    {0x42, 0x19, 0x201A, false},
+    {0x42, 0x1A, 0x003F, false},
+    {0x42, 0x1B, 0x003E, false},
+    {0x42, 0x1C, 0x00A5, false},
+    {0x42, 0x1D, 0x003C, false},
+    {0x42, 0x1E, 0x00A1, false},
+    {0x42, 0x1F, 0x00BD, false},
+    {0x42, 0x20, 0x00BE, false},
+    {0x42, 0x21, 0x00BC, false},
+    {0x42, 0x22, 0x215C, false},
+    {0x42, 0x23, 0x00A8, false},
+    {0x42, 0x24, 0x215E, false},
+    {0x42, 0x25, 0x2122, false},
+    {0x42, 0x26, 0x00B1, false},
+    {0x42, 0x27, 0x00B0, false},
+    {0x42, 0x28, 0x000A, false},
+    {0x42, 0x2C, 0x0020, false},
+    {0x42, 0x2D, 0x00BF, false},
+    {0x42, 0x2E, 0x02DB, true},
+    {0x42, 0x2F, 0x0060, false},
+    {0x42, 0x30, 0x00AF, true},
+    {0x42, 0x31, 0x00BA, false},
+    {0x42, 0x32, 0x00BA, false},
+    {0x42, 0x33, 0x02DD, true},
+    {0x42, 0x34, 0x005E, false},
+    {0x42, 0x35, 0x00AC, false},
+    {0x42, 0x36, 0x00D7, false},
+    {0x42, 0x37, 0x00F7, false},
+    {0x42, 0x38, 0x02D9, true},
+    {0x42, 0x54, 0x002F, false},
+    {0x42, 0x64, 0x02D8, true},
+};
+static const ReferenceCompose reference_portuguese_br_composed[] = {
+    {0x00, 0x2F, 0x0041, 0x00C1},
+    {0x00, 0x2F, 0x0043, 0x0106},
+    {0x00, 0x2F, 0x0045, 0x00C9},
+    {0x00, 0x2F, 0x0047, 0x01F4},
+    {0x00, 0x2F, 0x0049, 0x00CD},
+    {0x00, 0x2F, 0x004B, 0x1E30},
+    {0x00, 0x2F, 0x004C, 0x0139},
+    {0x00, 0x2F, 0x004D, 0x1E3E},
+    {0x00, 0x2F, 0x004E, 0x0143},
+    {0x00, 0x2F, 0x004F, 0x00D3},
+    {0x00, 0x2F, 0x0050, 0x1E54},
+    {0x00, 0x2F, 0x0052, 0x0154},
+    {0x00, 0x2F, 0x0053, 0x015A},
+    {0x00, 0x2F, 0x0055, 0x00DA},
+    {0x00, 0x2F, 0x0057, 0x1E82},
+    {0x00, 0x2F, 0x0059, 0x00DD},
+    {0x00, 0x2F, 0x005A, 0x0179},
+    {0x00, 0x2F, 0x0061, 0x00E1},
+    {0x00, 0x2F, 0x0063, 0x0107},
+    {0x00, 0x2F, 0x0065, 0x00E9},
+    {0x00, 0x2F, 0x0067, 0x01F5},
+    {0x00, 0x2F, 0x0069, 0x00ED},
+    {0x00, 0x2F, 0x006B, 0x1E31},
+    {0x00, 0x2F, 0x006C, 0x013A},
+    {0x00, 0x2F, 0x006D, 0x1E3F},
+    {0x00, 0x2F, 0x006E, 0x0144},
+    {0x00, 0x2F, 0x006F, 0x00F3},
+    {0x00, 0x2F, 0x0070, 0x1E55},
+    {0x00, 0x2F, 0x0072, 0x0155},
+    {0x00, 0x2F, 0x0073, 0x015B},
+    {0x00, 0x2F, 0x0075, 0x00FA},
+    {0x00, 0x2F, 0x0077, 0x1E83},
+    {0x00, 0x2F, 0x0079, 0x00FD},
+    {0x00, 0x2F, 0x007A, 0x017A},
+    {0x00, 0x2F, 0x00A8, 0x0385},
+    {0x00, 0x2F, 0x00C6, 0x01FC},
+    {0x00, 0x2F, 0x00C7, 0x1E08},
+    {0x00, 0x2F, 0x00D8, 0x01FE},
+    {0x00, 0x2F, 0x00E6, 0x01FD},
+    {0x00, 0x2F, 0x00E7, 0x1E09},
+    {0x00, 0x2F, 0x00F8, 0x01FF},
+    {0x00, 0x34, 0x0041, 0x00C3},
+    {0x00, 0x34, 0x0045, 0x1EBC},
+    {0x00, 0x34, 0x0049, 0x0128},
+    {0x00, 0x34, 0x004E, 0x00D1},
+    {0x00, 0x34, 0x004F, 0x00D5},
+    {0x00, 0x34, 0x0055, 0x0168},
+    {0x00, 0x34, 0x0056, 0x1E7C},
+    {0x00, 0x34, 0x0059, 0x1EF8},
+    {0x00, 0x34, 0x0061, 0x00E3},
+    {0x00, 0x34, 0x0065, 0x1EBD},
+    {0x00, 0x34, 0x0069, 0x0129},
+    {0x00, 0x34, 0x006E, 0x00F1},
+    {0x00, 0x34, 0x006F, 0x00F5},
+    {0x00, 0x34, 0x0075, 0x0169},
+    {0x00, 0x34, 0x0076, 0x1E7D},
+    {0x00, 0x34, 0x0079, 0x1EF9},
+    {0x02, 0x23, 0x0041, 0x00C4},
+    {0x02, 0x23, 0x0045, 0x00CB},
+    {0x02, 0x23, 0x0048, 0x1E26},
+    {0x02, 0x23, 0x0049, 0x00CF},
+    {0x02, 0x23, 0x004F, 0x00D6},
+    {0x02, 0x23, 0x0055, 0x00DC},
+    {0x02, 0x23, 0x0057, 0x1E84},
+    {0x02, 0x23, 0x0058, 0x1E8C},
+    {0x02, 0x23, 0x0059, 0x0178},
+    {0x02, 0x23, 0x0061, 0x00E4},
+    {0x02, 0x23, 0x0065, 0x00EB},
+    {0x02, 0x23, 0x0068, 0x1E27},
+    {0x02, 0x23, 0x0069, 0x00EF},
+    {0x02, 0x23, 0x006F, 0x00F6},
+    {0x02, 0x23, 0x0074, 0x1E97},
+    {0x02, 0x23, 0x0075, 0x00FC},
+    {0x02, 0x23, 0x0077, 0x1E85},
+    {0x02, 0x23, 0x0078, 0x1E8D},
+    {0x02, 0x23, 0x0079, 0x00FF},
+    {0x02, 0x2F, 0x0041, 0x00C0},
+    {0x02, 0x2F, 0x0045, 0x00C8},
+    {0x02, 0x2F, 0x0049, 0x00CC},
+    {0x02, 0x2F, 0x004E, 0x01F8},
+    {0x02, 0x2F, 0x004F, 0x00D2},
+    {0x02, 0x2F, 0x0055, 0x00D9},
+    {0x02, 0x2F, 0x0057, 0x1E80},
+    {0x02, 0x2F, 0x0059, 0x1EF2},
+    {0x02, 0x2F, 0x0061, 0x00E0},
+    {0x02, 0x2F, 0x0065, 0x00E8},
+    {0x02, 0x2F, 0x0069, 0x00EC},
+    {0x02, 0x2F, 0x006E, 0x01F9},
+    {0x02, 0x2F, 0x006F, 0x00F2},
+    {0x02, 0x2F, 0x0075, 0x00F9},
+    {0x02, 0x2F, 0x0077, 0x1E81},
+    {0x02, 0x2F, 0x0079, 0x1EF3},
+    {0x02, 0x2F, 0x00A8, 0x1FED},
+    {0x02, 0x34, 0x0041, 0x00C2},
+    {0x02, 0x34, 0x0043, 0x0108},
+    {0x02, 0x34, 0x0045, 0x00CA},
+    {0x02, 0x34, 0x0047, 0x011C},
+    {0x02, 0x34, 0x0048, 0x0124},
+    {0x02, 0x34, 0x0049, 0x00CE},
+    {0x02, 0x34, 0x004A, 0x0134},
+    {0x02, 0x34, 0x004F, 0x00D4},
+    {0x02, 0x34, 0x0053, 0x015C},
+    {0x02, 0x34, 0x0055, 0x00DB},
+    {0x02, 0x34, 0x0057, 0x0174},
+    {0x02, 0x34, 0x0059, 0x0176},
+    {0x02, 0x34, 0x005A, 0x1E90},
+    {0x02, 0x34, 0x0061, 0x00E2},
+    {0x02, 0x34, 0x0063, 0x0109},
+    {0x02, 0x34, 0x0065, 0x00EA},
+    {0x02, 0x34, 0x0067, 0x011D},
+    {0x02, 0x34, 0x0068, 0x0125},
+    {0x02, 0x34, 0x0069, 0x00EE},
+    {0x02, 0x34, 0x006A, 0x0135},
+    {0x02, 0x34, 0x006F, 0x00F4},
+    {0x02, 0x34, 0x0073, 0x015D},
+    {0x02, 0x34, 0x0075, 0x00FB},
+    {0x02, 0x34, 0x0077, 0x0175},
+    {0x02, 0x34, 0x0079, 0x0177},
+    {0x02, 0x34, 0x007A, 0x1E91},
+    {0x40, 0x33, 0x0041, 0x00C1},
+    {0x40, 0x33, 0x0043, 0x0106},
+    {0x40, 0x33, 0x0045, 0x00C9},
+    {0x40, 0x33, 0x0047, 0x01F4},
+    {0x40, 0x33, 0x0049, 0x00CD},
+    {0x40, 0x33, 0x004B, 0x1E30},
+    {0x40, 0x33, 0x004C, 0x0139},
+    {0x40, 0x33, 0x004D, 0x1E3E},
+    {0x40, 0x33, 0x004E, 0x0143},
+    {0x40, 0x33, 0x004F, 0x00D3},
+    {0x40, 0x33, 0x0050, 0x1E54},
+    {0x40, 0x33, 0x0052, 0x0154},
+    {0x40, 0x33, 0x0053, 0x015A},
+    {0x40, 0x33, 0x0055, 0x00DA},
+    {0x40, 0x33, 0x0057, 0x1E82},
+    {0x40, 0x33, 0x0059, 0x00DD},
+    {0x40, 0x33, 0x005A, 0x0179},
+    {0x40, 0x33, 0x0061, 0x00E1},
+    {0x40, 0x33, 0x0063, 0x0107},
+    {0x40, 0x33, 0x0065, 0x00E9},
+    {0x40, 0x33, 0x0067, 0x01F5},
+    {0x40, 0x33, 0x0069, 0x00ED},
+    {0x40, 0x33, 0x006B, 0x1E31},
+    {0x40, 0x33, 0x006C, 0x013A},
+    {0x40, 0x33, 0x006D, 0x1E3F},
+    {0x40, 0x33, 0x006E, 0x0144},
+    {0x40, 0x33, 0x006F, 0x00F3},
+    {0x40, 0x33, 0x0070, 0x1E55},
+    {0x40, 0x33, 0x0072, 0x0155},
+    {0x40, 0x33, 0x0073, 0x015B},
+    {0x40, 0x33, 0x0075, 0x00FA},
+    {0x40, 0x33, 0x0077, 0x1E83},
+    {0x40, 0x33, 0x0079, 0x00FD},
+    {0x40, 0x33, 0x007A, 0x017A},
+    {0x40, 0x33, 0x00A8, 0x0385},
+    {0x40, 0x33, 0x00C6, 0x01FC},
+    {0x40, 0x33, 0x00C7, 0x1E08},
+    {0x40, 0x33, 0x00D8, 0x01FE},
+    {0x40, 0x33, 0x00E6, 0x01FD},
+    {0x40, 0x33, 0x00E7, 0x1E09},
+    {0x40, 0x33, 0x00F8, 0x01FF},
+    {0x40, 0x64, 0x0041, 0x01CD},
+    {0x40, 0x64, 0x0043, 0x010C},
+    {0x40, 0x64, 0x0044, 0x010E},
+    {0x40, 0x64, 0x0045, 0x011A},
+    {0x40, 0x64, 0x0047, 0x01E6},
+    {0x40, 0x64, 0x0048, 0x021E},
+    {0x40, 0x64, 0x0049, 0x01CF},
+    {0x40, 0x64, 0x004B, 0x01E8},
+    {0x40, 0x64, 0x004C, 0x013D},
+    {0x40, 0x64, 0x004E, 0x0147},
+    {0x40, 0x64, 0x004F, 0x01D1},
+    {0x40, 0x64, 0x0052, 0x0158},
+    {0x40, 0x64, 0x0053, 0x0160},
+    {0x40, 0x64, 0x0054, 0x0164},
+    {0x40, 0x64, 0x0055, 0x01D3},
+    {0x40, 0x64, 0x005A, 0x017D},
+    {0x40, 0x64, 0x0061, 0x01CE},
+    {0x40, 0x64, 0x0063, 0x010D},
+    {0x40, 0x64, 0x0064, 0x010F},
+    {0x40, 0x64, 0x0065, 0x011B},
+    {0x40, 0x64, 0x0067, 0x01E7},
+    {0x40, 0x64, 0x0068, 0x021F},
+    {0x40, 0x64, 0x0069, 0x01D0},
+    {0x40, 0x64, 0x006A, 0x01F0},
+    {0x40, 0x64, 0x006B, 0x01E9},
+    {0x40, 0x64, 0x006C, 0x013E},
+    {0x40, 0x64, 0x006E, 0x0148},
+    {0x40, 0x64, 0x006F, 0x01D2},
+    {0x40, 0x64, 0x0072, 0x0159},
+    {0x40, 0x64, 0x0073, 0x0161},
+    {0x40, 0x64, 0x0074, 0x0165},
+    {0x40, 0x64, 0x0075, 0x01D4},
+    {0x40, 0x64, 0x007A, 0x017E},
+    {0x42, 0x2E, 0x0041, 0x0104},
+    {0x42, 0x2E, 0x0045, 0x0118},
+    {0x42, 0x2E, 0x0049, 0x012E},
+    {0x42, 0x2E, 0x004F, 0x01EA},
+    {0x42, 0x2E, 0x0055, 0x0172},
+    {0x42, 0x2E, 0x0061, 0x0105},
+    {0x42, 0x2E, 0x0065, 0x0119},
+    {0x42, 0x2E, 0x0069, 0x012F},
+    {0x42, 0x2E, 0x006F, 0x01EB},
+    {0x42, 0x2E, 0x0075, 0x0173},
+    {0x42, 0x30, 0x0041, 0x0100},
+    {0x42, 0x30, 0x0045, 0x0112},
+    {0x42, 0x30, 0x0047, 0x1E20},
+    {0x42, 0x30, 0x0049, 0x012A},
+    {0x42, 0x30, 0x004F, 0x014C},
+    {0x42, 0x30, 0x0055, 0x016A},
+    {0x42, 0x30, 0x0059, 0x0232},
+    {0x42, 0x30, 0x0061, 0x0101},
+    {0x42, 0x30, 0x0065, 0x0113},
+    {0x42, 0x30, 0x0067, 0x1E21},
+    {0x42, 0x30, 0x0069, 0x012B},
+    {0x42, 0x30, 0x006F, 0x014D},
+    {0x42, 0x30, 0x0075, 0x016B},
+    {0x42, 0x30, 0x0079, 0x0233},
+    {0x42, 0x30, 0x00C6, 0x01E2},
+    {0x42, 0x30, 0x00E6, 0x01E3},
+    {0x42, 0x33, 0x004F, 0x0150},
+    {0x42, 0x33, 0x0055, 0x0170},
+    {0x42, 0x33, 0x006F, 0x0151},
+    {0x42, 0x33, 0x0075, 0x0171},
+    {0x42, 0x38, 0x0041, 0x0226},
+    {0x42, 0x38, 0x0042, 0x1E02},
+    {0x42, 0x38, 0x0043, 0x010A},
+    {0x42, 0x38, 0x0044, 0x1E0A},
+    {0x42, 0x38, 0x0045, 0x0116},
+    {0x42, 0x38, 0x0046, 0x1E1E},
+    {0x42, 0x38, 0x0047, 0x0120},
+    {0x42, 0x38, 0x0048, 0x1E22},
+    {0x42, 0x38, 0x0049, 0x0130},
+    {0x42, 0x38, 0x004D, 0x1E40},
+    {0x42, 0x38, 0x004E, 0x1E44},
+    {0x42, 0x38, 0x004F, 0x022E},
+    {0x42, 0x38, 0x0050, 0x1E56},
+    {0x42, 0x38, 0x0052, 0x1E58},
+    {0x42, 0x38, 0x0053, 0x1E60},
+    {0x42, 0x38, 0x0054, 0x1E6A},
+    {0x42, 0x38, 0x0057, 0x1E86},
+    {0x42, 0x38, 0x0058, 0x1E8A},
+    {0x42, 0x38, 0x0059, 0x1E8E},
+    {0x42, 0x38, 0x005A, 0x017B},
+    {0x42, 0x38, 0x0061, 0x0227},
+    {0x42, 0x38, 0x0062, 0x1E03},
+    {0x42, 0x38, 0x0063, 0x010B},
+    {0x42, 0x38, 0x0064, 0x1E0B},
+    {0x42, 0x38, 0x0065, 0x0117},
+    {0x42, 0x38, 0x0066, 0x1E1F},
+    {0x42, 0x38, 0x0067, 0x0121},
+    {0x42, 0x38, 0x0068, 0x1E23},
+    {0x42, 0x38, 0x006D, 0x1E41},
+    {0x42, 0x38, 0x006E, 0x1E45},
+    {0x42, 0x38, 0x006F, 0x022F},
+    {0x42, 0x38, 0x0070, 0x1E57},
+    {0x42, 0x38, 0x0072, 0x1E59},
+    {0x42, 0x38, 0x0073, 0x1E61},
+    {0x42, 0x38, 0x0074, 0x1E6B},
+    {0x42, 0x38, 0x0077, 0x1E87},
+    {0x42, 0x38, 0x0078, 0x1E8B},
+    {0x42, 0x38, 0x0079, 0x1E8F},
+    {0x42, 0x38, 0x007A, 0x017C},
+    {0x42, 0x64, 0x0041, 0x0102},
+    {0x42, 0x64, 0x0045, 0x0114},
+    {0x42, 0x64, 0x0047, 0x011E},
+    {0x42, 0x64, 0x0049, 0x012C},
+    {0x42, 0x64, 0x004F, 0x014E},
+    {0x42, 0x64, 0x0055, 0x016C},
+    {0x42, 0x64, 0x0061, 0x0103},
+    {0x42, 0x64, 0x0065, 0x0115},
+    {0x42, 0x64, 0x0067, 0x011F},
+    {0x42, 0x64, 0x0069, 0x012D},
+    {0x42, 0x64, 0x006F, 0x014F},
+    {0x42, 0x64, 0x0075, 0x016D},
+};
+
+// Danish (DK), xkb "dk"
+static const ReferenceKey reference_danish_dk_keys[] = {
+    {0x00, 0x04, 0x0061, false},
+    {0x00, 0x05, 0x0062, false},
+    {0x00, 0x06, 0x0063, false},
+    {0x00, 0x07, 0x0064, false},
+    {0x00, 0x08, 0x0065, false},
+    {0x00, 0x09, 0x0066, false},
+    {0x00, 0x0A, 0x0067, false},
+    {0x00, 0x0B, 0x0068, false},
+    {0x00, 0x0C, 0x0069, false},
+    {0x00, 0x0D, 0x006A, false},
+    {0x00, 0x0E, 0x006B, false},
+    {0x00, 0x0F, 0x006C, false},
+    {0x00, 0x10, 0x006D, false},
+    {0x00, 0x11, 0x006E, false},
+    {0x00, 0x12, 0x006F, false},
+    {0x00, 0x13, 0x0070, false},
+    {0x00, 0x14, 0x0071, false},
+    {0x00, 0x15, 0x0072, false},
+    {0x00, 0x16, 0x0073, false},
+    {0x00, 0x17, 0x0074, false},
+    {0x00, 0x18, 0x0075, false},
+    {0x00, 0x19, 0x0076, false},
+    {0x00, 0x1A, 0x0077, false},
+    {0x00, 0x1B, 0x0078, false},
+    {0x00, 0x1C, 0x0079, false},
+    {0x00, 0x1D, 0x007A, false},
+    {0x00, 0x1E, 0x0031, false},
+    {0x00, 0x1F, 0x0032, false},
+    {0x00, 0x20, 0x0033, false},
+    {0x00, 0x21, 0x0034, false},
+    {0x00, 0x22, 0x0035, false},
+    {0x00, 0x23, 0x0036, false},
+    {0x00, 0x24, 0x0037, false},
+    {0x00, 0x25, 0x0038, false},
+    {0x00, 0x26, 0x0039, false},
+    {0x00, 0x27, 0x0030, false},
+    {0x00, 0x28, 0x000A, false},
+    {0x00, 0x2B, 0x0009, false},
+    {0x00, 0x2C, 0x0020, false},
+    {0x00, 0x2D, 0x002B, false},
+    {0x00, 0x2E, 0x00B4, true},
+    {0x00, 0x2F, 0x00E5, false},
+    {0x00, 0x30, 0x00A8, true},
+    {0x00, 0x31, 0x0027, false},
+    {0x00, 0x32, 0x0027, false},
+    {0x00, 0x33, 0x00E6, false},
+    {0x00, 0x34, 0x00F8, false},
+    {0x00, 0x35, 0x00BD, false},
+    {0x00, 0x36, 0x002C, false},
+    {0x00, 0x37, 0x002E, false},
+    {0x00, 0x38, 0x002D, false},
+    {0x00, 0x54, 0x002F, false},
+    {0x00, 0x64, 0x003C, false},
+    {0x02, 0x04, 0x0041, false},
+    {0x02, 0x05, 0x0042, false},
+    {0x02, 0x06, 0x0043, false},
+    {0x02, 0x07, 0x0044, false},
+    {0x02, 0x08, 0x0045, false},
+    {0x02, 0x09, 0x0046, false},
+    {0x02, 0x0A, 0x0047, false},
+    {0x02, 0x0B, 0x0048, false},
+    {0x02, 0x0C, 0x0049, false},
+    {0x02, 0x0D, 0x004A, false},
+    {0x02, 0x0E, 0x004B, false},
+    {0x02, 0x0F, 0x004C, false},
+    {0x02, 0x10, 0x004D, false},
+    {0x02, 0x11, 0x004E, false},
+    {0x02, 0x12, 0x004F, false},
+    {0x02, 0x13, 0x0050, false},
+    {0x02, 0x14, 0x0051, false},
+    {0x02, 0x15, 0x0052, false},
+    {0x02, 0x16, 0x0053, false},
+    {0x02, 0x17, 0x0054, false},
+    {0x02, 0x18, 0x0055, false},
+    {0x02, 0x19, 0x0056, false},
+    {0x02, 0x1A, 0x0057, false},
+    {0x02, 0x1B, 0x0058, false},
+    {0x02, 0x1C, 0x0059, false},
+    {0x02, 0x1D, 0x005A, false},
+    {0x02, 0x1E, 0x0021, false},
+    {0x02, 0x1F, 0x0022, false},
+    {0x02, 0x20, 0x0023, false},
+    {0x02, 0x21, 0x00A4, false},
+    {0x02, 0x22, 0x0025, false},
+    {0x02, 0x23, 0x0026, false},
+    {0x02, 0x24, 0x002F, false},
+    {0x02, 0x25, 0x0028, false},
+    {0x02, 0x26, 0x0029, false},
+    {0x02, 0x27, 0x003D, false},
+    {0x02, 0x28, 0x000A, false},
+    {0x02, 0x2C, 0x0020, false},
+    {0x02, 0x2D, 0x003F, false},
+    {0x02, 0x2E, 0x0060, true},
+    {0x02, 0x2F, 0x00C5, false},
+    {0x02, 0x30, 0x005E, true},
+    {0x02, 0x31, 0x002A, false},
+    {0x02, 0x32, 0x002A, false},
+    {0x02, 0x33, 0x00C6, false},
+    {0x02, 0x34, 0x00D8, false},
+    {0x02, 0x35, 0x00A7, false},
+    {0x02, 0x36, 0x003B, false},
+    {0x02, 0x37, 0x003A, false},
+    {0x02, 0x38, 0x005F, false},
+    {0x02, 0x54, 0x002F, false},
+    {0x02, 0x64, 0x003E, false},
+    {0x40, 0x04, 0x00AA, false},
+    {0x40, 0x05, 0x201C, false},
+    {0x40, 0x06, 0x00A9, false},
+    {0x40, 0x07, 0x00F0, false},
+    {0x40, 0x08, 0x20AC, false},
+    {0x40, 0x09, 0x0111, false},
+    {0x40, 0x0A, 0x014B, false},
+    {0x40, 0x0B, 0x0127, false},
+    {0x40, 0x0C, 0x2192, false},
+    {0x40, 0x0E, 0x0138, false},
+    {0x40, 0x0F, 0x0142, false},
+    {0x40, 0x10, 0x00B5, false},
+    {0x40, 0x11, 0x201D, false},
+    {0x40, 0x12, 0x0153, false},
+    {0x40, 0x13, 0x00FE, false},
+    {0x40, 0x14, 0x0040, false},
+    {0x40, 0x15, 0x00AE, false},
+    {0x40, 0x16, 0x00DF, false},
+    {0x40, 0x17, 0x00FE, false},
+    {0x40, 0x18, 0x2193, false},
+    {0x40, 0x19, 0x201E, false},
+    {0x40, 0x1A, 0x017F, false},
+    {0x40, 0x1B, 0x00BB, false},
+    {0x40, 0x1C, 0x2190, false},
+    {0x40, 0x1D, 0x00AB, false},
+    {0x40, 0x1E, 0x00A1, false},
+    {0x40, 0x1F, 0x0040, false},
+    {0x40, 0x20, 0x00A3, false},
+    {0x40, 0x21, 0x0024, false},
+    {0x40, 0x22, 0x00BD, false},
+    {0x40, 0x23, 0x00A5, false},
+    {0x40, 0x24, 0x007B, false},
+    {0x40, 0x25, 0x005B, false},
+    {0x40, 0x26, 0x005D, false},
+    {0x40, 0x27, 0x007D, false},
+    {0x40, 0x28, 0x000A, false},
+    {0x40, 0x2B, 0x0009, false},
+    {0x40, 0x2C, 0x0020, false},
+    {0x40, 0x2D, 0x00B1, false},
+    {0x40, 0x2E, 0x007C, false},
+    {0x40, 0x2F, 0x00A8, true},
+    {0x40, 0x30, 0x007E, true},
+    {0x40, 0x31, 0x02DD, true},
+    {0x40, 0x32, 0x02DD, true},
+    {0x40, 0x33, 0x00B4, true},
+    {0x40, 0x34, 0x005E, true},
+    {0x40, 0x35, 0x00BE, false},
+    {0x40, 0x36, 0x00B8, true},
+    {0x40, 0x37, 0x00B7, false},
+    {0x40, 0x54, 0x002F, false},
+    {0x40, 0x64, 0x005C, false},
+    {0x42, 0x04, 0x00BA, false},
+    {0x42, 0x05, 0x2018, false},
+    {0x42, 0x06, 0x00A9, false},
+    {0x42, 0x07, 0x00D0, false},
+    {0x42, 0x08, 0x00A2, false},
+    {0x42, 0x09, 0x00AA, false},
+    {0x42, 0x0A, 0x014A, false},
+    {0x42, 0x0B, 0x0126, false},
+    {0x42, 0x0C, 0x0131, false},
+    {0x42, 0x0E, 0x0026, false},
+    {0x42, 0x0F, 0x0141, false},
+    {0x42, 0x10, 0x00BA, false},
+    {0x42, 0x11, 0x2019, false},
+    {0x42, 0x12, 0x0152, false},
+    {0x42, 0x13, 0x00DE, false},
+    {0x42, 0x14, 0x03A9, false},
+    {0x42, 0x15, 0x00AE, false},
+    {0x42, 0x16, 0x1E9E, false},
+    {0x42, 0x17, 0x00DE, false},
+    {0x42, 0x18, 0x2191, false},
+    {0x42, 0x19, 0x201A, false},
+    {0x42, 0x1A, 0x00A7, false},
+    {0x42, 0x1B, 0x003E, false},
+    {0x42, 0x1C, 0x00A5, false},
+    {0x42, 0x1D, 0x003C, false},
+    {0x42, 0x1E, 0x00B9, false},
+    {0x42, 0x1F, 0x00B2, false},
+    {0x42, 0x20, 0x00B3, false},
+    {0x42, 0x21, 0x00BC, false},
+    {0x42, 0x22, 0x00A2, false},
+    {0x42, 0x23, 0x215D, false},
+    {0x42, 0x24, 0x00F7, false},
+    {0x42, 0x25, 0x00AB, false},
+    {0x42, 0x26, 0x00BB, false},
+    {0x42, 0x27, 0x00B0, false},
+    {0x42, 0x28, 0x000A, false},
+    {0x42, 0x2C, 0x0020, false},
+    {0x42, 0x2D, 0x00BF, false},
+    {0x42, 0x2E, 0x00A6, false},
+    {0x42, 0x2F, 0x02DA, true},
+    {0x42, 0x30, 0x02C7, true},
+    {0x42, 0x31, 0x00D7, false},
+    {0x42, 0x32, 0x00D7, false},
+    {0x42, 0x33, 0x02DD, true},
+    {0x42, 0x34, 0x02C7, true},
+    {0x42, 0x35, 0x00B6, false},
+    {0x42, 0x36, 0x02DB, true},
+    {0x42, 0x37, 0x02D9, true},
+    {0x42, 0x38, 0x02D9, true},
+    {0x42, 0x54, 0x002F, false},
+    {0x42, 0x64, 0x00AC, false},
+};
+static const ReferenceCompose reference_danish_dk_composed[] = {
+    {0x00, 0x2E, 0x0041, 0x00C1},
+    {0x00, 0x2E, 0x0043, 0x0106},
+    {0x00, 0x2E, 0x0045, 0x00C9},
+    {0x00, 0x2E, 0x0047, 0x01F4},
+    {0x00, 0x2E, 0x0049, 0x00CD},
+    {0x00, 0x2E, 0x004B, 0x1E30},
+    {0x00, 0x2E, 0x004C, 0x0139},
+    {0x00, 0x2E, 0x004D, 0x1E3E},
+    {0x00, 0x2E, 0x004E, 0x0143},
+    {0x00, 0x2E, 0x004F, 0x00D3},
+    {0x00, 0x2E, 0x0050, 0x1E54},
+    {0x00, 0x2E, 0x0052, 0x0154},
+    {0x00, 0x2E, 0x0053, 0x015A},
+    {0x00, 0x2E, 0x0055, 0x00DA},
+    {0x00, 0x2E, 0x0057, 0x1E82},
+    {0x00, 0x2E, 0x0059, 0x00DD},
+    {0x00, 0x2E, 0x005A, 0x0179},
+    {0x00, 0x2E, 0x0061, 0x00E1},
+    {0x00, 0x2E, 0x0063, 0x0107},
+    {0x00, 0x2E, 0x0065, 0x00E9},
+    {0x00, 0x2E, 0x0067, 0x01F5},
+    {0x00, 0x2E, 0x0069, 0x00ED},
+    {0x00, 0x2E, 0x006B, 0x1E31},
+    {0x00, 0x2E, 0x006C, 0x013A},
+    {0x00, 0x2E, 0x006D, 0x1E3F},
+    {0x00, 0x2E, 0x006E, 0x0144},
+    {0x00, 0x2E, 0x006F, 0x00F3},
+    {0x00, 0x2E, 0x0070, 0x1E55},
+    {0x00, 0x2E, 0x0072, 0x0155},
+    {0x00, 0x2E, 0x0073, 0x015B},
+    {0x00, 0x2E, 0x0075, 0x00FA},
+    {0x00, 0x2E, 0x0077, 0x1E83},
+    {0x00, 0x2E, 0x0079, 0x00FD},
+    {0x00, 0x2E, 0x007A, 0x017A},
+    {0x00, 0x2E, 0x00C5, 0x01FA},
+    {0x00, 0x2E, 0x00C6, 0x01FC},
+    {0x00, 0x2E, 0x00D8, 0x01FE},
+    {0x00, 0x2E, 0x00E5, 0x01FB},
+    {0x00, 0x2E, 0x00E6, 0x01FD},
+    {0x00, 0x2E, 0x00F8, 0x01FF},
+    {0x00, 0x2E, 0x03A9, 0x038F},
+    {0x00, 0x30, 0x0041, 0x00C4},
+    {0x00, 0x30, 0x0045, 0x00CB},
+    {0x00, 0x30, 0x0048, 0x1E26},
+    {0x00, 0x30, 0x0049, 0x00CF},
+    {0x00, 0x30, 0x004F, 0x00D6},
+    {0x00, 0x30, 0x0055, 0x00DC},
+    {0x00, 0x30, 0x0057, 0x1E84},
+    {0x00, 0x30, 0x0058, 0x1E8C},
+    {0x00, 0x30, 0x0059, 0x0178},
+    {0x00, 0x30, 0x0061, 0x00E4},
+    {0x00, 0x30, 0x0065, 0x00EB},
+    {0x00, 0x30, 0x0068, 0x1E27},
+    {0x00, 0x30, 0x0069, 0x00EF},
+    {0x00, 0x30, 0x006F, 0x00F6},
+    {0x00, 0x30, 0x0074, 0x1E97},
+    {0x00, 0x30, 0x0075, 0x00FC},
+    {0x00, 0x30, 0x0077, 0x1E85},
+    {0x00, 0x30, 0x0078, 0x1E8D},
+    {0x00, 0x30, 0x0079, 0x00FF},
+    {0x02, 0x2E, 0x0041, 0x00C0},
+    {0x02, 0x2E, 0x0045, 0x00C8},
+    {0x02, 0x2E, 0x0049, 0x00CC},
+    {0x02, 0x2E, 0x004E, 0x01F8},
+    {0x02, 0x2E, 0x004F, 0x00D2},
+    {0x02, 0x2E, 0x0055, 0x00D9},
+    {0x02, 0x2E, 0x0057, 0x1E80},
+    {0x02, 0x2E, 0x0059, 0x1EF2},
+    {0x02, 0x2E, 0x0061, 0x00E0},
+    {0x02, 0x2E, 0x0065, 0x00E8},
+    {0x02, 0x2E, 0x0069, 0x00EC},
+    {0x02, 0x2E, 0x006E, 0x01F9},
+    {0x02, 0x2E, 0x006F, 0x00F2},
+    {0x02, 0x2E, 0x0075, 0x00F9},
+    {0x02, 0x2E, 0x0077, 0x1E81},
+    {0x02, 0x2E, 0x0079, 0x1EF3},
+    {0x02, 0x2E, 0x03A9, 0x1FFA},
+    {0x02, 0x30, 0x0041, 0x00C2},
+    {0x02, 0x30, 0x0043, 0x0108},
+    {0x02, 0x30, 0x0045, 0x00CA},
+    {0x02, 0x30, 0x0047, 0x011C},
+    {0x02, 0x30, 0x0048, 0x0124},
+    {0x02, 0x30, 0x0049, 0x00CE},
+    {0x02, 0x30, 0x004A, 0x0134},
+    {0x02, 0x30, 0x004F, 0x00D4},
+    {0x02, 0x30, 0x0053, 0x015C},
+    {0x02, 0x30, 0x0055, 0x00DB},
+    {0x02, 0x30, 0x0057, 0x0174},
+    {0x02, 0x30, 0x0059, 0x0176},
+    {0x02, 0x30, 0x005A, 0x1E90},
+    {0x02, 0x30, 0x0061, 0x00E2},
+    {0x02, 0x30, 0x0063, 0x0109},
+    {0x02, 0x30, 0x0065, 0x00EA},
+    {0x02, 0x30, 0x0067, 0x011D},
+    {0x02, 0x30, 0x0068, 0x0125},
+    {0x02, 0x30, 0x0069, 0x00EE},
+    {0x02, 0x30, 0x006A, 0x0135},
+    {0x02, 0x30, 0x006F, 0x00F4},
+    {0x02, 0x30, 0x0073, 0x015D},
+    {0x02, 0x30, 0x0075, 0x00FB},
+    {0x02, 0x30, 0x0077, 0x0175},
+    {0x02, 0x30, 0x0079, 0x0177},
+    {0x02, 0x30, 0x007A, 0x1E91},
+    {0x40, 0x2F, 0x0041, 0x00C4},
+    {0x40, 0x2F, 0x0045, 0x00CB},
+    {0x40, 0x2F, 0x0048, 0x1E26},
+    {0x40, 0x2F, 0x0049, 0x00CF},
+    {0x40, 0x2F, 0x004F, 0x00D6},
+    {0x40, 0x2F, 0x0055, 0x00DC},
+    {0x40, 0x2F, 0x0057, 0x1E84},
+    {0x40, 0x2F, 0x0058, 0x1E8C},
+    {0x40, 0x2F, 0x0059, 0x0178},
+    {0x40, 0x2F, 0x0061, 0x00E4},
+    {0x40, 0x2F, 0x0065, 0x00EB},
+    {0x40, 0x2F, 0x0068, 0x1E27},
+    {0x40, 0x2F, 0x0069, 0x00EF},
+    {0x40, 0x2F, 0x006F, 0x00F6},
+    {0x40, 0x2F, 0x0074, 0x1E97},
+    {0x40, 0x2F, 0x0075, 0x00FC},
+    {0x40, 0x2F, 0x0077, 0x1E85},
+    {0x40, 0x2F, 0x0078, 0x1E8D},
+    {0x40, 0x2F, 0x0079, 0x00FF},
+    {0x40, 0x30, 0x0041, 0x00C3},
+    {0x40, 0x30, 0x0045, 0x1EBC},
+    {0x40, 0x30, 0x0049, 0x0128},
+    {0x40, 0x30, 0x004E, 0x00D1},
+    {0x40, 0x30, 0x004F, 0x00D5},
+    {0x40, 0x30, 0x0055, 0x0168},
+    {0x40, 0x30, 0x0056, 0x1E7C},
+    {0x40, 0x30, 0x0059, 0x1EF8},
+    {0x40, 0x30, 0x0061, 0x00E3},
+    {0x40, 0x30, 0x0065, 0x1EBD},
+    {0x40, 0x30, 0x0069, 0x0129},
+    {0x40, 0x30, 0x006E, 0x00F1},
+    {0x40, 0x30, 0x006F, 0x00F5},
+    {0x40, 0x30, 0x0075, 0x0169},
+    {0x40, 0x30, 0x0076, 0x1E7D},
+    {0x40, 0x30, 0x0079, 0x1EF9},
+    {0x40, 0x31, 0x004F, 0x0150},
+    {0x40, 0x31, 0x0055, 0x0170},
+    {0x40, 0x31, 0x006F, 0x0151},
+    {0x40, 0x31, 0x0075, 0x0171},
+    {0x40, 0x32, 0x004F, 0x0150},
+    {0x40, 0x32, 0x0055, 0x0170},
+    {0x40, 0x32, 0x006F, 0x0151},
+    {0x40, 0x32, 0x0075, 0x0171},
+    {0x40, 0x33, 0x0041, 0x00C1},
+    {0x40, 0x33, 0x0043, 0x0106},
+    {0x40, 0x33, 0x0045, 0x00C9},
+    {0x40, 0x33, 0x0047, 0x01F4},
+    {0x40, 0x33, 0x0049, 0x00CD},
+    {0x40, 0x33, 0x004B, 0x1E30},
+    {0x40, 0x33, 0x004C, 0x0139},
+    {0x40, 0x33, 0x004D, 0x1E3E},
+    {0x40, 0x33, 0x004E, 0x0143},
+    {0x40, 0x33, 0x004F, 0x00D3},
+    {0x40, 0x33, 0x0050, 0x1E54},
+    {0x40, 0x33, 0x0052, 0x0154},
+    {0x40, 0x33, 0x0053, 0x015A},
+    {0x40, 0x33, 0x0055, 0x00DA},
+    {0x40, 0x33, 0x0057, 0x1E82},
+    {0x40, 0x33, 0x0059, 0x00DD},
+    {0x40, 0x33, 0x005A, 0x0179},
+    {0x40, 0x33, 0x0061, 0x00E1},
+    {0x40, 0x33, 0x0063, 0x0107},
+    {0x40, 0x33, 0x0065, 0x00E9},
+    {0x40, 0x33, 0x0067, 0x01F5},
+    {0x40, 0x33, 0x0069, 0x00ED},
+    {0x40, 0x33, 0x006B, 0x1E31},
+    {0x40, 0x33, 0x006C, 0x013A},
+    {0x40, 0x33, 0x006D, 0x1E3F},
+    {0x40, 0x33, 0x006E, 0x0144},
+    {0x40, 0x33, 0x006F, 0x00F3},
+    {0x40, 0x33, 0x0070, 0x1E55},
+    {0x40, 0x33, 0x0072, 0x0155},
+    {0x40, 0x33, 0x0073, 0x015B},
+    {0x40, 0x33, 0x0075, 0x00FA},
+    {0x40, 0x33, 0x0077, 0x1E83},
+    {0x40, 0x33, 0x0079, 0x00FD},
+    {0x40, 0x33, 0x007A, 0x017A},
+    {0x40, 0x33, 0x00C5, 0x01FA},
+    {0x40, 0x33, 0x00C6, 0x01FC},
+    {0x40, 0x33, 0x00D8, 0x01FE},
+    {0x40, 0x33, 0x00E5, 0x01FB},
+    {0x40, 0x33, 0x00E6, 0x01FD},
+    {0x40, 0x33, 0x00F8, 0x01FF},
+    {0x40, 0x33, 0x03A9, 0x038F},
+    {0x40, 0x34, 0x0041, 0x00C2},
+    {0x40, 0x34, 0x0043, 0x0108},
+    {0x40, 0x34, 0x0045, 0x00CA},
+    {0x40, 0x34, 0x0047, 0x011C},
+    {0x40, 0x34, 0x0048, 0x0124},
+    {0x40, 0x34, 0x0049, 0x00CE},
+    {0x40, 0x34, 0x004A, 0x0134},
+    {0x40, 0x34, 0x004F, 0x00D4},
+    {0x40, 0x34, 0x0053, 0x015C},
+    {0x40, 0x34, 0x0055, 0x00DB},
+    {0x40, 0x34, 0x0057, 0x0174},
+    {0x40, 0x34, 0x0059, 0x0176},
+    {0x40, 0x34, 0x005A, 0x1E90},
+    {0x40, 0x34, 0x0061, 0x00E2},
+    {0x40, 0x34, 0x0063, 0x0109},
+    {0x40, 0x34, 0x0065, 0x00EA},
+    {0x40, 0x34, 0x0067, 0x011D},
+    {0x40, 0x34, 0x0068, 0x0125},
+    {0x40, 0x34, 0x0069, 0x00EE},
+    {0x40, 0x34, 0x006A, 0x0135},
+    {0x40, 0x34, 0x006F, 0x00F4},
+    {0x40, 0x34, 0x0073, 0x015D},
+    {0x40, 0x34, 0x0075, 0x00FB},
+    {0x40, 0x34, 0x0077, 0x0175},
+    {0x40, 0x34, 0x0079, 0x0177},
+    {0x40, 0x34, 0x007A, 0x1E91},
+    {0x40, 0x36, 0x0043, 0x00C7},
+    {0x40, 0x36, 0x0044, 0x1E10},
+    {0x40, 0x36, 0x0045, 0x0228},
+    {0x40, 0x36, 0x0047, 0x0122},
+    {0x40, 0x36, 0x0048, 0x1E28},
+    {0x40, 0x36, 0x004B, 0x0136},
+    {0x40, 0x36, 0x004C, 0x013B},
+    {0x40, 0x36, 0x004E, 0x0145},
+    {0x40, 0x36, 0x0052, 0x0156},
+    {0x40, 0x36, 0x0053, 0x015E},
+    {0x40, 0x36, 0x0054, 0x0162},
+    {0x40, 0x36, 0x0063, 0x00E7},
+    {0x40, 0x36, 0x0064, 0x1E11},
+    {0x40, 0x36, 0x0065, 0x0229},
+    {0x40, 0x36, 0x0067, 0x0123},
+    {0x40, 0x36, 0x0068, 0x1E29},
+    {0x40, 0x36, 0x006B, 0x0137},
+    {0x40, 0x36, 0x006C, 0x013C},
+    {0x40, 0x36, 0x006E, 0x0146},
+    {0x40, 0x36, 0x0072, 0x0157},
+    {0x40, 0x36, 0x0073, 0x015F},
+    {0x40, 0x36, 0x0074, 0x0163},
+    {0x42, 0x2F, 0x0041, 0x00C5},
+    {0x42, 0x2F, 0x0055, 0x016E},
+    {0x42, 0x2F, 0x0061, 0x00E5},
+    {0x42, 0x2F, 0x0075, 0x016F},
+    {0x42, 0x2F, 0x0077, 0x1E98},
+    {0x42, 0x2F, 0x0079, 0x1E99},
+    {0x42, 0x30, 0x0041, 0x01CD},
+    {0x42, 0x30, 0x0043, 0x010C},
+    {0x42, 0x30, 0x0044, 0x010E},
+    {0x42, 0x30, 0x0045, 0x011A},
+    {0x42, 0x30, 0x0047, 0x01E6},
+    {0x42, 0x30, 0x0048, 0x021E},
+    {0x42, 0x30, 0x0049, 0x01CF},
+    {0x42, 0x30, 0x004B, 0x01E8},
+    {0x42, 0x30, 0x004C, 0x013D},
+    {0x42, 0x30, 0x004E, 0x0147},
+    {0x42, 0x30, 0x004F, 0x01D1},
+    {0x42, 0x30, 0x0052, 0x0158},
+    {0x42, 0x30, 0x0053, 0x0160},
+    {0x42, 0x30, 0x0054, 0x0164},
+    {0x42, 0x30, 0x0055, 0x01D3},
+    {0x42, 0x30, 0x005A, 0x017D},
+    {0x42, 0x30, 0x0061, 0x01CE},
+    {0x42, 0x30, 0x0063, 0x010D},
+    {0x42, 0x30, 0x0064, 0x010F},
+    {0x42, 0x30, 0x0065, 0x011B},
+    {0x42, 0x30, 0x0067, 0x01E7},
+    {0x42, 0x30, 0x0068, 0x021F},
+    {0x42, 0x30, 0x0069, 0x01D0},
+    {0x42, 0x30, 0x006A, 0x01F0},
+    {0x42, 0x30, 0x006B, 0x01E9},
+    {0x42, 0x30, 0x006C, 0x013E},
+    {0x42, 0x30, 0x006E, 0x0148},
+    {0x42, 0x30, 0x006F, 0x01D2},
+    {0x42, 0x30, 0x0072, 0x0159},
+    {0x42, 0x30, 0x0073, 0x0161},
+    {0x42, 0x30, 0x0074, 0x0165},
+    {0x42, 0x30, 0x0075, 0x01D4},
+    {0x42, 0x30, 0x007A, 0x017E},
+    {0x42, 0x33, 0x004F, 0x0150},
+    {0x42, 0x33, 0x0055, 0x0170},
+    {0x42, 0x33, 0x006F, 0x0151},
+    {0x42, 0x33, 0x0075, 0x0171},
+    {0x42, 0x34, 0x0041, 0x01CD},
+    {0x42, 0x34, 0x0043, 0x010C},
+    {0x42, 0x34, 0x0044, 0x010E},
+    {0x42, 0x34, 0x0045, 0x011A},
+    {0x42, 0x34, 0x0047, 0x01E6},
+    {0x42, 0x34, 0x0048, 0x021E},
+    {0x42, 0x34, 0x0049, 0x01CF},
+    {0x42, 0x34, 0x004B, 0x01E8},
+    {0x42, 0x34, 0x004C, 0x013D},
+    {0x42, 0x34, 0x004E, 0x0147},
+    {0x42, 0x34, 0x004F, 0x01D1},
+    {0x42, 0x34, 0x0052, 0x0158},
+    {0x42, 0x34, 0x0053, 0x0160},
+    {0x42, 0x34, 0x0054, 0x0164},
+    {0x42, 0x34, 0x0055, 0x01D3},
+    {0x42, 0x34, 0x005A, 0x017D},
+    {0x42, 0x34, 0x0061, 0x01CE},
+    {0x42, 0x34, 0x0063, 0x010D},
+    {0x42, 0x34, 0x0064, 0x010F},
+    {0x42, 0x34, 0x0065, 0x011B},
+    {0x42, 0x34, 0x0067, 0x01E7},
+    {0x42, 0x34, 0x0068, 0x021F},
+    {0x42, 0x34, 0x0069, 0x01D0},
+    {0x42, 0x34, 0x006A, 0x01F0},
+    {0x42, 0x34, 0x006B, 0x01E9},
+    {0x42, 0x34, 0x006C, 0x013E},
+    {0x42, 0x34, 0x006E, 0x0148},
+    {0x42, 0x34, 0x006F, 0x01D2},
+    {0x42, 0x34, 0x0072, 0x0159},
+    {0x42, 0x34, 0x0073, 0x0161},
+    {0x42, 0x34, 0x0074, 0x0165},
+    {0x42, 0x34, 0x0075, 0x01D4},
+    {0x42, 0x34, 0x007A, 0x017E},
+    {0x42, 0x36, 0x0041, 0x0104},
+    {0x42, 0x36, 0x0045, 0x0118},
+    {0x42, 0x36, 0x0049, 0x012E},
+    {0x42, 0x36, 0x004F, 0x01EA},
+    {0x42, 0x36, 0x0055, 0x0172},
+    {0x42, 0x36, 0x0061, 0x0105},
+    {0x42, 0x36, 0x0065, 0x0119},
+    {0x42, 0x36, 0x0069, 0x012F},
+    {0x42, 0x36, 0x006F, 0x01EB},
+    {0x42, 0x36, 0x0075, 0x0173},
+    {0x42, 0x37, 0x0041, 0x0226},
+    {0x42, 0x37, 0x0042, 0x1E02},
+    {0x42, 0x37, 0x0043, 0x010A},
+    {0x42, 0x37, 0x0044, 0x1E0A},
+    {0x42, 0x37, 0x0045, 0x0116},
+    {0x42, 0x37, 0x0046, 0x1E1E},
+    {0x42, 0x37, 0x0047, 0x0120},
+    {0x42, 0x37, 0x0048, 0x1E22},
+    {0x42, 0x37, 0x0049, 0x0130},
+    {0x42, 0x37, 0x004D, 0x1E40},
+    {0x42, 0x37, 0x004E, 0x1E44},
+    {0x42, 0x37, 0x004F, 0x022E},
+    {0x42, 0x37, 0x0050, 0x1E56},
+    {0x42, 0x37, 0x0052, 0x1E58},
+    {0x42, 0x37, 0x0053, 0x1E60},
+    {0x42, 0x37, 0x0054, 0x1E6A},
+    {0x42, 0x37, 0x0057, 0x1E86},
+    {0x42, 0x37, 0x0058, 0x1E8A},
+    {0x42, 0x37, 0x0059, 0x1E8E},
+    {0x42, 0x37, 0x005A, 0x017B},
+    {0x42, 0x37, 0x0061, 0x0227},
+    {0x42, 0x37, 0x0062, 0x1E03},
+    {0x42, 0x37, 0x0063, 0x010B},
+    {0x42, 0x37, 0x0064, 0x1E0B},
+    {0x42, 0x37, 0x0065, 0x0117},
+    {0x42, 0x37, 0x0066, 0x1E1F},
+    {0x42, 0x37, 0x0067, 0x0121},
+    {0x42, 0x37, 0x0068, 0x1E23},
+    {0x42, 0x37, 0x006D, 0x1E41},
+    {0x42, 0x37, 0x006E, 0x1E45},
+    {0x42, 0x37, 0x006F, 0x022F},
+    {0x42, 0x37, 0x0070, 0x1E57},
+    {0x42, 0x37, 0x0072, 0x1E59},
+    {0x42, 0x37, 0x0073, 0x1E61},
+    {0x42, 0x37, 0x0074, 0x1E6B},
+    {0x42, 0x37, 0x0077, 0x1E87},
+    {0x42, 0x37, 0x0078, 0x1E8B},
+    {0x42, 0x37, 0x0079, 0x1E8F},
+    {0x42, 0x37, 0x007A, 0x017C},
+    {0x42, 0x37, 0x017F, 0x1E9B},
+    {0x42, 0x38, 0x0041, 0x0226},
+    {0x42, 0x38, 0x0042, 0x1E02},
+    {0x42, 0x38, 0x0043, 0x010A},
+    {0x42, 0x38, 0x0044, 0x1E0A},
+    {0x42, 0x38, 0x0045, 0x0116},
+    {0x42, 0x38, 0x0046, 0x1E1E},
+    {0x42, 0x38, 0x0047, 0x0120},
+    {0x42, 0x38, 0x0048, 0x1E22},
+    {0x42, 0x38, 0x0049, 0x0130},
+    {0x42, 0x38, 0x004D, 0x1E40},
+    {0x42, 0x38, 0x004E, 0x1E44},
+    {0x42, 0x38, 0x004F, 0x022E},
+    {0x42, 0x38, 0x0050, 0x1E56},
+    {0x42, 0x38, 0x0052, 0x1E58},
+    {0x42, 0x38, 0x0053, 0x1E60},
+    {0x42, 0x38, 0x0054, 0x1E6A},
+    {0x42, 0x38, 0x0057, 0x1E86},
+    {0x42, 0x38, 0x0058, 0x1E8A},
+    {0x42, 0x38, 0x0059, 0x1E8E},
+    {0x42, 0x38, 0x005A, 0x017B},
+    {0x42, 0x38, 0x0061, 0x0227},
+    {0x42, 0x38, 0x0062, 0x1E03},
+    {0x42, 0x38, 0x0063, 0x010B},
+    {0x42, 0x38, 0x0064, 0x1E0B},
+    {0x42, 0x38, 0x0065, 0x0117},
+    {0x42, 0x38, 0x0066, 0x1E1F},
+    {0x42, 0x38, 0x0067, 0x0121},
+    {0x42, 0x38, 0x0068, 0x1E23},
+    {0x42, 0x38, 0x006D, 0x1E41},
+    {0x42, 0x38, 0x006E, 0x1E45},
+    {0x42, 0x38, 0x006F, 0x022F},
+    {0x42, 0x38, 0x0070, 0x1E57},
+    {0x42, 0x38, 0x0072, 0x1E59},
+    {0x42, 0x38, 0x0073, 0x1E61},
+    {0x42, 0x38, 0x0074, 0x1E6B},
+    {0x42, 0x38, 0x0077, 0x1E87},
+    {0x42, 0x38, 0x0078, 0x1E8B},
+    {0x42, 0x38, 0x0079, 0x1E8F},
+    {0x42, 0x38, 0x007A, 0x017C},
+    {0x42, 0x38, 0x017F, 0x1E9B},
+};
+
+// Swedish (SE), xkb "se"
+static const ReferenceKey reference_swedish_se_keys[] = {
+    {0x00, 0x04, 0x0061, false},
+    {0x00, 0x05, 0x0062, false},
+    {0x00, 0x06, 0x0063, false},
+    {0x00, 0x07, 0x0064, false},
+    {0x00, 0x08, 0x0065, false},
+    {0x00, 0x09, 0x0066, false},
+    {0x00, 0x0A, 0x0067, false},
+    {0x00, 0x0B, 0x0068, false},
+    {0x00, 0x0C, 0x0069, false},
+    {0x00, 0x0D, 0x006A, false},
+    {0x00, 0x0E, 0x006B, false},
+    {0x00, 0x0F, 0x006C, false},
+    {0x00, 0x10, 0x006D, false},
+    {0x00, 0x11, 0x006E, false},
+    {0x00, 0x12, 0x006F, false},
+    {0x00, 0x13, 0x0070, false},
+    {0x00, 0x14, 0x0071, false},
+    {0x00, 0x15, 0x0072, false},
+    {0x00, 0x16, 0x0073, false},
+    {0x00, 0x17, 0x0074, false},
+    {0x00, 0x18, 0x0075, false},
+    {0x00, 0x19, 0x0076, false},
+    {0x00, 0x1A, 0x0077, false},
+    {0x00, 0x1B, 0x0078, false},
+    {0x00, 0x1C, 0x0079, false},
+    {0x00, 0x1D, 0x007A, false},
+    {0x00, 0x1E, 0x0031, false},
+    {0x00, 0x1F, 0x0032, false},
+    {0x00, 0x20, 0x0033, false},
+    {0x00, 0x21, 0x0034, false},
+    {0x00, 0x22, 0x0035, false},
+    {0x00, 0x23, 0x0036, false},
+    {0x00, 0x24, 0x0037, false},
+    {0x00, 0x25, 0x0038, false},
+    {0x00, 0x26, 0x0039, false},
+    {0x00, 0x27, 0x0030, false},
+    {0x00, 0x28, 0x000A, false},
+    {0x00, 0x2B, 0x0009, false},
+    {0x00, 0x2C, 0x0020, false},
+    {0x00, 0x2D, 0x002B, false},
+    {0x00, 0x2E, 0x00B4, true},
+    {0x00, 0x2F, 0x00E5, false},
+    {0x00, 0x30, 0x00A8, true},
+    {0x00, 0x31, 0x0027, false},
+    {0x00, 0x32, 0x0027, false},
+    {0x00, 0x33, 0x00F6, false},
+    {0x00, 0x34, 0x00E4, false},
+    {0x00, 0x35, 0x00A7, false},
+    {0x00, 0x36, 0x002C, false},
+    {0x00, 0x37, 0x002E, false},
+    {0x00, 0x38, 0x002D, false},
+    {0x00, 0x54, 0x002F, false},
+    {0x00, 0x64, 0x003C, false},
+    {0x02, 0x04, 0x0041, false},
+    {0x02, 0x05, 0x0042, false},
+    {0x02, 0x06, 0x0043, false},
+    {0x02, 0x07, 0x0044, false},
+    {0x02, 0x08, 0x0045, false},
+    {0x02, 0x09, 0x0046, false},
+    {0x02, 0x0A, 0x0047, false},
+    {0x02, 0x0B, 0x0048, false},
+    {0x02, 0x0C, 0x0049, false},
+    {0x02, 0x0D, 0x004A, false},
+    {0x02, 0x0E, 0x004B, false},
+    {0x02, 0x0F, 0x004C, false},
+    {0x02, 0x10, 0x004D, false},
+    {0x02, 0x11, 0x004E, false},
+    {0x02, 0x12, 0x004F, false},
+    {0x02, 0x13, 0x0050, false},
+    {0x02, 0x14, 0x0051, false},
+    {0x02, 0x15, 0x0052, false},
+    {0x02, 0x16, 0x0053, false},
+    {0x02, 0x17, 0x0054, false},
+    {0x02, 0x18, 0x0055, false},
+    {0x02, 0x19, 0x0056, false},
+    {0x02, 0x1A, 0x0057, false},
+    {0x02, 0x1B, 0x0058, false},
+    {0x02, 0x1C, 0x0059, false},
+    {0x02, 0x1D, 0x005A, false},
+    {0x02, 0x1E, 0x0021, false},
+    {0x02, 0x1F, 0x0022, false},
+    {0x02, 0x20, 0x0023, false},
+    {0x02, 0x21, 0x00A4, false},
+    {0x02, 0x22, 0x0025, false},
+    {0x02, 0x23, 0x0026, false},
+    {0x02, 0x24, 0x002F, false},
+    {0x02, 0x25, 0x0028, false},
+    {0x02, 0x26, 0x0029, false},
+    {0x02, 0x27, 0x003D, false},
+    {0x02, 0x28, 0x000A, false},
+    {0x02, 0x2C, 0x0020, false},
+    {0x02, 0x2D, 0x003F, false},
+    {0x02, 0x2E, 0x0060, true},
+    {0x02, 0x2F, 0x00C5, false},
+    {0x02, 0x30, 0x005E, true},
+    {0x02, 0x31, 0x002A, false},
+    {0x02, 0x32, 0x002A, false},
+    {0x02, 0x33, 0x00D6, false},
+    {0x02, 0x34, 0x00C4, false},
+    {0x02, 0x35, 0x00BD, false},
+    {0x02, 0x36, 0x003B, false},
+    {0x02, 0x37, 0x003A, false},
+    {0x02, 0x38, 0x005F, false},
+    {0x02, 0x54, 0x002F, false},
+    {0x02, 0x64, 0x003E, false},
+    {0x40, 0x04, 0x00AA, false},
+    {0x40, 0x05, 0x201C, false},
+    {0x40, 0x06, 0x00A9, false},
+    {0x40, 0x07, 0x00F0, false},
+    {0x40, 0x08, 0x20AC, false},
+    {0x40, 0x09, 0x0111, false},
+    {0x40, 0x0A, 0x014B, false},
+    {0x40, 0x0B, 0x0127, false},
+    {0x40, 0x0C, 0x2192, false},
+    {0x40, 0x0E, 0x0138, false},
+    {0x40, 0x0F, 0x0142, false},
+    {0x40, 0x10, 0x00B5, false},
+    {0x40, 0x11, 0x201D, false},
+    {0x40, 0x12, 0x0153, false},
+    {0x40, 0x13, 0x00FE, false},
+    {0x40, 0x14, 0x0040, false},
+    {0x40, 0x15, 0x00AE, false},
+    {0x40, 0x16, 0x00DF, false},
+    {0x40, 0x17, 0x00FE, false},
+    {0x40, 0x18, 0x2193, false},
+    {0x40, 0x19, 0x201E, false},
+    {0x40, 0x1A, 0x017F, false},
+    {0x40, 0x1B, 0x00BB, false},
+    {0x40, 0x1C, 0x2190, false},
+    {0x40, 0x1D, 0x00AB, false},
+    {0x40, 0x1E, 0x00A1, false},
+    {0x40, 0x1F, 0x0040, false},
+    {0x40, 0x20, 0x00A3, false},
+    {0x40, 0x21, 0x0024, false},
+    {0x40, 0x22, 0x20AC, false},
+    {0x40, 0x23, 0x00A5, false},
+    {0x40, 0x24, 0x007B, false},
+    {0x40, 0x25, 0x005B, false},
+    {0x40, 0x26, 0x005D, false},
+    {0x40, 0x27, 0x007D, false},
+    {0x40, 0x28, 0x000A, false},
+    {0x40, 0x2B, 0x0009, false},
+    {0x40, 0x2C, 0x0020, false},
+    {0x40, 0x2D, 0x005C, false},
+    {0x40, 0x2E, 0x00B1, false},
+    {0x40, 0x2F, 0x00A8, true},
+    {0x40, 0x30, 0x007E, true},
+    {0x40, 0x31, 0x00B4, false},
+    {0x40, 0x32, 0x00B4, false},
+    {0x40, 0x33, 0x00F8, false},
+    {0x40, 0x34, 0x00E6, false},
+    {0x40, 0x35, 0x00B6, false},
+    {0x40, 0x36, 0x00B8, true},
+    {0x40, 0x37, 0x00B7, false},
+    {0x40, 0x54, 0x002F, false},
+    {0x40, 0x64, 0x007C, false},
+    {0x42, 0x04, 0x00BA, false},
+    {0x42, 0x05, 0x2018, false},
+    {0x42, 0x06, 0x00A9, false},
+    {0x42, 0x07, 0x00D0, false},
+    {0x42, 0x08, 0x00A2, false},
+    {0x42, 0x09, 0x00AA, false},
+    {0x42, 0x0A, 0x014A, false},
+    {0x42, 0x0B, 0x0126, false},
+    {0x42, 0x0C, 0x0131, false},
+    {0x42, 0x0E, 0x0026, false},
+    {0x42, 0x0F, 0x0141, false},
+    {0x42, 0x10, 0x00BA, false},
+    {0x42, 0x11, 0x2019, false},
+    {0x42, 0x12, 0x0152, false},
+    {0x42, 0x13, 0x00DE, false},
+    {0x42, 0x14, 0x03A9, false},
+    {0x42, 0x15, 0x00AE, false},
+    {0x42, 0x16, 0x1E9E, false},
+    {0x42, 0x17, 0x00DE, false},
+    {0x42, 0x18, 0x2191, false},
+    {0x42, 0x19, 0x201A, false},
+    {0x42, 0x1A, 0x00A7, false},
+    {0x42, 0x1B, 0x003E, false},
+    {0x42, 0x1C, 0x00A5, false},
+    {0x42, 0x1D, 0x003C, false},
+    {0x42, 0x1E, 0x00B9, false},
+    {0x42, 0x1F, 0x00B2, false},
+    {0x42, 0x20, 0x00B3, false},
+    {0x42, 0x21, 0x00BC, false},
+    {0x42, 0x22, 0x00A2, false},
+    {0x42, 0x23, 0x215D, false},
+    {0x42, 0x24, 0x00F7, false},
+    {0x42, 0x25, 0x00AB, false},
+    {0x42, 0x26, 0x00BB, false},
+    {0x42, 0x27, 0x00B0, false},
+    {0x42, 0x28, 0x000A, false},
+    {0x42, 0x2C, 0x00A0, false},
+    {0x42, 0x2D, 0x00BF, false},
+    {0x42, 0x2E, 0x00AC, false},
+    {0x42, 0x2F, 0x02DA, true},
+    {0x42, 0x30, 0x02C7, true},
+    {0x42, 0x31, 0x00D7, false},
+    {0x42, 0x32, 0x00D7, false},
+    {0x42, 0x33, 0x00D8, false},
+    {0x42, 0x34, 0x00C6, false},
+    {0x42, 0x35, 0x00BE, false},
+    {0x42, 0x36, 0x02DB, true},
+    {0x42, 0x37, 0x02D9, true},
+    {0x42, 0x38, 0x02D9, true},
+    {0x42, 0x54, 0x002F, false},
+    {0x42, 0x64, 0x00A6, false},
+};
+static const ReferenceCompose reference_swedish_se_composed[] = {
+    {0x00, 0x2E, 0x0041, 0x00C1},
+    {0x00, 0x2E, 0x0043, 0x0106},
+    {0x00, 0x2E, 0x0045, 0x00C9},
+    {0x00, 0x2E, 0x0047, 0x01F4},
+    {0x00, 0x2E, 0x0049, 0x00CD},
+    {0x00, 0x2E, 0x004B, 0x1E30},
+    {0x00, 0x2E, 0x004C, 0x0139},
+    {0x00, 0x2E, 0x004D, 0x1E3E},
+    {0x00, 0x2E, 0x004E, 0x0143},
+    {0x00, 0x2E, 0x004F, 0x00D3},
+    {0x00, 0x2E, 0x0050, 0x1E54},
+    {0x00, 0x2E, 0x0052, 0x0154},
+    {0x00, 0x2E, 0x0053, 0x015A},
+    {0x00, 0x2E, 0x0055, 0x00DA},
+    {0x00, 0x2E, 0x0057, 0x1E82},
+    {0x00, 0x2E, 0x0059, 0x00DD},
+    {0x00, 0x2E, 0x005A, 0x0179},
+    {0x00, 0x2E, 0x0061, 0x00E1},
+    {0x00, 0x2E, 0x0063, 0x0107},
+    {0x00, 0x2E, 0x0065, 0x00E9},
+    {0x00, 0x2E, 0x0067, 0x01F5},
+    {0x00, 0x2E, 0x0069, 0x00ED},
+    {0x00, 0x2E, 0x006B, 0x1E31},
+    {0x00, 0x2E, 0x006C, 0x013A},
+    {0x00, 0x2E, 0x006D, 0x1E3F},
+    {0x00, 0x2E, 0x006E, 0x0144},
+    {0x00, 0x2E, 0x006F, 0x00F3},
+    {0x00, 0x2E, 0x0070, 0x1E55},
+    {0x00, 0x2E, 0x0072, 0x0155},
+    {0x00, 0x2E, 0x0073, 0x015B},
+    {0x00, 0x2E, 0x0075, 0x00FA},
+    {0x00, 0x2E, 0x0077, 0x1E83},
+    {0x00, 0x2E, 0x0079, 0x00FD},
+    {0x00, 0x2E, 0x007A, 0x017A},
+    {0x00, 0x2E, 0x00C5, 0x01FA},
+    {0x00, 0x2E, 0x00C6, 0x01FC},
+    {0x00, 0x2E, 0x00D8, 0x01FE},
+    {0x00, 0x2E, 0x00E5, 0x01FB},
+    {0x00, 0x2E, 0x00E6, 0x01FD},
+    {0x00, 0x2E, 0x00F8, 0x01FF},
+    {0x00, 0x2E, 0x03A9, 0x038F},
+    {0x00, 0x30, 0x0041, 0x00C4},
+    {0x00, 0x30, 0x0045, 0x00CB},
+    {0x00, 0x30, 0x0048, 0x1E26},
+    {0x00, 0x30, 0x0049, 0x00CF},
+    {0x00, 0x30, 0x004F, 0x00D6},
+    {0x00, 0x30, 0x0055, 0x00DC},
+    {0x00, 0x30, 0x0057, 0x1E84},
+    {0x00, 0x30, 0x0058, 0x1E8C},
+    {0x00, 0x30, 0x0059, 0x0178},
+    {0x00, 0x30, 0x0061, 0x00E4},
+    {0x00, 0x30, 0x0065, 0x00EB},
+    {0x00, 0x30, 0x0068, 0x1E27},
+    {0x00, 0x30, 0x0069, 0x00EF},
+    {0x00, 0x30, 0x006F, 0x00F6},
+    {0x00, 0x30, 0x0074, 0x1E97},
+    {0x00, 0x30, 0x0075, 0x00FC},
+    {0x00, 0x30, 0x0077, 0x1E85},
+    {0x00, 0x30, 0x0078, 0x1E8D},
+    {0x00, 0x30, 0x0079, 0x00FF},
+    {0x02, 0x2E, 0x0041, 0x00C0},
+    {0x02, 0x2E, 0x0045, 0x00C8},
+    {0x02, 0x2E, 0x0049, 0x00CC},
+    {0x02, 0x2E, 0x004E, 0x01F8},
+    {0x02, 0x2E, 0x004F, 0x00D2},
+    {0x02, 0x2E, 0x0055, 0x00D9},
+    {0x02, 0x2E, 0x0057, 0x1E80},
+    {0x02, 0x2E, 0x0059, 0x1EF2},
+    {0x02, 0x2E, 0x0061, 0x00E0},
+    {0x02, 0x2E, 0x0065, 0x00E8},
+    {0x02, 0x2E, 0x0069, 0x00EC},
+    {0x02, 0x2E, 0x006E, 0x01F9},
+    {0x02, 0x2E, 0x006F, 0x00F2},
+    {0x02, 0x2E, 0x0075, 0x00F9},
+    {0x02, 0x2E, 0x0077, 0x1E81},
+    {0x02, 0x2E, 0x0079, 0x1EF3},
+    {0x02, 0x2E, 0x03A9, 0x1FFA},
+    {0x02, 0x30, 0x0041, 0x00C2},
+    {0x02, 0x30, 0x0043, 0x0108},
+    {0x02, 0x30, 0x0045, 0x00CA},
+    {0x02, 0x30, 0x0047, 0x011C},
+    {0x02, 0x30, 0x0048, 0x0124},
+    {0x02, 0x30, 0x0049, 0x00CE},
+    {0x02, 0x30, 0x004A, 0x0134},
+    {0x02, 0x30, 0x004F, 0x00D4},
+    {0x02, 0x30, 0x0053, 0x015C},
+    {0x02, 0x30, 0x0055, 0x00DB},
+    {0x02, 0x30, 0x0057, 0x0174},
+    {0x02, 0x30, 0x0059, 0x0176},
+    {0x02, 0x30, 0x005A, 0x1E90},
+    {0x02, 0x30, 0x0061, 0x00E2},
+    {0x02, 0x30, 0x0063, 0x0109},
+    {0x02, 0x30, 0x0065, 0x00EA},
+    {0x02, 0x30, 0x0067, 0x011D},
+    {0x02, 0x30, 0x0068, 0x0125},
+    {0x02, 0x30, 0x0069, 0x00EE},
+    {0x02, 0x30, 0x006A, 0x0135},
+    {0x02, 0x30, 0x006F, 0x00F4},
+    {0x02, 0x30, 0x0073, 0x015D},
+    {0x02, 0x30, 0x0075, 0x00FB},
+    {0x02, 0x30, 0x0077, 0x0175},
+    {0x02, 0x30, 0x0079, 0x0177},
+    {0x02, 0x30, 0x007A, 0x1E91},
+    {0x40, 0x2F, 0x0041, 0x00C4},
+    {0x40, 0x2F, 0x0045, 0x00CB},
+    {0x40, 0x2F, 0x0048, 0x1E26},
+    {0x40, 0x2F, 0x0049, 0x00CF},
+    {0x40, 0x2F, 0x004F, 0x00D6},
+    {0x40, 0x2F, 0x0055, 0x00DC},
+    {0x40, 0x2F, 0x0057, 0x1E84},
+    {0x40, 0x2F, 0x0058, 0x1E8C},
+    {0x40, 0x2F, 0x0059, 0x0178},
+    {0x40, 0x2F, 0x0061, 0x00E4},
+    {0x40, 0x2F, 0x0065, 0x00EB},
+    {0x40, 0x2F, 0x0068, 0x1E27},
+    {0x40, 0x2F, 0x0069, 0x00EF},
+    {0x40, 0x2F, 0x006F, 0x00F6},
+    {0x40, 0x2F, 0x0074, 0x1E97},
+    {0x40, 0x2F, 0x0075, 0x00FC},
+    {0x40, 0x2F, 0x0077, 0x1E85},
+    {0x40, 0x2F, 0x0078, 0x1E8D},
+    {0x40, 0x2F, 0x0079, 0x00FF},
+    {0x40, 0x30, 0x0041, 0x00C3},
+    {0x40, 0x30, 0x0045, 0x1EBC},
+    {0x40, 0x30, 0x0049, 0x0128},
+    {0x40, 0x30, 0x004E, 0x00D1},
+    {0x40, 0x30, 0x004F, 0x00D5},
+    {0x40, 0x30, 0x0055, 0x0168},
+    {0x40, 0x30, 0x0056, 0x1E7C},
+    {0x40, 0x30, 0x0059, 0x1EF8},
+    {0x40, 0x30, 0x0061, 0x00E3},
+    {0x40, 0x30, 0x0065, 0x1EBD},
+    {0x40, 0x30, 0x0069, 0x0129},
+    {0x40, 0x30, 0x006E, 0x00F1},
+    {0x40, 0x30, 0x006F, 0x00F5},
+    {0x40, 0x30, 0x0075, 0x0169},
+    {0x40, 0x30, 0x0076, 0x1E7D},
+    {0x40, 0x30, 0x0079, 0x1EF9},
+    {0x40, 0x36, 0x0043, 0x00C7},
+    {0x40, 0x36, 0x0044, 0x1E10},
+    {0x40, 0x36, 0x0045, 0x0228},
+    {0x40, 0x36, 0x0047, 0x0122},
+    {0x40, 0x36, 0x0048, 0x1E28},
+    {0x40, 0x36, 0x004B, 0x0136},
+    {0x40, 0x36, 0x004C, 0x013B},
+    {0x40, 0x36, 0x004E, 0x0145},
+    {0x40, 0x36, 0x0052, 0x0156},
+    {0x40, 0x36, 0x0053, 0x015E},
+    {0x40, 0x36, 0x0054, 0x0162},
+    {0x40, 0x36, 0x0063, 0x00E7},
+    {0x40, 0x36, 0x0064, 0x1E11},
+    {0x40, 0x36, 0x0065, 0x0229},
+    {0x40, 0x36, 0x0067, 0x0123},
+    {0x40, 0x36, 0x0068, 0x1E29},
+    {0x40, 0x36, 0x006B, 0x0137},
+    {0x40, 0x36, 0x006C, 0x013C},
+    {0x40, 0x36, 0x006E, 0x0146},
+    {0x40, 0x36, 0x0072, 0x0157},
+    {0x40, 0x36, 0x0073, 0x015F},
+    {0x40, 0x36, 0x0074, 0x0163},
+    {0x42, 0x2F, 0x0041, 0x00C5},
+    {0x42, 0x2F, 0x0055, 0x016E},
+    {0x42, 0x2F, 0x0061, 0x00E5},
+    {0x42, 0x2F, 0x0075, 0x016F},
+    {0x42, 0x2F, 0x0077, 0x1E98},
+    {0x42, 0x2F, 0x0079, 0x1E99},
+    {0x42, 0x30, 0x0041, 0x01CD},
+    {0x42, 0x30, 0x0043, 0x010C},
+    {0x42, 0x30, 0x0044, 0x010E},
+    {0x42, 0x30, 0x0045, 0x011A},
+    {0x42, 0x30, 0x0047, 0x01E6},
+    {0x42, 0x30, 0x0048, 0x021E},
+    {0x42, 0x30, 0x0049, 0x01CF},
+    {0x42, 0x30, 0x004B, 0x01E8},
+    {0x42, 0x30, 0x004C, 0x013D},
+    {0x42, 0x30, 0x004E, 0x0147},
+    {0x42, 0x30, 0x004F, 0x01D1},
+    {0x42, 0x30, 0x0052, 0x0158},
+    {0x42, 0x30, 0x0053, 0x0160},
+    {0x42, 0x30, 0x0054, 0x0164},
+    {0x42, 0x30, 0x0055, 0x01D3},
+    {0x42, 0x30, 0x005A, 0x017D},
+    {0x42, 0x30, 0x0061, 0x01CE},
+    {0x42, 0x30, 0x0063, 0x010D},
+    {0x42, 0x30, 0x0064, 0x010F},
+    {0x42, 0x30, 0x0065, 0x011B},
+    {0x42, 0x30, 0x0067, 0x01E7},
+    {0x42, 0x30, 0x0068, 0x021F},
+    {0x42, 0x30, 0x0069, 0x01D0},
+    {0x42, 0x30, 0x006A, 0x01F0},
+    {0x42, 0x30, 0x006B, 0x01E9},
+    {0x42, 0x30, 0x006C, 0x013E},
+    {0x42, 0x30, 0x006E, 0x0148},
+    {0x42, 0x30, 0x006F, 0x01D2},
+    {0x42, 0x30, 0x0072, 0x0159},
+    {0x42, 0x30, 0x0073, 0x0161},
+    {0x42, 0x30, 0x0074, 0x0165},
+    {0x42, 0x30, 0x0075, 0x01D4},
+    {0x42, 0x30, 0x007A, 0x017E},
+    {0x42, 0x36, 0x0041, 0x0104},
+    {0x42, 0x36, 0x0045, 0x0118},
+    {0x42, 0x36, 0x0049, 0x012E},
+    {0x42, 0x36, 0x004F, 0x01EA},
+    {0x42, 0x36, 0x0055, 0x0172},
+    {0x42, 0x36, 0x0061, 0x0105},
+    {0x42, 0x36, 0x0065, 0x0119},
+    {0x42, 0x36, 0x0069, 0x012F},
+    {0x42, 0x36, 0x006F, 0x01EB},
+    {0x42, 0x36, 0x0075, 0x0173},
+    {0x42, 0x37, 0x0041, 0x0226},
+    {0x42, 0x37, 0x0042, 0x1E02},
+    {0x42, 0x37, 0x0043, 0x010A},
+    {0x42, 0x37, 0x0044, 0x1E0A},
+    {0x42, 0x37, 0x0045, 0x0116},
+    {0x42, 0x37, 0x0046, 0x1E1E},
+    {0x42, 0x37, 0x0047, 0x0120},
+    {0x42, 0x37, 0x0048, 0x1E22},
+    {0x42, 0x37, 0x0049, 0x0130},
+    {0x42, 0x37, 0x004D, 0x1E40},
+    {0x42, 0x37, 0x004E, 0x1E44},
+    {0x42, 0x37, 0x004F, 0x022E},
+    {0x42, 0x37, 0x0050, 0x1E56},
+    {0x42, 0x37, 0x0052, 0x1E58},
+    {0x42, 0x37, 0x0053, 0x1E60},
+    {0x42, 0x37, 0x0054, 0x1E6A},
+    {0x42, 0x37, 0x0057, 0x1E86},
+    {0x42, 0x37, 0x0058, 0x1E8A},
+    {0x42, 0x37, 0x0059, 0x1E8E},
+    {0x42, 0x37, 0x005A, 0x017B},
+    {0x42, 0x37, 0x0061, 0x0227},
+    {0x42, 0x37, 0x0062, 0x1E03},
+    {0x42, 0x37, 0x0063, 0x010B},
+    {0x42, 0x37, 0x0064, 0x1E0B},
+    {0x42, 0x37, 0x0065, 0x0117},
+    {0x42, 0x37, 0x0066, 0x1E1F},
+    {0x42, 0x37, 0x0067, 0x0121},
+    {0x42, 0x37, 0x0068, 0x1E23},
+    {0x42, 0x37, 0x006D, 0x1E41},
+    {0x42, 0x37, 0x006E, 0x1E45},
+    {0x42, 0x37, 0x006F, 0x022F},
+    {0x42, 0x37, 0x0070, 0x1E57},
+    {0x42, 0x37, 0x0072, 0x1E59},
+    {0x42, 0x37, 0x0073, 0x1E61},
+    {0x42, 0x37, 0x0074, 0x1E6B},
+    {0x42, 0x37, 0x0077, 0x1E87},
+    {0x42, 0x37, 0x0078, 0x1E8B},
+    {0x42, 0x37, 0x0079, 0x1E8F},
+    {0x42, 0x37, 0x007A, 0x017C},
+    {0x42, 0x37, 0x017F, 0x1E9B},
+    {0x42, 0x38, 0x0041, 0x0226},
+    {0x42, 0x38, 0x0042, 0x1E02},
+    {0x42, 0x38, 0x0043, 0x010A},
+    {0x42, 0x38, 0x0044, 0x1E0A},
+    {0x42, 0x38, 0x0045, 0x0116},
+    {0x42, 0x38, 0x0046, 0x1E1E},
+    {0x42, 0x38, 0x0047, 0x0120},
+    {0x42, 0x38, 0x0048, 0x1E22},
+    {0x42, 0x38, 0x0049, 0x0130},
+    {0x42, 0x38, 0x004D, 0x1E40},
+    {0x42, 0x38, 0x004E, 0x1E44},
+    {0x42, 0x38, 0x004F, 0x022E},
+    {0x42, 0x38, 0x0050, 0x1E56},
+    {0x42, 0x38, 0x0052, 0x1E58},
+    {0x42, 0x38, 0x0053, 0x1E60},
+    {0x42, 0x38, 0x0054, 0x1E6A},
+    {0x42, 0x38, 0x0057, 0x1E86},
+    {0x42, 0x38, 0x0058, 0x1E8A},
+    {0x42, 0x38, 0x0059, 0x1E8E},
+    {0x42, 0x38, 0x005A, 0x017B},
+    {0x42, 0x38, 0x0061, 0x0227},
+    {0x42, 0x38, 0x0062, 0x1E03},
+    {0x42, 0x38, 0x0063, 0x010B},
+    {0x42, 0x38, 0x0064, 0x1E0B},
+    {0x42, 0x38, 0x0065, 0x0117},
+    {0x42, 0x38, 0x0066, 0x1E1F},
+    {0x42, 0x38, 0x0067, 0x0121},
+    {0x42, 0x38, 0x0068, 0x1E23},
+    {0x42, 0x38, 0x006D, 0x1E41},
+    {0x42, 0x38, 0x006E, 0x1E45},
+    {0x42, 0x38, 0x006F, 0x022F},
+    {0x42, 0x38, 0x0070, 0x1E57},
+    {0x42, 0x38, 0x0072, 0x1E59},
+    {0x42, 0x38, 0x0073, 0x1E61},
+    {0x42, 0x38, 0x0074, 0x1E6B},
+    {0x42, 0x38, 0x0077, 0x1E87},
+    {0x42, 0x38, 0x0078, 0x1E8B},
+    {0x42, 0x38, 0x0079, 0x1E8F},
+    {0x42, 0x38, 0x007A, 0x017C},
+    {0x42, 0x38, 0x017F, 0x1E9B},
+};
+
+// Hungarian (HU), xkb "hu"
+static const ReferenceKey reference_hungarian_hu_keys[] = {
+    {0x00, 0x04, 0x0061, false},
+    {0x00, 0x05, 0x0062, false},
+    {0x00, 0x06, 0x0063, false},
+    {0x00, 0x07, 0x0064, false},
+    {0x00, 0x08, 0x0065, false},
+    {0x00, 0x09, 0x0066, false},
+    {0x00, 0x0A, 0x0067, false},
+    {0x00, 0x0B, 0x0068, false},
+    {0x00, 0x0C, 0x0069, false},
+    {0x00, 0x0D, 0x006A, false},
+    {0x00, 0x0E, 0x006B, false},
+    {0x00, 0x0F, 0x006C, false},
+    {0x00, 0x10, 0x006D, false},
+    {0x00, 0x11, 0x006E, false},
+    {0x00, 0x12, 0x006F, false},
+    {0x00, 0x13, 0x0070, false},
+    {0x00, 0x14, 0x0071, false},
+    {0x00, 0x15, 0x0072, false},
+    {0x00, 0x16, 0x0073, false},
+    {0x00, 0x17, 0x0074, false},
+    {0x00, 0x18, 0x0075, false},
+    {0x00, 0x19, 0x0076, false},
+    {0x00, 0x1A, 0x0077, false},
+    {0x00, 0x1B, 0x0078, false},
+    {0x00, 0x1C, 0x007A, false},
+    {0x00, 0x1D, 0x0079, false},
+    {0x00, 0x1E, 0x0031, false},
+    {0x00, 0x1F, 0x0032, false},
+    {0x00, 0x20, 0x0033, false},
+    {0x00, 0x21, 0x0034, false},
+    {0x00, 0x22, 0x0035, false},
+    {0x00, 0x23, 0x0036, false},
+    {0x00, 0x24, 0x0037, false},
+    {0x00, 0x25, 0x0038, false},
+    {0x00, 0x26, 0x0039, false},
+    {0x00, 0x27, 0x00F6, false},
+    {0x00, 0x28, 0x000A, false},
+    {0x00, 0x2B, 0x0009, false},
+    {0x00, 0x2C, 0x0020, false},
+    {0x00, 0x2D, 0x00FC, false},
+    {0x00, 0x2E, 0x00F3, false},
+    {0x00, 0x2F, 0x0151, false},
+    {0x00, 0x30, 0x00FA, false},
+    {0x00, 0x31, 0x0171, false},
+    {0x00, 0x32, 0x0171, false},
+    {0x00, 0x33, 0x00E9, false},
+    {0x00, 0x34, 0x00E1, false},
+    {0x00, 0x35, 0x0030, false},
+    {0x00, 0x36, 0x002C, false},
+    {0x00, 0x37, 0x002E, false},
+    {0x00, 0x38, 0x002D, false},
+    {0x00, 0x54, 0x002F, false},
+    {0x00, 0x64, 0x00ED, false},
+    {0x02, 0x04, 0x0041, false},
+    {0x02, 0x05, 0x0042, false},
+    {0x02, 0x06, 0x0043, false},
+    {0x02, 0x07, 0x0044, false},
+    {0x02, 0x08, 0x0045, false},
+    {0x02, 0x09, 0x0046, false},
+    {0x02, 0x0A, 0x0047, false},
+    {0x02, 0x0B, 0x0048, false},
+    {0x02, 0x0C, 0x0049, false},
+    {0x02, 0x0D, 0x004A, false},
+    {0x02, 0x0E, 0x004B, false},
+    {0x02, 0x0F, 0x004C, false},
+    {0x02, 0x10, 0x004D, false},
+    {0x02, 0x11, 0x004E, false},
+    {0x02, 0x12, 0x004F, false},
+    {0x02, 0x13, 0x0050, false},
+    {0x02, 0x14, 0x0051, false},
+    {0x02, 0x15, 0x0052, false},
+    {0x02, 0x16, 0x0053, false},
+    {0x02, 0x17, 0x0054, false},
+    {0x02, 0x18, 0x0055, false},
+    {0x02, 0x19, 0x0056, false},
+    {0x02, 0x1A, 0x0057, false},
+    {0x02, 0x1B, 0x0058, false},
+    {0x02, 0x1C, 0x005A, false},
+    {0x02, 0x1D, 0x0059, false},
+    {0x02, 0x1E, 0x0027, false},
+    {0x02, 0x1F, 0x0022, false},
+    {0x02, 0x20, 0x002B, false},
+    {0x02, 0x21, 0x0021, false},
+    {0x02, 0x22, 0x0025, false},
+    {0x02, 0x23, 0x002F, false},
+    {0x02, 0x24, 0x003D, false},
+    {0x02, 0x25, 0x0028, false},
+    {0x02, 0x26, 0x0029, false},
+    {0x02, 0x27, 0x00D6, false},
+    {0x02, 0x28, 0x000A, false},
+    {0x02, 0x2C, 0x0020, false},
+    {0x02, 0x2D, 0x00DC, false},
+    {0x02, 0x2E, 0x00D3, false},
+    {0x02, 0x2F, 0x0150, false},
+    {0x02, 0x30, 0x00DA, false},
+    {0x02, 0x31, 0x0170, false},
+    {0x02, 0x32, 0x0170, false},
+    {0x02, 0x33, 0x00C9, false},
+    {0x02, 0x34, 0x00C1, false},
+    {0x02, 0x35, 0x00A7, false},
+    {0x02, 0x36, 0x003F, false},
+    {0x02, 0x37, 0x003A, false},
+    {0x02, 0x38, 0x005F, false},
+    {0x02, 0x54, 0x002F, false},
+    {0x02, 0x64, 0x00CD, false},
+    {0x40, 0x04, 0x00E4, false},
+    {0x40, 0x05, 0x007B, false},
+    {0x40, 0x06, 0x0026, false},
+    {0x40, 0x07, 0x0110, false},
+    {0x40, 0x08, 0x00C4, false},
+    {0x40, 0x09, 0x005B, false},
+    {0x40, 0x0A, 0x005D, false},
+    {0x40, 0x0B, 0x0127, false},
+    {0x40, 0x0C, 0x00CD, false},
+    {0x40, 0x0D, 0x00ED, false},
+    {0x40, 0x0E, 0x0142, false},
+    {0x40, 0x0F, 0x0141, false},
+    {0x40, 0x10, 0x003C, false},
+    {0x40, 0x11, 0x007D, false},
+    {0x40, 0x12, 0x201E, false},
+    {0x40, 0x13, 0x201D, false},
+    {0x40, 0x14, 0x005C, false},
+    {0x40, 0x15, 0x00B6, false},
+    {0x40, 0x16, 0x0111, false},
+    {0x40, 0x17, 0x0167, false},
+    {0x40, 0x18, 0x20AC, false},
+    {0x40, 0x19, 0x0040, false},
+    {0x40, 0x1A, 0x007C, false},
+    {0x40, 0x1B, 0x0023, false},
+    {0x40, 0x1C, 0x2013, false},
+    {0x40, 0x1D, 0x003E, false},
+    {0x40, 0x1E, 0x007E, true},
+    {0x40, 0x1F, 0x02C7, true},
+    {0x40, 0x20, 0x005E, true},
+    {0x40, 0x21, 0x02D8, true},
+    {0x40, 0x22, 0x02DA, true},
+    {0x40, 0x23, 0x02DB, true},
+    {0x40, 0x24, 0x0060, true},
+    {0x40, 0x25, 0x02D9, true},
+    {0x40, 0x26, 0x00B4, true},
+    {0x40, 0x27, 0x02DD, true},
+    {0x40, 0x28, 0x000A, false},
+    {0x40, 0x2B, 0x0009, false},
+    {0x40, 0x2C, 0x0020, false},
+    {0x40, 0x2D, 0x00A8, true},
+    {0x40, 0x2E, 0x00B8, true},
+    {0x40, 0x2F, 0x00F7, false},
+    {0x40, 0x30, 0x00D7, false},
+    {0x40, 0x31, 0x00A4, false},
+    {0x40, 0x32, 0x00A4, false},
+    {0x40, 0x33, 0x0024, false},
+    {0x40, 0x34, 0x00DF, false},
+    {0x40, 0x35, 0x00AC, false},
+    {0x40, 0x36, 0x003B, false},
+    {0x40, 0x37, 0x003E, false},
+    {0x40, 0x38, 0x002A, false},
+    {0x40, 0x54, 0x002F, false},
+    {0x40, 0x64, 0x003C, false},
+    {0x42, 0x04, 0x00C4, false},
+    {0x42, 0x05, 0x2018, false},
+    {0x42, 0x06, 0x00A9, false},
+    {0x42, 0x07, 0x00D0, false},
+    {0x42, 0x08, 0x0045, false},
+    {0x42, 0x09, 0x00AA, false},
+    {0x42, 0x0A, 0x014A, false},
+    {0x42, 0x0B, 0x0126, false},
+    {0x42, 0x0C, 0x00ED, false},
+    {0x42, 0x0D, 0x00CD, false},
+    {0x42, 0x0E, 0x0026, false},
+    {0x42, 0x0F, 0x0141, false},
+    {0x42, 0x10, 0x00BA, false},
+    {0x42, 0x11, 0x2019, false},
+    {0x42, 0x12, 0x00D8, false},
+    {0x42, 0x13, 0x00DE, false},
+    {0x42, 0x14, 0x03A9, false},
+    {0x42, 0x15, 0x00AE, false},
+    {0x42, 0x16, 0x1E9E, false},
+    {0x42, 0x17, 0x0166, false},
+    {0x42, 0x18, 0x2191, false},
+    {0x42, 0x19, 0x201A, false},
+    {0x42, 0x1A, 0x00A7, false},
+    {0x42, 0x1B, 0x003E, false},
+    {0x42, 0x1C, 0x00A5, false},
+    {0x42, 0x1D, 0x003C, false},
+    {0x42, 0x1E, 0x007E, true},
+    {0x42, 0x1F, 0x02C7, false},
+    {0x42, 0x20, 0x005E, true},
+    {0x42, 0x21, 0x02D8, false},
+    {0x42, 0x22, 0x00B0, false},
+    {0x42, 0x23, 0x02DB, false},
+    {0x42, 0x24, 0x0060, true},
+    {0x42, 0x25, 0x02D9, false},
+    {0x42, 0x26, 0x00B4, false},
+    {0x42, 0x27, 0x02DD, false},
+    {0x42, 0x28, 0x000A, false},
+    {0x42, 0x2C, 0x0020, false},
+    {0x42, 0x2D, 0x00A8, false},
+    {0x42, 0x2E, 0x00B8, false},
+    {0x42, 0x2F, 0x02DA, true},
+    {0x42, 0x30, 0x00AF, true},
+    {0x42, 0x31, 0x02D8, true},
+    {0x42, 0x32, 0x02D8, true},
+    {0x42, 0x33, 0x00A2, false},
+    {0x42, 0x34, 0x1E9E, false},
+    {0x42, 0x35, 0x00AC, false},
+    {0x42, 0x36, 0x00D7, false},
+    {0x42, 0x37, 0x00F7, false},
+    {0x42, 0x38, 0x02D9, true},
+    {0x42, 0x54, 0x002F, false},
+    {0x42, 0x64, 0x003E, false},
+};
+static const ReferenceCompose reference_hungarian_hu_composed[] = {
+    {0x40, 0x1E, 0x0041, 0x00C3},
+    {0x40, 0x1E, 0x0045, 0x1EBC},
+    {0x40, 0x1E, 0x0049, 0x0128},
+    {0x40, 0x1E, 0x004E, 0x00D1},
+    {0x40, 0x1E, 0x004F, 0x00D5},
+    {0x40, 0x1E, 0x0055, 0x0168},
+    {0x40, 0x1E, 0x0056, 0x1E7C},
+    {0x40, 0x1E, 0x0059, 0x1EF8},
+    {0x40, 0x1E, 0x0061, 0x00E3},
+    {0x40, 0x1E, 0x0065, 0x1EBD},
+    {0x40, 0x1E, 0x0069, 0x0129},
+    {0x40, 0x1E, 0x006E, 0x00F1},
+    {0x40, 0x1E, 0x006F, 0x00F5},
+    {0x40, 0x1E, 0x0075, 0x0169},
+    {0x40, 0x1E, 0x0076, 0x1E7D},
+    {0x40, 0x1E, 0x0079, 0x1EF9},
+    {0x40, 0x1F, 0x0041, 0x01CD},
+    {0x40, 0x1F, 0x0043, 0x010C},
+    {0x40, 0x1F, 0x0044, 0x010E},
+    {0x40, 0x1F, 0x0045, 0x011A},
+    {0x40, 0x1F, 0x0047, 0x01E6},
+    {0x40, 0x1F, 0x0048, 0x021E},
+    {0x40, 0x1F, 0x0049, 0x01CF},
+    {0x40, 0x1F, 0x004B, 0x01E8},
+    {0x40, 0x1F, 0x004C, 0x013D},
+    {0x40, 0x1F, 0x004E, 0x0147},
+    {0x40, 0x1F, 0x004F, 0x01D1},
+    {0x40, 0x1F, 0x0052, 0x0158},
+    {0x40, 0x1F, 0x0053, 0x0160},
+    {0x40, 0x1F, 0x0054, 0x0164},
+    {0x40, 0x1F, 0x0055, 0x01D3},
+    {0x40, 0x1F, 0x005A, 0x017D},
+    {0x40, 0x1F, 0x0061, 0x01CE},
+    {0x40, 0x1F, 0x0063, 0x010D},
+    {0x40, 0x1F, 0x0064, 0x010F},
+    {0x40, 0x1F, 0x0065, 0x011B},
+    {0x40, 0x1F, 0x0067, 0x01E7},
+    {0x40, 0x1F, 0x0068, 0x021F},
+    {0x40, 0x1F, 0x0069, 0x01D0},
+    {0x40, 0x1F, 0x006A, 0x01F0},
+    {0x40, 0x1F, 0x006B, 0x01E9},
+    {0x40, 0x1F, 0x006C, 0x013E},
+    {0x40, 0x1F, 0x006E, 0x0148},
+    {0x40, 0x1F, 0x006F, 0x01D2},
+    {0x40, 0x1F, 0x0072, 0x0159},
+    {0x40, 0x1F, 0x0073, 0x0161},
+    {0x40, 0x1F, 0x0074, 0x0165},
+    {0x40, 0x1F, 0x0075, 0x01D4},
+    {0x40, 0x1F, 0x007A, 0x017E},
+    {0x40, 0x1F, 0x00DC, 0x01D9},
+    {0x40, 0x1F, 0x00FC, 0x01DA},
+    {0x40, 0x20, 0x0041, 0x00C2},
+    {0x40, 0x20, 0x0043, 0x0108},
+    {0x40, 0x20, 0x0045, 0x00CA},
+    {0x40, 0x20, 0x0047, 0x011C},
+    {0x40, 0x20, 0x0048, 0x0124},
+    {0x40, 0x20, 0x0049, 0x00CE},
+    {0x40, 0x20, 0x004A, 0x0134},
+    {0x40, 0x20, 0x004F, 0x00D4},
+    {0x40, 0x20, 0x0053, 0x015C},
+    {0x40, 0x20, 0x0055, 0x00DB},
+    {0x40, 0x20, 0x0057, 0x0174},
+    {0x40, 0x20, 0x0059, 0x0176},
+    {0x40, 0x20, 0x005A, 0x1E90},
+    {0x40, 0x20, 0x0061, 0x00E2},
+    {0x40, 0x20, 0x0063, 0x0109},
+    {0x40, 0x20, 0x0065, 0x00EA},
+    {0x40, 0x20, 0x0067, 0x011D},
+    {0x40, 0x20, 0x0068, 0x0125},
+    {0x40, 0x20, 0x0069, 0x00EE},
+    {0x40, 0x20, 0x006A, 0x0135},
+    {0x40, 0x20, 0x006F, 0x00F4},
+    {0x40, 0x20, 0x0073, 0x015D},
+    {0x40, 0x20, 0x0075, 0x00FB},
+    {0x40, 0x20, 0x0077, 0x0175},
+    {0x40, 0x20, 0x0079, 0x0177},
+    {0x40, 0x20, 0x007A, 0x1E91},
+    {0x40, 0x21, 0x0041, 0x0102},
+    {0x40, 0x21, 0x0045, 0x0114},
+    {0x40, 0x21, 0x0047, 0x011E},
+    {0x40, 0x21, 0x0049, 0x012C},
+    {0x40, 0x21, 0x004F, 0x014E},
+    {0x40, 0x21, 0x0055, 0x016C},
+    {0x40, 0x21, 0x0061, 0x0103},
+    {0x40, 0x21, 0x0065, 0x0115},
+    {0x40, 0x21, 0x0067, 0x011F},
+    {0x40, 0x21, 0x0069, 0x012D},
+    {0x40, 0x21, 0x006F, 0x014F},
+    {0x40, 0x21, 0x0075, 0x016D},
+    {0x40, 0x22, 0x0041, 0x00C5},
+    {0x40, 0x22, 0x0055, 0x016E},
+    {0x40, 0x22, 0x0061, 0x00E5},
+    {0x40, 0x22, 0x0075, 0x016F},
+    {0x40, 0x22, 0x0077, 0x1E98},
+    {0x40, 0x22, 0x0079, 0x1E99},
+    {0x40, 0x23, 0x0041, 0x0104},
+    {0x40, 0x23, 0x0045, 0x0118},
+    {0x40, 0x23, 0x0049, 0x012E},
+    {0x40, 0x23, 0x004F, 0x01EA},
+    {0x40, 0x23, 0x0055, 0x0172},
+    {0x40, 0x23, 0x0061, 0x0105},
+    {0x40, 0x23, 0x0065, 0x0119},
+    {0x40, 0x23, 0x0069, 0x012F},
+    {0x40, 0x23, 0x006F, 0x01EB},
+    {0x40, 0x23, 0x0075, 0x0173},
+    {0x40, 0x24, 0x0041, 0x00C0},
+    {0x40, 0x24, 0x0045, 0x00C8},
+    {0x40, 0x24, 0x0049, 0x00CC},
+    {0x40, 0x24, 0x004E, 0x01F8},
+    {0x40, 0x24, 0x004F, 0x00D2},
+    {0x40, 0x24, 0x0055, 0x00D9},
+    {0x40, 0x24, 0x0057, 0x1E80},
+    {0x40, 0x24, 0x0059, 0x1EF2},
+    {0x40, 0x24, 0x0061, 0x00E0},
+    {0x40, 0x24, 0x0065, 0x00E8},
+    {0x40, 0x24, 0x0069, 0x00EC},
+    {0x40, 0x24, 0x006E, 0x01F9},
+    {0x40, 0x24, 0x006F, 0x00F2},
+    {0x40, 0x24, 0x0075, 0x00F9},
+    {0x40, 0x24, 0x0077, 0x1E81},
+    {0x40, 0x24, 0x0079, 0x1EF3},
+    {0x40, 0x24, 0x00A8, 0x1FED},
+    {0x40, 0x24, 0x00DC, 0x01DB},
+    {0x40, 0x24, 0x00FC, 0x01DC},
+    {0x40, 0x24, 0x03A9, 0x1FFA},
+    {0x40, 0x25, 0x0041, 0x0226},
+    {0x40, 0x25, 0x0042, 0x1E02},
+    {0x40, 0x25, 0x0043, 0x010A},
+    {0x40, 0x25, 0x0044, 0x1E0A},
+    {0x40, 0x25, 0x0045, 0x0116},
+    {0x40, 0x25, 0x0046, 0x1E1E},
+    {0x40, 0x25, 0x0047, 0x0120},
+    {0x40, 0x25, 0x0048, 0x1E22},
+    {0x40, 0x25, 0x0049, 0x0130},
+    {0x40, 0x25, 0x004D, 0x1E40},
+    {0x40, 0x25, 0x004E, 0x1E44},
+    {0x40, 0x25, 0x004F, 0x022E},
+    {0x40, 0x25, 0x0050, 0x1E56},
+    {0x40, 0x25, 0x0052, 0x1E58},
+    {0x40, 0x25, 0x0053, 0x1E60},
+    {0x40, 0x25, 0x0054, 0x1E6A},
+    {0x40, 0x25, 0x0057, 0x1E86},
+    {0x40, 0x25, 0x0058, 0x1E8A},
+    {0x40, 0x25, 0x0059, 0x1E8E},
+    {0x40, 0x25, 0x005A, 0x017B},
+    {0x40, 0x25, 0x0061, 0x0227},
+    {0x40, 0x25, 0x0062, 0x1E03},
+    {0x40, 0x25, 0x0063, 0x010B},
+    {0x40, 0x25, 0x0064, 0x1E0B},
+    {0x40, 0x25, 0x0065, 0x0117},
+    {0x40, 0x25, 0x0066, 0x1E1F},
+    {0x40, 0x25, 0x0067, 0x0121},
+    {0x40, 0x25, 0x0068, 0x1E23},
+    {0x40, 0x25, 0x006D, 0x1E41},
+    {0x40, 0x25, 0x006E, 0x1E45},
+    {0x40, 0x25, 0x006F, 0x022F},
+    {0x40, 0x25, 0x0070, 0x1E57},
+    {0x40, 0x25, 0x0072, 0x1E59},
+    {0x40, 0x25, 0x0073, 0x1E61},
+    {0x40, 0x25, 0x0074, 0x1E6B},
+    {0x40, 0x25, 0x0077, 0x1E87},
+    {0x40, 0x25, 0x0078, 0x1E8B},
+    {0x40, 0x25, 0x0079, 0x1E8F},
+    {0x40, 0x25, 0x007A, 0x017C},
+    {0x40, 0x26, 0x0041, 0x00C1},
+    {0x40, 0x26, 0x0043, 0x0106},
+    {0x40, 0x26, 0x0045, 0x00C9},
+    {0x40, 0x26, 0x0047, 0x01F4},
+    {0x40, 0x26, 0x0049, 0x00CD},
+    {0x40, 0x26, 0x004B, 0x1E30},
+    {0x40, 0x26, 0x004C, 0x0139},
+    {0x40, 0x26, 0x004D, 0x1E3E},
+    {0x40, 0x26, 0x004E, 0x0143},
+    {0x40, 0x26, 0x004F, 0x00D3},
+    {0x40, 0x26, 0x0050, 0x1E54},
+    {0x40, 0x26, 0x0052, 0x0154},
+    {0x40, 0x26, 0x0053, 0x015A},
+    {0x40, 0x26, 0x0055, 0x00DA},
+    {0x40, 0x26, 0x0057, 0x1E82},
+    {0x40, 0x26, 0x0059, 0x00DD},
+    {0x40, 0x26, 0x005A, 0x0179},
+    {0x40, 0x26, 0x0061, 0x00E1},
+    {0x40, 0x26, 0x0063, 0x0107},
+    {0x40, 0x26, 0x0065, 0x00E9},
+    {0x40, 0x26, 0x0067, 0x01F5},
+    {0x40, 0x26, 0x0069, 0x00ED},
+    {0x40, 0x26, 0x006B, 0x1E31},
+    {0x40, 0x26, 0x006C, 0x013A},
+    {0x40, 0x26, 0x006D, 0x1E3F},
+    {0x40, 0x26, 0x006E, 0x0144},
+    {0x40, 0x26, 0x006F, 0x00F3},
+    {0x40, 0x26, 0x0070, 0x1E55},
+    {0x40, 0x26, 0x0072, 0x0155},
+    {0x40, 0x26, 0x0073, 0x015B},
+    {0x40, 0x26, 0x0075, 0x00FA},
+    {0x40, 0x26, 0x0077, 0x1E83},
+    {0x40, 0x26, 0x0079, 0x00FD},
+    {0x40, 0x26, 0x007A, 0x017A},
+    {0x40, 0x26, 0x00A8, 0x0385},
+    {0x40, 0x26, 0x00D8, 0x01FE},
+    {0x40, 0x26, 0x00DC, 0x01D7},
+    {0x40, 0x26, 0x00FC, 0x01D8},
+    {0x40, 0x26, 0x03A9, 0x038F},
+    {0x40, 0x27, 0x004F, 0x0150},
+    {0x40, 0x27, 0x0055, 0x0170},
+    {0x40, 0x27, 0x006F, 0x0151},
+    {0x40, 0x27, 0x0075, 0x0171},
+    {0x40, 0x2D, 0x0041, 0x00C4},
+    {0x40, 0x2D, 0x0045, 0x00CB},
+    {0x40, 0x2D, 0x0048, 0x1E26},
+    {0x40, 0x2D, 0x0049, 0x00CF},
+    {0x40, 0x2D, 0x004F, 0x00D6},
+    {0x40, 0x2D, 0x0055, 0x00DC},
+    {0x40, 0x2D, 0x0057, 0x1E84},
+    {0x40, 0x2D, 0x0058, 0x1E8C},
+    {0x40, 0x2D, 0x0059, 0x0178},
+    {0x40, 0x2D, 0x0061, 0x00E4},
+    {0x40, 0x2D, 0x0065, 0x00EB},
+    {0x40, 0x2D, 0x0068, 0x1E27},
+    {0x40, 0x2D, 0x0069, 0x00EF},
+    {0x40, 0x2D, 0x006F, 0x00F6},
+    {0x40, 0x2D, 0x0074, 0x1E97},
+    {0x40, 0x2D, 0x0075, 0x00FC},
+    {0x40, 0x2D, 0x0077, 0x1E85},
+    {0x40, 0x2D, 0x0078, 0x1E8D},
+    {0x40, 0x2D, 0x0079, 0x00FF},
+    {0x40, 0x2E, 0x0043, 0x00C7},
+    {0x40, 0x2E, 0x0044, 0x1E10},
+    {0x40, 0x2E, 0x0045, 0x0228},
+    {0x40, 0x2E, 0x0047, 0x0122},
+    {0x40, 0x2E, 0x0048, 0x1E28},
+    {0x40, 0x2E, 0x004B, 0x0136},
+    {0x40, 0x2E, 0x004C, 0x013B},
+    {0x40, 0x2E, 0x004E, 0x0145},
+    {0x40, 0x2E, 0x0052, 0x0156},
+    {0x40, 0x2E, 0x0053, 0x015E},
+    {0x40, 0x2E, 0x0054, 0x0162},
+    {0x40, 0x2E, 0x0063, 0x00E7},
+    {0x40, 0x2E, 0x0064, 0x1E11},
+    {0x40, 0x2E, 0x0065, 0x0229},
+    {0x40, 0x2E, 0x0067, 0x0123},
+    {0x40, 0x2E, 0x0068, 0x1E29},
+    {0x40, 0x2E, 0x006B, 0x0137},
+    {0x40, 0x2E, 0x006C, 0x013C},
+    {0x40, 0x2E, 0x006E, 0x0146},
+    {0x40, 0x2E, 0x0072, 0x0157},
+    {0x40, 0x2E, 0x0073, 0x015F},
+    {0x40, 0x2E, 0x0074, 0x0163},
+    {0x42, 0x1E, 0x0041, 0x00C3},
+    {0x42, 0x1E, 0x0045, 0x1EBC},
+    {0x42, 0x1E, 0x0049, 0x0128},
+    {0x42, 0x1E, 0x004E, 0x00D1},
+    {0x42, 0x1E, 0x004F, 0x00D5},
+    {0x42, 0x1E, 0x0055, 0x0168},
+    {0x42, 0x1E, 0x0056, 0x1E7C},
+    {0x42, 0x1E, 0x0059, 0x1EF8},
+    {0x42, 0x1E, 0x0061, 0x00E3},
+    {0x42, 0x1E, 0x0065, 0x1EBD},
+    {0x42, 0x1E, 0x0069, 0x0129},
+    {0x42, 0x1E, 0x006E, 0x00F1},
+    {0x42, 0x1E, 0x006F, 0x00F5},
+    {0x42, 0x1E, 0x0075, 0x0169},
+    {0x42, 0x1E, 0x0076, 0x1E7D},
+    {0x42, 0x1E, 0x0079, 0x1EF9},
+    {0x42, 0x20, 0x0041, 0x00C2},
+    {0x42, 0x20, 0x0043, 0x0108},
+    {0x42, 0x20, 0x0045, 0x00CA},
+    {0x42, 0x20, 0x0047, 0x011C},
+    {0x42, 0x20, 0x0048, 0x0124},
+    {0x42, 0x20, 0x0049, 0x00CE},
+    {0x42, 0x20, 0x004A, 0x0134},
+    {0x42, 0x20, 0x004F, 0x00D4},
+    {0x42, 0x20, 0x0053, 0x015C},
+    {0x42, 0x20, 0x0055, 0x00DB},
+    {0x42, 0x20, 0x0057, 0x0174},
+    {0x42, 0x20, 0x0059, 0x0176},
+    {0x42, 0x20, 0x005A, 0x1E90},
+    {0x42, 0x20, 0x0061, 0x00E2},
+    {0x42, 0x20, 0x0063, 0x0109},
+    {0x42, 0x20, 0x0065, 0x00EA},
+    {0x42, 0x20, 0x0067, 0x011D},
+    {0x42, 0x20, 0x0068, 0x0125},
+    {0x42, 0x20, 0x0069, 0x00EE},
+    {0x42, 0x20, 0x006A, 0x0135},
+    {0x42, 0x20, 0x006F, 0x00F4},
+    {0x42, 0x20, 0x0073, 0x015D},
+    {0x42, 0x20, 0x0075, 0x00FB},
+    {0x42, 0x20, 0x0077, 0x0175},
+    {0x42, 0x20, 0x0079, 0x0177},
+    {0x42, 0x20, 0x007A, 0x1E91},
+    {0x42, 0x24, 0x0041, 0x00C0},
+    {0x42, 0x24, 0x0045, 0x00C8},
+    {0x42, 0x24, 0x0049, 0x00CC},
+    {0x42, 0x24, 0x004E, 0x01F8},
+    {0x42, 0x24, 0x004F, 0x00D2},
+    {0x42, 0x24, 0x0055, 0x00D9},
+    {0x42, 0x24, 0x0057, 0x1E80},
+    {0x42, 0x24, 0x0059, 0x1EF2},
+    {0x42, 0x24, 0x0061, 0x00E0},
+    {0x42, 0x24, 0x0065, 0x00E8},
+    {0x42, 0x24, 0x0069, 0x00EC},
+    {0x42, 0x24, 0x006E, 0x01F9},
+    {0x42, 0x24, 0x006F, 0x00F2},
+    {0x42, 0x24, 0x0075, 0x00F9},
+    {0x42, 0x24, 0x0077, 0x1E81},
+    {0x42, 0x24, 0x0079, 0x1EF3},
+    {0x42, 0x24, 0x00A8, 0x1FED},
+    {0x42, 0x24, 0x00DC, 0x01DB},
+    {0x42, 0x24, 0x00FC, 0x01DC},
+    {0x42, 0x24, 0x03A9, 0x1FFA},
+    {0x42, 0x2F, 0x0041, 0x00C5},
+    {0x42, 0x2F, 0x0055, 0x016E},
+    {0x42, 0x2F, 0x0061, 0x00E5},
+    {0x42, 0x2F, 0x0075, 0x016F},
+    {0x42, 0x2F, 0x0077, 0x1E98},
+    {0x42, 0x2F, 0x0079, 0x1E99},
+    {0x42, 0x30, 0x0041, 0x0100},
+    {0x42, 0x30, 0x0045, 0x0112},
+    {0x42, 0x30, 0x0047, 0x1E20},
+    {0x42, 0x30, 0x0049, 0x012A},
+    {0x42, 0x30, 0x004F, 0x014C},
+    {0x42, 0x30, 0x0055, 0x016A},
+    {0x42, 0x30, 0x0059, 0x0232},
+    {0x42, 0x30, 0x0061, 0x0101},
+    {0x42, 0x30, 0x0065, 0x0113},
+    {0x42, 0x30, 0x0067, 0x1E21},
+    {0x42, 0x30, 0x0069, 0x012B},
+    {0x42, 0x30, 0x006F, 0x014D},
+    {0x42, 0x30, 0x0075, 0x016B},
+    {0x42, 0x30, 0x0079, 0x0233},
+    {0x42, 0x30, 0x00C4, 0x01DE},
+    {0x42, 0x30, 0x00D6, 0x022A},
+    {0x42, 0x30, 0x00DC, 0x01D5},
+    {0x42, 0x30, 0x00E4, 0x01DF},
+    {0x42, 0x30, 0x00F6, 0x022B},
+    {0x42, 0x30, 0x00FC, 0x01D6},
+    {0x42, 0x31, 0x0041, 0x0102},
+    {0x42, 0x31, 0x0045, 0x0114},
+    {0x42, 0x31, 0x0047, 0x011E},
+    {0x42, 0x31, 0x0049, 0x012C},
+    {0x42, 0x31, 0x004F, 0x014E},
+    {0x42, 0x31, 0x0055, 0x016C},
+    {0x42, 0x31, 0x0061, 0x0103},
+    {0x42, 0x31, 0x0065, 0x0115},
+    {0x42, 0x31, 0x0067, 0x011F},
+    {0x42, 0x31, 0x0069, 0x012D},
+    {0x42, 0x31, 0x006F, 0x014F},
+    {0x42, 0x31, 0x0075, 0x016D},
+    {0x42, 0x32, 0x0041, 0x0102},
+    {0x42, 0x32, 0x0045, 0x0114},
+    {0x42, 0x32, 0x0047, 0x011E},
+    {0x42, 0x32, 0x0049, 0x012C},
+    {0x42, 0x32, 0x004F, 0x014E},
+    {0x42, 0x32, 0x0055, 0x016C},
+    {0x42, 0x32, 0x0061, 0x0103},
+    {0x42, 0x32, 0x0065, 0x0115},
+    {0x42, 0x32, 0x0067, 0x011F},
+    {0x42, 0x32, 0x0069, 0x012D},
+    {0x42, 0x32, 0x006F, 0x014F},
+    {0x42, 0x32, 0x0075, 0x016D},
+    {0x42, 0x38, 0x0041, 0x0226},
+    {0x42, 0x38, 0x0042, 0x1E02},
+    {0x42, 0x38, 0x0043, 0x010A},
+    {0x42, 0x38, 0x0044, 0x1E0A},
+    {0x42, 0x38, 0x0045, 0x0116},
+    {0x42, 0x38, 0x0046, 0x1E1E},
+    {0x42, 0x38, 0x0047, 0x0120},
+    {0x42, 0x38, 0x0048, 0x1E22},
+    {0x42, 0x38, 0x0049, 0x0130},
+    {0x42, 0x38, 0x004D, 0x1E40},
+    {0x42, 0x38, 0x004E, 0x1E44},
+    {0x42, 0x38, 0x004F, 0x022E},
+    {0x42, 0x38, 0x0050, 0x1E56},
+    {0x42, 0x38, 0x0052, 0x1E58},
+    {0x42, 0x38, 0x0053, 0x1E60},
+    {0x42, 0x38, 0x0054, 0x1E6A},
+    {0x42, 0x38, 0x0057, 0x1E86},
+    {0x42, 0x38, 0x0058, 0x1E8A},
+    {0x42, 0x38, 0x0059, 0x1E8E},
+    {0x42, 0x38, 0x005A, 0x017B},
+    {0x42, 0x38, 0x0061, 0x0227},
+    {0x42, 0x38, 0x0062, 0x1E03},
+    {0x42, 0x38, 0x0063, 0x010B},
+    {0x42, 0x38, 0x0064, 0x1E0B},
+    {0x42, 0x38, 0x0065, 0x0117},
+    {0x42, 0x38, 0x0066, 0x1E1F},
+    {0x42, 0x38, 0x0067, 0x0121},
+    {0x42, 0x38, 0x0068, 0x1E23},
+    {0x42, 0x38, 0x006D, 0x1E41},
+    {0x42, 0x38, 0x006E, 0x1E45},
+    {0x42, 0x38, 0x006F, 0x022F},
+    {0x42, 0x38, 0x0070, 0x1E57},
+    {0x42, 0x38, 0x0072, 0x1E59},
+    {0x42, 0x38, 0x0073, 0x1E61},
+    {0x42, 0x38, 0x0074, 0x1E6B},
+    {0x42, 0x38, 0x0077, 0x1E87},
+    {0x42, 0x38, 0x0078, 0x1E8B},
+    {0x42, 0x38, 0x0079, 0x1E8F},
+    {0x42, 0x38, 0x007A, 0x017C},
+};
+
+static const ReferenceKeymap referenceKeymaps[] = {
+    {"English (US)", reference_english_us_keys, sizeof(reference_english_us_keys) / sizeof(ReferenceKey), nullptr, 0},
+    {"English (UK)", reference_english_uk_keys, sizeof(reference_english_uk_keys) / sizeof(ReferenceKey), reference_english_uk_composed, sizeof(reference_english_uk_composed) / sizeof(ReferenceCompose)},
+    {"French (FR)", reference_french_fr_keys, sizeof(reference_french_fr_keys) / sizeof(ReferenceKey), reference_french_fr_composed, sizeof(reference_french_fr_composed) / sizeof(ReferenceCompose)},
+    {"German (DE)", reference_german_de_keys, sizeof(reference_german_de_keys) / sizeof(ReferenceKey), reference_german_de_composed, sizeof(reference_german_de_composed) / sizeof(ReferenceCompose)},
+    {"Italian (IT)", reference_italian_it_keys, sizeof(reference_italian_it_keys) / sizeof(ReferenceKey), reference_italian_it_composed, sizeof(reference_italian_it_composed) / sizeof(ReferenceCompose)},
+    {"Spanish (ES)", reference_spanish_es_keys, sizeof(reference_spanish_es_keys) / sizeof(ReferenceKey), reference_spanish_es_composed, sizeof(reference_spanish_es_composed) / sizeof(ReferenceCompose)},
+    {"Portuguese (PT)", reference_portuguese_pt_keys, sizeof(reference_portuguese_pt_keys) / sizeof(ReferenceKey), reference_portuguese_pt_composed, sizeof(reference_portuguese_pt_composed) / sizeof(ReferenceCompose)},
+    {"Portuguese (BR)", reference_portuguese_br_keys, sizeof(reference_portuguese_br_keys) / sizeof(ReferenceKey), reference_portuguese_br_composed, sizeof(reference_portuguese_br_composed) / sizeof(ReferenceCompose)},
+    {"Danish (DK)", reference_danish_dk_keys, sizeof(reference_danish_dk_keys) / sizeof(ReferenceKey), reference_danish_dk_composed, sizeof(reference_danish_dk_composed) / sizeof(ReferenceCompose)},
+    {"Swedish (SE)", reference_swedish_se_keys, sizeof(reference_swedish_se_keys) / sizeof(ReferenceKey), reference_swedish_se_composed, sizeof(reference_swedish_se_composed) / sizeof(ReferenceCompose)},
+    {"Hungarian (HU)", reference_hungarian_hu_keys, sizeof(reference_hungarian_hu_keys) / sizeof(ReferenceKey), reference_hungarian_hu_composed, sizeof(reference_hungarian_hu_composed) / sizeof(ReferenceCompose)},
+};
+
+#endif // REFERENCE_KEYMAPS_H
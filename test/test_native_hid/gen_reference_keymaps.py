@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+"""Writes ReferenceKeymaps.h, what a Linux host types for each HID stroke.
+
+The keymaps come from xkeyboard-config through libxkbcommon, independent of
+the firmware layout tables, so the host simulator can catch a wrong entry.
+Dead keys follow the usual desktop behaviour: the spacing accent on space,
+the precomposed letter when Unicode has one.
+
+The layout tables follow the Windows layouts, the few keys where Windows and
+xkb disagree are overridden below with the Windows meaning.
+
+    python3 gen_reference_keymaps.py > ReferenceKeymaps.h
+"""
+
+import ctypes
+import subprocess
+import unicodedata
+
+# Firmware layout name -> xkb layout
+LAYOUTS = [
+    ("English (US)", "us"),
+    ("English (UK)", "gb"),
+    ("French (FR)", "fr"),
+    ("German (DE)", "de"),
+    ("Italian (IT)", "it"),
+    ("Spanish (ES)", "es"),
+    ("Portuguese (PT)", "pt"),
+    ("Portuguese (BR)", "br"),
+    ("Danish (DK)", "dk"),
+    ("Swedish (SE)", "se"),
+    ("Hungarian (HU)", "hu"),
+]
+
+# HID usage -> evdev keycode, the keys the layouts type with
+LETTER_EVDEV = [30, 48, 46, 32, 18, 33, 34, 35, 23, 36, 37, 38, 50,
+                49, 24, 25, 16, 19, 31, 20, 22, 47, 17, 45, 21, 44]
+USAGES = {0x04 + i: code for i, code in enumerate(LETTER_EVDEV)}
+USAGES.update({0x1E + i: 2 + i for i in range(10)})  # 1..0
+USAGES.update({
+    0x28: 28,   # Enter
+    0x2B: 15,   # Tab
+    0x2C: 57,   # Space
+    0x2D: 12, 0x2E: 13, 0x2F: 26, 0x30: 27,
+    0x31: 43,   # Backslash
+    0x32: 43,   # Non-US #, same key for Linux
+    0x33: 39, 0x34: 40, 0x35: 41, 0x36: 51, 0x37: 52, 0x38: 53,
+    0x54: 98,   # Keypad /
+    0x64: 86,   # ISO key next to left shift
+})
+
+EVDEV_LEFT_SHIFT = 42
+EVDEV_RIGHT_ALT = 100
+MODIFIERS = {0x00: [], 0x02: [EVDEV_LEFT_SHIFT], 0x40: [EVDEV_RIGHT_ALT],
+             0x42: [EVDEV_LEFT_SHIFT, EVDEV_RIGHT_ALT]}
+
+# Dead keysym -> combining mark, spacing accent typed alone
+DEAD_KEYS = {
+    "dead_grave": (0x0300, 0x0060),
+    "dead_acute": (0x0301, 0x00B4),
+    "dead_circumflex": (0x0302, 0x005E),
+    "dead_tilde": (0x0303, 0x007E),
+    "dead_macron": (0x0304, 0x00AF),
+    "dead_breve": (0x0306, 0x02D8),
+    "dead_abovedot": (0x0307, 0x02D9),
+    "dead_diaeresis": (0x0308, 0x00A8),
+    "dead_abovering": (0x030A, 0x02DA),
+    "dead_doubleacute": (0x030B, 0x02DD),
+    "dead_caron": (0x030C, 0x02C7),
+    "dead_cedilla": (0x0327, 0x00B8),
+    "dead_ogonek": (0x0328, 0x02DB),
+}
+
+# Windows UK types acute vowels and the broken bar with AltGr, xkb gb doesn't
+WINDOWS_KEYS = {
+    "gb": {
+        (0x40, 0x04): 0x00E1, (0x42, 0x04): 0x00C1,  # á Á
+        (0x40, 0x08): 0x00E9, (0x42, 0x08): 0x00C9,  # é É
+        (0x40, 0x0C): 0x00ED, (0x42, 0x0C): 0x00CD,  # í Í
+        (0x40, 0x12): 0x00F3, (0x42, 0x12): 0x00D3,  # ó Ó
+        (0x40, 0x18): 0x00FA, (0x42, 0x18): 0x00DA,  # ú Ú
+        (0x40, 0x35): 0x00A6,                        # ¦
+    },
+}
+
+# Accents on AltGr that are dead on Windows, plain characters in xkb
+WINDOWS_DEAD_KEYS = {
+    "fr": {(0x40, 0x1F): "dead_tilde", (0x40, 0x24): "dead_grave"},
+    "es": {(0x40, 0x21): "dead_tilde"},
+    "hu": {(0x40, 0x1E): "dead_tilde", (0x40, 0x20): "dead_circumflex", (0x40, 0x24): "dead_grave"},
+}
+
+
+class RuleNames(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_char_p) for name in ("rules", "model", "layout", "variant", "options")]
+
+
+def load_xkb():
+    xkb = ctypes.CDLL("libxkbcommon.so.0")
+    xkb.xkb_context_new.restype = ctypes.c_void_p
+    xkb.xkb_keymap_new_from_names.restype = ctypes.c_void_p
+    xkb.xkb_keymap_new_from_names.argtypes = [ctypes.c_void_p, ctypes.POINTER(RuleNames), ctypes.c_int]
+    xkb.xkb_state_new.restype = ctypes.c_void_p
+    xkb.xkb_state_new.argtypes = [ctypes.c_void_p]
+    xkb.xkb_state_unref.argtypes = [ctypes.c_void_p]
+    xkb.xkb_state_update_key.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.c_int]
+    xkb.xkb_state_key_get_one_sym.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+    xkb.xkb_state_key_get_one_sym.restype = ctypes.c_uint32
+    xkb.xkb_keysym_to_utf32.argtypes = [ctypes.c_uint32]
+    xkb.xkb_keysym_to_utf32.restype = ctypes.c_uint32
+    xkb.xkb_keysym_get_name.argtypes = [ctypes.c_uint32, ctypes.c_char_p, ctypes.c_size_t]
+    return xkb
+
+
+def keymap(xkb, context, layout):
+    names = RuleNames(b"evdev", b"pc105", layout.encode(), b"", b"")
+    handle = xkb.xkb_keymap_new_from_names(context, ctypes.byref(names), 0)
+    if not handle:
+        raise SystemExit("xkb layout not found: " + layout)
+
+    keys = {}  # (modifiers, usage) -> (codepoint, dead keysym or None)
+    for modifiers, held in MODIFIERS.items():
+        for usage, evdev in USAGES.items():
+            state = xkb.xkb_state_new(handle)
+            for key in held:
+                xkb.xkb_state_update_key(state, key + 8, 1)  # xkb keycodes are evdev + 8
+            sym = xkb.xkb_state_key_get_one_sym(state, evdev + 8)
+            xkb.xkb_state_unref(state)
+
+            buffer = ctypes.create_string_buffer(64)
+            xkb.xkb_keysym_get_name(sym, buffer, 64)
+            name = buffer.value.decode()
+            if name in DEAD_KEYS:
+                keys[(modifiers, usage)] = (DEAD_KEYS[name][1], name)
+                continue
+            codepoint = xkb.xkb_keysym_to_utf32(sym)
+            if name == "Return":
+                codepoint = ord("\n")
+            if codepoint:
+                keys[(modifiers, usage)] = (codepoint, None)
+
+    for stroke, codepoint in WINDOWS_KEYS.get(layout, {}).items():
+        keys[stroke] = (codepoint, None)
+    for stroke, name in WINDOWS_DEAD_KEYS.get(layout, {}).items():
+        keys[stroke] = (DEAD_KEYS[name][1], name)
+    return keys
+
+
+def composed(keys):
+    bases = sorted({cp for cp, dead in keys.values() if not dead and cp > 0x20})
+    out = []
+    for (modifiers, usage), (_, dead) in sorted(keys.items()):
+        if not dead:
+            continue
+        mark = DEAD_KEYS[dead][0]
+        for base in bases:
+            letter = unicodedata.normalize("NFC", chr(base) + chr(mark))
+            if len(letter) == 1:
+                out.append((modifiers, usage, base, ord(letter)))
+    return out
+
+
+def symbol(name):
+    return "reference_" + "".join(c if c.isalnum() else "_" for c in name.lower()).strip("_").replace("__", "_")
+
+
+def main():
+    xkb = load_xkb()
+    context = xkb.xkb_context_new(0)
+    version = subprocess.run(["dpkg-query", "-W", "-f=${Version}", "xkb-data"],
+                             capture_output=True, text=True).stdout or "unknown"
+
+    print("#ifndef REFERENCE_KEYMAPS_H")
+    print("#define REFERENCE_KEYMAPS_H")
+    print()
+    print("// Generated by gen_reference_keymaps.py from xkeyboard-config %s, do not edit." % version)
+    print("// What the host types for each stroke, independent of the firmware tables.")
+    print("// Windows overrides for the keys xkb types differently are listed in the script.")
+    print()
+    print("#include <cstddef>")
+    print("#include <cstdint>")
+    print()
+    print("struct ReferenceKey {")
+    print("    uint8_t modifiers;")
+    print("    uint8_t keycode;")
+    print("    uint32_t codepoint; // spacing accent for a dead key")
+    print("    bool dead;")
+    print("};")
+    print()
+    print("struct ReferenceCompose {")
+    print("    uint8_t modifiers;")
+    print("    uint8_t keycode; // the dead key")
+    print("    uint32_t base;")
+    print("    uint32_t codepoint;")
+    print("};")
+    print()
+    print("struct ReferenceKeymap {")
+    print("    const char* layout; // KeyboardLayoutMapper name")
+    print("    const ReferenceKey* keys;")
+    print("    size_t keyCount;")
+    print("    const ReferenceCompose* composed;")
+    print("    size_t composedCount;")
+    print("};")
+
+    for name, layout in LAYOUTS:
+        keys = keymap(xkb, context, layout)
+        prefix = symbol(name)
+        print()
+        print("// %s, xkb \"%s\"" % (name, layout))
+        print("static const ReferenceKey %s_keys[] = {" % prefix)
+        for (modifiers, usage), (codepoint, dead) in sorted(keys.items()):
+            print("    {0x%02X, 0x%02X, 0x%04X, %s}," % (modifiers, usage, codepoint, "true" if dead else "false"))
+        print("};")
+        letters = composed(keys)
+        if not letters:
+            continue  # no dead keys
+        print("static const ReferenceCompose %s_composed[] = {" % prefix)
+        for modifiers, usage, base, codepoint in letters:
+            print("    {0x%02X, 0x%02X, 0x%04X, 0x%04X}," % (modifiers, usage, base, codepoint))
+        print("};")
+
+    print()
+    print("static const ReferenceKeymap referenceKeymaps[] = {")
+    for name, layout in LAYOUTS:
+        prefix = symbol(name)
+        keys = "%s_keys, sizeof(%s_keys) / sizeof(ReferenceKey)" % (prefix, prefix)
+        letters = "%s_composed, sizeof(%s_composed) / sizeof(ReferenceCompose)" % (prefix, prefix)
+        if not composed(keymap(xkb, context, layout)):
+            letters = "nullptr, 0"
+        print("    {\"%s\", %s, %s}," % (name, keys, letters))
+    print("};")
+    print()
+    print("#endif // REFERENCE_KEYMAPS_H")
+
+
+if __name__ == "__main__":
+    main()